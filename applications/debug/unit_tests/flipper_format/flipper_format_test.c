@@ -456,6 +456,259 @@ static bool test_read_multikey(const char* file_name) {
     return result;
 }
 
+static bool test_key_index(const char* file_name) {
+    Storage* storage = furi_record_open(RECORD_STORAGE);
+    bool result = false;
+    FlipperFormat* file = flipper_format_file_alloc(storage);
+    flipper_format_set_key_index(file, true);
+
+    uint32_t uint32_value;
+    uint8_t uint8_value;
+
+    do {
+        if(!flipper_format_file_open_existing(file, file_name)) break;
+
+        if(!flipper_format_read_uint32(file, "Version", &uint32_value, 1)) break;
+        if(uint32_value != test_version) break;
+        if(flipper_format_read_uint32(file, "Version", &uint32_value, 1)) break;
+        if(!flipper_format_rewind(file)) break;
+        if(flipper_format_key_exist(file, "Missing key")) break;
+        if(!flipper_format_key_exist(file, test_hex_key)) break;
+
+        // Index must follow updates
+        uint32_value = 0;
+        if(!flipper_format_update_uint32(file, "Version", &uint32_value, 1)) break;
+        if(!flipper_format_rewind(file)) break;
+
+        bool error = false;
+        for(uint8_t index = 0; index < 100; index++) {
+            if(!flipper_format_read_hex(file, test_hex_key, &uint8_value, 1) ||
+               uint8_value != index) {
+                error = true;
+                break;
+            }
+        }
+        if(error) break;
+        if(flipper_format_read_hex(file, test_hex_key, &uint8_value, 1)) break;
+
+        if(!flipper_format_rewind(file)) break;
+        if(!flipper_format_read_uint32(file, "Version", &uint32_value, 1)) break;
+        if(uint32_value != 0) break;
+
+        result = true;
+    } while(false);
+
+    flipper_format_free(file);
+    furi_record_close(RECORD_STORAGE);
+
+    return result;
+}
+
+#define BENCHMARK_SIGNALS (50)
+#define BENCHMARK_TIMINGS (100)
+
+static bool test_write_benchmark(const char* file_name) {
+    Storage* storage = furi_record_open(RECORD_STORAGE);
+    bool result = false;
+    FlipperFormat* file = flipper_format_file_alloc(storage);
+    uint32_t* timings = malloc(sizeof(uint32_t) * BENCHMARK_TIMINGS);
+    const uint32_t frequency = 38000;
+    const float duty_cycle = 0.33f;
+
+    do {
+        if(!flipper_format_file_open_always(file, file_name)) break;
+        if(!flipper_format_write_header_cstr(file, test_filetype, test_version)) break;
+
+        bool error = false;
+        for(uint32_t index = 0; index < BENCHMARK_SIGNALS; index++) {
+            for(uint32_t i = 0; i < BENCHMARK_TIMINGS; i++) {
+                timings[i] = 100 + index * i;
+            }
+            if(!flipper_format_write_comment_cstr(file, "") ||
+               !flipper_format_write_string_cstr(file, "name", "Power") ||
+               !flipper_format_write_string_cstr(file, "type", "raw") ||
+               !flipper_format_write_uint32(file, "frequency", &frequency, 1) ||
+               !flipper_format_write_float(file, "duty_cycle", &duty_cycle, 1) ||
+               !flipper_format_write_uint32(file, "data", timings, BENCHMARK_TIMINGS)) {
+                error = true;
+                break;
+            }
+        }
+        if(error) break;
+
+        result = true;
+    } while(false);
+
+    free(timings);
+    flipper_format_free(file);
+    furi_record_close(RECORD_STORAGE);
+
+    return result;
+}
+
+static bool test_read_benchmark(FlipperFormat* file, const char* file_name, bool buffered) {
+    bool result = false;
+    FuriString* string_value = furi_string_alloc();
+    uint32_t* timings = malloc(sizeof(uint32_t) * BENCHMARK_TIMINGS);
+    uint32_t uint32_value;
+    float float_value;
+
+    do {
+        if(buffered) {
+            if(!flipper_format_buffered_file_open_existing(file, file_name)) break;
+        } else {
+            if(!flipper_format_file_open_existing(file, file_name)) break;
+        }
+        if(!flipper_format_read_header(file, string_value, &uint32_value)) break;
+
+        uint32_t index = 0;
+        while(flipper_format_read_string(file, "name", string_value)) {
+            if(!flipper_format_read_string(file, "type", string_value)) break;
+            if(!flipper_format_read_uint32(file, "frequency", &uint32_value, 1)) break;
+            if(!flipper_format_read_float(file, "duty_cycle", &float_value, 1)) break;
+            if(!flipper_format_get_value_count(file, "data", &uint32_value)) break;
+            if(uint32_value != BENCHMARK_TIMINGS) break;
+            if(!flipper_format_read_uint32(file, "data", timings, uint32_value)) break;
+            if(timings[BENCHMARK_TIMINGS - 1] != 100 + index * (BENCHMARK_TIMINGS - 1)) break;
+            index++;
+        }
+        if(index != BENCHMARK_SIGNALS) break;
+
+        result = true;
+    } while(false);
+
+    free(timings);
+    furi_string_free(string_value);
+
+    return result;
+}
+
+#define ARRAY_CHUNK (7)
+
+static bool test_read_array(const char* file_name) {
+    Storage* storage = furi_record_open(RECORD_STORAGE);
+    bool result = false;
+    FlipperFormat* file = flipper_format_buffered_file_alloc(storage);
+    FuriString* string_value = furi_string_alloc();
+    uint32_t timings[ARRAY_CHUNK];
+    uint32_t uint32_value;
+
+    do {
+        if(!flipper_format_buffered_file_open_existing(file, file_name)) break;
+        if(!flipper_format_read_header(file, string_value, &uint32_value)) break;
+
+        uint32_t index = 0;
+        bool error = false;
+        while(!error && flipper_format_read_string(file, "name", string_value)) {
+            if(!flipper_format_read_array_begin(file, "data")) break;
+
+            // Chunk size is not a divisor of the line length
+            uint32_t timings_count = 0;
+            uint16_t timings_read = 0;
+            do {
+                if(!flipper_format_read_array_uint32(file, timings, ARRAY_CHUNK, &timings_read)) {
+                    error = true;
+                    break;
+                }
+                for(uint16_t i = 0; i < timings_read; i++, timings_count++) {
+                    if(timings[i] != 100 + index * timings_count) error = true;
+                }
+            } while(!error && timings_read == ARRAY_CHUNK);
+
+            if(timings_count != BENCHMARK_TIMINGS) error = true;
+
+            // Array is over until the next begin
+            if(!flipper_format_read_array_uint32(file, timings, ARRAY_CHUNK, &timings_read) ||
+               timings_read != 0) {
+                error = true;
+            }
+            index++;
+        }
+        if(error || index != BENCHMARK_SIGNALS) break;
+
+        if(!flipper_format_rewind(file)) break;
+        if(flipper_format_read_array_begin(file, "Missing key")) break;
+
+        result = true;
+    } while(false);
+
+    furi_string_free(string_value);
+    flipper_format_free(file);
+    furi_record_close(RECORD_STORAGE);
+
+    return result;
+}
+
+#define PACKED_VALUES (100)
+
+static int32_t test_packed_value(size_t index) {
+    // Both signs and varints of different length
+    const int32_t value = (int32_t)((index * 7919UL) % (1UL << (index % 28)));
+    return (index % 2) ? -value : value;
+}
+
+static bool test_packed(const char* file_name) {
+    Storage* storage = furi_record_open(RECORD_STORAGE);
+    bool result = false;
+    FlipperFormat* file = flipper_format_file_alloc(storage);
+    int32_t values[PACKED_VALUES];
+    uint32_t uint32_values[2];
+    uint32_t count;
+
+    for(size_t i = 0; i < PACKED_VALUES; i++) {
+        values[i] = test_packed_value(i);
+    }
+    const int32_t positive_values[] = {0, 1690};
+
+    do {
+        if(!flipper_format_file_open_always(file, file_name)) break;
+        if(!flipper_format_write_int32_packed(file, "RAW_Data", values, PACKED_VALUES)) break;
+        if(!flipper_format_write_int32_packed(file, "Positive", positive_values, 2)) break;
+
+        memset(values, 0, sizeof(values));
+        if(!flipper_format_rewind(file)) break;
+        if(!flipper_format_get_value_count(file, "RAW_Data", &count)) break;
+        if(count != PACKED_VALUES) break;
+        if(!flipper_format_read_int32(file, "RAW_Data", values, PACKED_VALUES)) break;
+
+        bool error = false;
+        for(size_t i = 0; i < PACKED_VALUES; i++) {
+            if(values[i] != test_packed_value(i)) error = true;
+        }
+        if(error) break;
+
+        // Packed groups are split between chunks
+        if(!flipper_format_rewind(file)) break;
+        if(!flipper_format_read_array_begin(file, "RAW_Data")) break;
+        uint16_t values_read = 0;
+        count = 0;
+        do {
+            if(!flipper_format_read_array_int32(file, values, ARRAY_CHUNK, &values_read)) {
+                error = true;
+                break;
+            }
+            for(uint16_t i = 0; i < values_read; i++, count++) {
+                if(values[i] != test_packed_value(count)) error = true;
+            }
+        } while(!error && values_read == ARRAY_CHUNK);
+        if(error || count != PACKED_VALUES) break;
+
+        if(!flipper_format_read_uint32(file, "Positive", uint32_values, 2)) break;
+        if(uint32_values[0] != 0 || uint32_values[1] != 1690) break;
+
+        // Negative values are not uint32
+        if(!flipper_format_rewind(file)) break;
+        if(flipper_format_read_uint32(file, "RAW_Data", uint32_values, 2)) break;
+
+        result = true;
+    } while(false);
+
+    flipper_format_free(file);
+    furi_record_close(RECORD_STORAGE);
+
+    return result;
+}
+
 MU_TEST(flipper_format_write_test) {
     mu_assert(storage_write_string(test_file_linux, test_data_nix), "Write test error [Linux]");
     mu_assert(
@@ -522,6 +775,53 @@ MU_TEST(flipper_format_multikey_test) {
     mu_assert(test_read_multikey(TEST_DIR "ff_multiline.test"), "Multikey read test error");
 }
 
+MU_TEST(flipper_format_key_index_test) {
+    mu_assert(test_write_multikey(TEST_DIR "ff_index.test"), "Key index write test error");
+    mu_assert(test_key_index(TEST_DIR "ff_index.test"), "Key index read test error");
+}
+
+MU_TEST(flipper_format_read_array_test) {
+    mu_assert(test_write_benchmark(TEST_DIR "ff_array.test"), "Array write test error");
+    mu_assert(test_read_array(TEST_DIR "ff_array.test"), "Array read test error");
+}
+
+MU_TEST(flipper_format_packed_test) {
+    mu_assert(test_packed(TEST_DIR "ff_packed.test"), "Packed values test error");
+}
+
+MU_TEST(flipper_format_parse_benchmark_test) {
+    const char* file_name = TEST_DIR "ff_benchmark.test";
+    mu_assert(test_write_benchmark(file_name), "Benchmark write test error");
+
+    Storage* storage = furi_record_open(RECORD_STORAGE);
+    FileInfo file_info;
+    mu_assert(
+        storage_common_stat(storage, file_name, &file_info) == FSE_OK,
+        "Benchmark stat test error");
+
+    // Buffered stream data is parsed in place, plain file stream is read in small chunks
+    FlipperFormat* file = flipper_format_buffered_file_alloc(storage);
+    uint32_t start = furi_get_tick();
+    bool result = test_read_benchmark(file, file_name, true);
+    uint32_t buffered_ms = furi_get_tick() - start;
+    flipper_format_free(file);
+    mu_assert(result, "Benchmark buffered read test error");
+
+    file = flipper_format_file_alloc(storage);
+    start = furi_get_tick();
+    result = test_read_benchmark(file, file_name, false);
+    uint32_t file_ms = furi_get_tick() - start;
+    flipper_format_free(file);
+    mu_assert(result, "Benchmark read test error");
+
+    furi_record_close(RECORD_STORAGE);
+
+    printf(
+        "FlipperFormat parse: buffered %lu KB/s, file %lu KB/s\r\n",
+        (uint32_t)(file_info.size / MAX(buffered_ms, 1UL)),
+        (uint32_t)(file_info.size / MAX(file_ms, 1UL)));
+}
+
 MU_TEST(flipper_format_oddities_test) {
     mu_assert(
         storage_write_string(test_file_oddities, test_data_odd), "Write test error [Oddities]");
@@ -541,6 +841,10 @@ MU_TEST_SUITE(flipper_format) {
     MU_RUN_TEST(flipper_format_update_2_test);
     MU_RUN_TEST(flipper_format_update_2_result_test);
     MU_RUN_TEST(flipper_format_multikey_test);
+    MU_RUN_TEST(flipper_format_key_index_test);
+    MU_RUN_TEST(flipper_format_read_array_test);
+    MU_RUN_TEST(flipper_format_packed_test);
+    MU_RUN_TEST(flipper_format_parse_benchmark_test);
     MU_RUN_TEST(flipper_format_oddities_test);
     tests_teardown();
 }
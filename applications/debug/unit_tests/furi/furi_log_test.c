@@ -0,0 +1,115 @@
+#include <stdio.h>
+#include <string.h>
+#include <furi.h>
+#include <furi_hal.h>
+#include "../minunit.h"
+
+#define TEST_LOG_TAG "UnitTestLog"
+// Fewer records than ring slots per round, so calls never wait for log thread
+#define TEST_LOG_COST_BURST 8
+#define TEST_LOG_COST_ROUNDS 16
+
+static FuriString* log_output = NULL;
+
+static void test_furi_log_puts(const char* data) {
+    furi_string_cat_str(log_output, data);
+}
+
+void test_furi_log() {
+    log_output = furi_string_alloc();
+    FuriLogStats stats_before;
+    FuriLogStats stats_after;
+
+    furi_log_flush();
+    furi_log_get_stats(&stats_before);
+    furi_log_set_puts(test_furi_log_puts);
+
+    // Tag override allows records below global level
+    mu_assert(furi_log_set_tag_level(TEST_LOG_TAG, FuriLogLevelTrace), "tag level set failed");
+    FURI_LOG_T(TEST_LOG_TAG, "deferred %d", 42);
+    furi_log_flush();
+    mu_assert(
+        furi_string_search_str(log_output, "[" TEST_LOG_TAG "] ", 0) != FURI_STRING_FAILURE,
+        "tag not printed");
+    mu_assert(
+        furi_string_search_str(log_output, "deferred 42\r\n", 0) != FURI_STRING_FAILURE,
+        "record not printed");
+
+    // Tag override silences records above global level
+    furi_string_reset(log_output);
+    mu_assert(furi_log_set_tag_level(TEST_LOG_TAG, FuriLogLevelNone), "tag level set failed");
+    FURI_LOG_E(TEST_LOG_TAG, "silenced");
+    furi_log_flush();
+    mu_assert(
+        furi_string_search_str(log_output, "silenced", 0) == FURI_STRING_FAILURE,
+        "record not filtered");
+
+    // Ring burst, caller waits for log thread instead of dropping records
+    furi_string_reset(log_output);
+    mu_assert(furi_log_set_tag_level(TEST_LOG_TAG, FuriLogLevelInfo), "tag level set failed");
+    for(int i = 0; i < 64; i++) {
+        FURI_LOG_I(TEST_LOG_TAG, "burst %d", i);
+    }
+    furi_log_flush();
+    mu_assert(
+        furi_string_search_str(log_output, "burst 63\r\n", 0) != FURI_STRING_FAILURE,
+        "burst record lost");
+
+    mu_assert(furi_log_set_tag_level(TEST_LOG_TAG, FuriLogLevelDefault), "tag level reset failed");
+    furi_log_set_puts(furi_hal_console_puts);
+
+    furi_log_get_stats(&stats_after);
+    mu_assert_int_eq(0, stats_after.pending);
+    mu_assert_int_eq(stats_before.dropped, stats_after.dropped);
+
+    furi_string_free(log_output);
+    log_output = NULL;
+}
+
+static void test_furi_log_null_puts(const char* data) {
+    UNUSED(data);
+}
+
+void test_furi_log_cost() {
+    uint32_t enqueued_cycles = 0;
+    uint32_t filtered_cycles = 0;
+    FuriLogStats stats_before;
+    FuriLogStats stats_after;
+
+    furi_log_flush();
+    furi_log_get_stats(&stats_before);
+    furi_log_set_puts(test_furi_log_null_puts);
+
+    // Caller side cost only: output is discarded and drained between rounds
+    mu_assert(furi_log_set_tag_level(TEST_LOG_TAG, FuriLogLevelInfo), "tag level set failed");
+    for(size_t round = 0; round < TEST_LOG_COST_ROUNDS; round++) {
+        uint32_t start = DWT->CYCCNT;
+        for(size_t i = 0; i < TEST_LOG_COST_BURST; i++) {
+            FURI_LOG_I(TEST_LOG_TAG, "cost %zu %s", i, "arg");
+        }
+        enqueued_cycles += DWT->CYCCNT - start;
+        furi_log_flush();
+    }
+
+    mu_assert(furi_log_set_tag_level(TEST_LOG_TAG, FuriLogLevelNone), "tag level set failed");
+    for(size_t round = 0; round < TEST_LOG_COST_ROUNDS; round++) {
+        uint32_t start = DWT->CYCCNT;
+        for(size_t i = 0; i < TEST_LOG_COST_BURST; i++) {
+            FURI_LOG_I(TEST_LOG_TAG, "cost %zu %s", i, "arg");
+        }
+        filtered_cycles += DWT->CYCCNT - start;
+    }
+
+    mu_assert(furi_log_set_tag_level(TEST_LOG_TAG, FuriLogLevelDefault), "tag level reset failed");
+    furi_log_set_puts(furi_hal_console_puts);
+    furi_log_get_stats(&stats_after);
+
+    const uint32_t calls = TEST_LOG_COST_BURST * TEST_LOG_COST_ROUNDS;
+    printf(
+        "\r\nFURI_LOG per call: enqueued %lu cycles, filtered %lu cycles\r\n",
+        enqueued_cycles / calls,
+        filtered_cycles / calls);
+
+    mu_assert_int_eq(stats_before.dropped, stats_after.dropped);
+    mu_assert_int_eq(stats_before.stalled, stats_after.stalled);
+}
@@ -1,4 +1,5 @@
 #include "../minunit.h"
+#include <furi.h>
 #include <stdlib.h>
 #include <string.h>
 #include <stdbool.h>
@@ -37,3 +38,50 @@ void test_furi_memmgr() {
     }
     free(ptr);
 }
+
+#define TEST_MEMMGR_SLAB_OBJECTS 100
+
+void test_furi_memmgr_slab() {
+    uint8_t* objects[TEST_MEMMGR_SLAB_OBJECTS];
+    MemmgrHeapSlabStats stats_before;
+    MemmgrHeapSlabStats stats;
+
+    // Other threads allocate too, scheduler is locked so that only this test changes counters
+    furi_kernel_lock();
+    memmgr_heap_get_slab_stats(1, &stats_before);
+    for(size_t i = 0; i < TEST_MEMMGR_SLAB_OBJECTS; i++) {
+        objects[i] = malloc(24);
+    }
+    memmgr_heap_get_slab_stats(1, &stats);
+    furi_kernel_unlock();
+
+    // 24 byte objects are served by the 32 byte class
+    mu_assert_int_eq(32, stats_before.object_size);
+    mu_assert_int_eq(stats_before.hits + TEST_MEMMGR_SLAB_OBJECTS, stats.hits);
+    mu_assert_int_eq(stats_before.misses, stats.misses);
+    mu_assert_int_eq(stats_before.objects_used + TEST_MEMMGR_SLAB_OBJECTS, stats.objects_used);
+    mu_check(stats.objects_used <= stats.objects_total);
+
+    for(size_t i = 0; i < TEST_MEMMGR_SLAB_OBJECTS; i++) {
+        for(size_t j = 0; j < 24; j++) {
+            mu_assert_int_eq(0, objects[i][j]);
+        }
+        memset(objects[i], i, 24);
+    }
+
+    // Objects must not overlap
+    for(size_t i = 0; i < TEST_MEMMGR_SLAB_OBJECTS; i++) {
+        for(size_t j = 0; j < 24; j++) {
+            mu_assert_int_eq(i, objects[i][j]);
+        }
+    }
+
+    furi_kernel_lock();
+    for(size_t i = 0; i < TEST_MEMMGR_SLAB_OBJECTS; i++) {
+        free(objects[i]);
+    }
+    memmgr_heap_get_slab_stats(1, &stats);
+    furi_kernel_unlock();
+
+    mu_assert_int_eq(stats_before.objects_used, stats.objects_used);
+}
@@ -10,6 +10,10 @@ void test_furi_concurrent_access();
 void test_furi_pubsub();
 
 void test_furi_memmgr();
+void test_furi_memmgr_slab();
+
+void test_furi_log();
+void test_furi_log_cost();
 
 static int foo = 0;
 
@@ -44,6 +48,18 @@ MU_TEST(mu_test_furi_memmgr) {
     test_furi_memmgr();
 }
 
+MU_TEST(mu_test_furi_memmgr_slab) {
+    test_furi_memmgr_slab();
+}
+
+MU_TEST(mu_test_furi_log) {
+    test_furi_log();
+}
+
+MU_TEST(mu_test_furi_log_cost) {
+    test_furi_log_cost();
+}
+
 MU_TEST_SUITE(test_suite) {
     MU_SUITE_CONFIGURE(&test_setup, &test_teardown);
 
@@ -54,6 +70,9 @@ MU_TEST_SUITE(test_suite) {
     MU_RUN_TEST(mu_test_furi_valuemutex);
     MU_RUN_TEST(mu_test_furi_pubsub);
     MU_RUN_TEST(mu_test_furi_memmgr);
+    MU_RUN_TEST(mu_test_furi_memmgr_slab);
+    MU_RUN_TEST(mu_test_furi_log);
+    MU_RUN_TEST(mu_test_furi_log_cost);
 }
 
 int run_minunit_test_furi() {
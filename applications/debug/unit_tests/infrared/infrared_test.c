@@ -3,6 +3,8 @@
 #include <infrared.h>
 #include <common/infrared_common_i.h>
 #include "../minunit.h"
+#include "../../../main/infrared/infrared_brute_force.h"
+#include "../../../main/infrared/infrared_remote.h"
 
 #define IR_TEST_FILES_DIR EXT_PATH("unit_tests/infrared/")
 #define IR_TEST_FILE_PREFIX "test_"
@@ -511,6 +513,265 @@ MU_TEST(infrared_test_encoder_decoder_all) {
     infrared_test_run_encoder_decoder(InfraredProtocolKaseikyo, 1);
 }
 
+#define IR_TEST_BRUTE_FORCE_FILE EXT_PATH("unit_tests/infrared/brute_force.ir")
+#define IR_TEST_BRUTE_FORCE_DB IR_TEST_BRUTE_FORCE_FILE "db"
+
+static const uint32_t infrared_test_raw_timings[][6] = {
+    {9024, 4512, 564, 564, 564, 1692},
+    {2400, 600, 1200, 600, 600, 600},
+};
+
+static const InfraredMessage infrared_test_messages[] = {
+    {.protocol = InfraredProtocolNEC, .address = 0x04, .command = 0x08},
+    {.protocol = InfraredProtocolSamsung32, .address = 0x07, .command = 0x02},
+    {.protocol = InfraredProtocolNEC, .address = 0x00, .command = 0x10},
+};
+
+static void infrared_test_set_raw(InfraredSignal* signal, size_t index) {
+    infrared_signal_set_raw_signal(
+        signal,
+        infrared_test_raw_timings[index],
+        COUNT_OF(infrared_test_raw_timings[index]),
+        INFRARED_COMMON_CARRIER_FREQUENCY,
+        INFRARED_COMMON_DUTY_CYCLE);
+}
+
+static bool infrared_test_brute_force_prepare_file(Storage* storage) {
+    FlipperFormat* ff = flipper_format_file_alloc(storage);
+    InfraredSignal* signal = infrared_signal_alloc();
+
+    bool success = flipper_format_file_open_always(ff, IR_TEST_BRUTE_FORCE_FILE) &&
+                   flipper_format_write_header_cstr(ff, "IR signals file", 1);
+    // Groups are interleaved, so signals have to be regrouped by name
+    infrared_signal_set_message(signal, &infrared_test_messages[0]);
+    success = success && infrared_signal_save(signal, ff, "POWER");
+    infrared_test_set_raw(signal, 0);
+    success = success && infrared_signal_save(signal, ff, "MUTE");
+    infrared_signal_set_message(signal, &infrared_test_messages[1]);
+    success = success && infrared_signal_save(signal, ff, "POWER");
+    infrared_signal_set_message(signal, &infrared_test_messages[2]);
+    success = success && infrared_signal_save(signal, ff, "VOL_UP");
+    infrared_test_set_raw(signal, 1);
+    success = success && infrared_signal_save(signal, ff, "MUTE");
+
+    infrared_signal_free(signal);
+    flipper_format_free(ff);
+    return success;
+}
+
+static void infrared_test_brute_force_check_message(
+    InfraredBruteForce* brute_force,
+    const InfraredMessage* expected) {
+    InfraredSignal* signal = infrared_brute_force_read_next(brute_force);
+    mu_check(signal != NULL);
+    mu_check(!infrared_signal_is_raw(signal));
+    const InfraredMessage* message = infrared_signal_get_message(signal);
+    mu_assert_int_eq(expected->protocol, message->protocol);
+    mu_assert_int_eq(expected->address, message->address);
+    mu_assert_int_eq(expected->command, message->command);
+}
+
+static void infrared_test_brute_force_check_raw(InfraredBruteForce* brute_force, size_t index) {
+    InfraredSignal* signal = infrared_brute_force_read_next(brute_force);
+    mu_check(signal != NULL);
+    mu_check(infrared_signal_is_raw(signal));
+    const InfraredRawSignal* raw = infrared_signal_get_raw_signal(signal);
+    mu_assert_int_eq(COUNT_OF(infrared_test_raw_timings[index]), raw->timings_size);
+    mu_assert_int_eq(INFRARED_COMMON_CARRIER_FREQUENCY, raw->frequency);
+    for(size_t i = 0; i < raw->timings_size; ++i) {
+        mu_assert_int_eq(infrared_test_raw_timings[index][i], raw->timings[i]);
+    }
+}
+
+// Every group is read back in source order, from the compiled database or from the source file
+static void infrared_test_brute_force_read_all() {
+    InfraredBruteForce* brute_force = infrared_brute_force_alloc();
+    uint32_t record_count;
+
+    infrared_brute_force_set_db_filename(brute_force, IR_TEST_BRUTE_FORCE_FILE);
+    infrared_brute_force_add_record(brute_force, 0, "POWER");
+    infrared_brute_force_add_record(brute_force, 1, "MUTE");
+    infrared_brute_force_add_record(brute_force, 2, "VOL_UP");
+    infrared_brute_force_add_record(brute_force, 3, "CH_UP");
+    mu_check(infrared_brute_force_calculate_messages(brute_force));
+
+    mu_check(infrared_brute_force_start(brute_force, 0, &record_count));
+    mu_assert_int_eq(2, record_count);
+    infrared_test_brute_force_check_message(brute_force, &infrared_test_messages[0]);
+    infrared_test_brute_force_check_message(brute_force, &infrared_test_messages[1]);
+    mu_check(infrared_brute_force_read_next(brute_force) == NULL);
+    infrared_brute_force_stop(brute_force);
+
+    mu_check(infrared_brute_force_start(brute_force, 1, &record_count));
+    mu_assert_int_eq(2, record_count);
+    infrared_test_brute_force_check_raw(brute_force, 0);
+    infrared_test_brute_force_check_raw(brute_force, 1);
+    mu_check(infrared_brute_force_read_next(brute_force) == NULL);
+    infrared_brute_force_stop(brute_force);
+
+    mu_check(infrared_brute_force_start(brute_force, 2, &record_count));
+    mu_assert_int_eq(1, record_count);
+    infrared_test_brute_force_check_message(brute_force, &infrared_test_messages[2]);
+    mu_check(infrared_brute_force_read_next(brute_force) == NULL);
+    infrared_brute_force_stop(brute_force);
+
+    mu_check(!infrared_brute_force_start(brute_force, 3, &record_count));
+    mu_assert_int_eq(0, record_count);
+
+    infrared_brute_force_free(brute_force);
+}
+
+static bool infrared_test_append(Storage* storage, const char* path, const char* data) {
+    File* file = storage_file_alloc(storage);
+    size_t size = strlen(data);
+    bool success = storage_file_open(file, path, FSAM_WRITE, FSOM_OPEN_APPEND) &&
+                   (storage_file_write(file, data, size) == size);
+    storage_file_free(file);
+    return success;
+}
+
+static uint64_t infrared_test_file_size(Storage* storage, const char* path) {
+    FileInfo info = {0};
+    storage_common_stat(storage, path, &info);
+    return info.size;
+}
+
+MU_TEST(infrared_test_brute_force) {
+    Storage* storage = furi_record_open(RECORD_STORAGE);
+    storage_simply_remove_recursive(storage, IR_TEST_BRUTE_FORCE_DB);
+    mu_check(infrared_test_brute_force_prepare_file(storage));
+
+    // Database is compiled on the first pass
+    infrared_test_brute_force_read_all();
+    mu_assert_int_eq(FSE_OK, storage_common_stat(storage, IR_TEST_BRUTE_FORCE_DB, NULL));
+    const uint64_t db_size = infrared_test_file_size(storage, IR_TEST_BRUTE_FORCE_DB);
+
+    // Trailing bytes are not read, they survive only as long as the database is reused
+    const char* marker = "MARK";
+    mu_check(infrared_test_append(storage, IR_TEST_BRUTE_FORCE_DB, marker));
+    infrared_test_brute_force_read_all();
+    mu_assert_int_eq(
+        db_size + strlen(marker), infrared_test_file_size(storage, IR_TEST_BRUTE_FORCE_DB));
+
+    // Any change of the source compiles it again
+    mu_check(infrared_test_append(storage, IR_TEST_BRUTE_FORCE_FILE, "# comment\n"));
+    infrared_test_brute_force_read_all();
+    mu_assert_int_eq(db_size, infrared_test_file_size(storage, IR_TEST_BRUTE_FORCE_DB));
+
+    // Database can not be written over a folder, source file is read instead
+    mu_check(storage_simply_remove(storage, IR_TEST_BRUTE_FORCE_DB));
+    mu_check(storage_simply_mkdir(storage, IR_TEST_BRUTE_FORCE_DB));
+    infrared_test_brute_force_read_all();
+
+    mu_check(storage_simply_remove_recursive(storage, IR_TEST_BRUTE_FORCE_DB));
+    mu_check(storage_simply_remove(storage, IR_TEST_BRUTE_FORCE_FILE));
+    furi_record_close(RECORD_STORAGE);
+}
+
+#define IR_TEST_REMOTE_FILE EXT_PATH("unit_tests/infrared/remote.ir")
+
+static const uint32_t infrared_test_capture[] =
+    {9000, 4500, 560, 560, 560, 1690, 560, 560, 560, 1690, 560, 40000};
+// Same capture with every mark shortened and every space stretched by 10%
+static const uint32_t infrared_test_capture_jitter[] =
+    {8100, 4950, 504, 616, 504, 1859, 504, 616, 504, 1859, 504, 44000};
+static const uint32_t infrared_test_capture_other[] =
+    {9000, 4500, 560, 1690, 560, 1690, 560, 560, 560, 560, 560, 40000};
+
+MU_TEST(infrared_test_signal_similarity) {
+    InfraredSignal* signal = infrared_signal_alloc();
+    InfraredSignal* other = infrared_signal_alloc();
+
+    infrared_signal_set_raw_signal(
+        signal, infrared_test_capture, COUNT_OF(infrared_test_capture), 38000, 0.33);
+
+    // Carrier is ignored by both fingerprint and comparison
+    infrared_signal_set_raw_signal(
+        other, infrared_test_capture, COUNT_OF(infrared_test_capture), 56000, 0.5);
+    mu_check(infrared_signal_is_similar(signal, other));
+    mu_assert_int_eq(
+        infrared_signal_get_fingerprint(signal), infrared_signal_get_fingerprint(other));
+
+    // Jitter within tolerance does not change fingerprint either
+    infrared_signal_set_raw_signal(
+        other, infrared_test_capture_jitter, COUNT_OF(infrared_test_capture_jitter), 38000, 0.33);
+    mu_check(infrared_signal_is_similar(signal, other));
+    mu_assert_int_eq(
+        infrared_signal_get_fingerprint(signal), infrared_signal_get_fingerprint(other));
+
+    infrared_signal_set_raw_signal(
+        other, infrared_test_capture_other, COUNT_OF(infrared_test_capture_other), 38000, 0.33);
+    mu_check(!infrared_signal_is_similar(signal, other));
+    infrared_signal_set_raw_signal(
+        other, infrared_test_capture, COUNT_OF(infrared_test_capture) - 1, 38000, 0.33);
+    mu_check(!infrared_signal_is_similar(signal, other));
+
+    infrared_signal_set_message(signal, &infrared_test_messages[0]);
+    infrared_signal_set_message(other, &infrared_test_messages[0]);
+    mu_check(infrared_signal_is_similar(signal, other));
+    mu_assert_int_eq(
+        infrared_signal_get_fingerprint(signal), infrared_signal_get_fingerprint(other));
+    infrared_signal_set_message(other, &infrared_test_messages[2]);
+    mu_check(!infrared_signal_is_similar(signal, other));
+
+    infrared_signal_free(other);
+    infrared_signal_free(signal);
+}
+
+MU_TEST(infrared_test_remote_find_button_by_signal) {
+    InfraredRemote* remote = infrared_remote_alloc();
+    InfraredSignal* signal = infrared_signal_alloc();
+    size_t index;
+
+    infrared_remote_set_name(remote, "remote");
+    infrared_remote_set_path(remote, IR_TEST_REMOTE_FILE);
+
+    infrared_signal_set_message(signal, &infrared_test_messages[0]);
+    mu_check(infrared_remote_add_button(remote, "POWER", signal));
+    infrared_signal_set_raw_signal(
+        signal, infrared_test_capture_other, COUNT_OF(infrared_test_capture_other), 38000, 0.33);
+    mu_check(infrared_remote_add_button(remote, "VOL_UP", signal));
+    infrared_signal_set_raw_signal(
+        signal, infrared_test_capture, COUNT_OF(infrared_test_capture), 38000, 0.33);
+    mu_check(infrared_remote_add_button(remote, "MUTE", signal));
+
+    infrared_signal_set_raw_signal(
+        signal, infrared_test_capture, COUNT_OF(infrared_test_capture), 56000, 0.5);
+    mu_check(infrared_remote_find_button_by_signal(remote, signal, &index));
+    mu_assert_int_eq(2, index);
+
+    // VOL_UP shares fingerprint with MUTE and is checked first
+    infrared_signal_set_raw_signal(
+        signal, infrared_test_capture_jitter, COUNT_OF(infrared_test_capture_jitter), 38000, 0.33);
+    mu_check(infrared_remote_find_button_by_signal(remote, signal, &index));
+    mu_assert_int_eq(2, index);
+
+    infrared_signal_set_raw_signal(
+        signal, infrared_test_capture_other, COUNT_OF(infrared_test_capture_other), 38000, 0.33);
+    mu_check(infrared_remote_find_button_by_signal(remote, signal, &index));
+    mu_assert_int_eq(1, index);
+    infrared_signal_set_raw_signal(
+        signal, infrared_test_capture, COUNT_OF(infrared_test_capture) - 1, 38000, 0.33);
+    mu_check(!infrared_remote_find_button_by_signal(remote, signal, &index));
+
+    infrared_signal_set_message(signal, &infrared_test_messages[0]);
+    mu_check(infrared_remote_find_button_by_signal(remote, signal, &index));
+    mu_assert_int_eq(0, index);
+    infrared_signal_set_message(signal, &infrared_test_messages[1]);
+    mu_check(!infrared_remote_find_button_by_signal(remote, signal, &index));
+
+    // Chains are rebuilt with new indices
+    mu_check(infrared_remote_delete_button(remote, 1));
+    infrared_signal_set_raw_signal(
+        signal, infrared_test_capture_jitter, COUNT_OF(infrared_test_capture_jitter), 38000, 0.33);
+    mu_check(infrared_remote_find_button_by_signal(remote, signal, &index));
+    mu_assert_int_eq(1, index);
+
+    mu_check(infrared_remote_remove(remote));
+    infrared_signal_free(signal);
+    infrared_remote_free(remote);
+}
+
 MU_TEST_SUITE(infrared_test) {
     MU_SUITE_CONFIGURE(&infrared_test_alloc, &infrared_test_free);
 
@@ -529,6 +790,9 @@ MU_TEST_SUITE(infrared_test) {
     MU_RUN_TEST(infrared_test_decoder_kaseikyo);
     MU_RUN_TEST(infrared_test_decoder_mixed);
     MU_RUN_TEST(infrared_test_encoder_decoder_all);
+    MU_RUN_TEST(infrared_test_brute_force);
+    MU_RUN_TEST(infrared_test_signal_similarity);
+    MU_RUN_TEST(infrared_test_remote_find_button_by_signal);
 }
 
 int run_minunit_test_infrared() {
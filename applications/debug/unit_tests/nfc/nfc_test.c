@@ -3,7 +3,12 @@
 #include <storage/storage.h>
 #include <lib/flipper_format/flipper_format.h>
 #include <lib/nfc/protocols/nfca.h>
+#include <lib/nfc/protocols/nfc_util.h>
 #include <lib/nfc/helpers/mf_classic_dict.h>
+#include <lib/nfc/helpers/mf_classic_key_scheduler.h>
+#include <lib/nfc/helpers/mfkey32.h>
+#include <lib/nfc/helpers/mfkey_recovery.h>
+#include <lib/nfc/protocols/crypto1.h>
 #include <lib/digital_signal/digital_signal.h>
 #include <lib/nfc/nfc_device.h>
 #include <lib/nfc/helpers/nfc_generators.h>
@@ -19,6 +24,9 @@
 #define NFC_TEST_SIGNAL_SHORT_FILE "nfc_nfca_signal_short.nfc"
 #define NFC_TEST_SIGNAL_LONG_FILE "nfc_nfca_signal_long.nfc"
 #define NFC_TEST_DICT_PATH EXT_PATH("unit_tests/mf_classic_dict.nfc")
+#define NFC_TEST_DICT_INDEX_PATH EXT_PATH("unit_tests/mf_classic_dict.idx")
+#define NFC_TEST_DICT_INDEX_KEYS 600
+#define NFC_TEST_DICT_LINE_LEN 13
 #define NFC_TEST_NFC_DEV_PATH EXT_PATH("unit_tests/nfc/nfc_dev_test.nfc")
 
 static const char* nfc_test_file_type = "Flipper NFC test";
@@ -293,6 +301,388 @@ MU_TEST(mf_classic_dict_load_test) {
     furi_record_close(RECORD_STORAGE);
 }
 
+static uint64_t nfc_test_dict_index_key(uint32_t index) {
+    // Spread keys over the whole 48 bit range, with a repeated key every 100 keys
+    if(index % 100 == 99) index -= 50;
+    return ((uint64_t)index * 0x9E3779B97F4AULL) & 0xFFFFFFFFFFFFULL;
+}
+
+static bool nfc_test_dict_index_create(Storage* storage) {
+    storage_simply_remove(storage, NFC_TEST_DICT_PATH);
+    storage_simply_remove(storage, NFC_TEST_DICT_INDEX_PATH);
+
+    Stream* file_stream = file_stream_alloc(storage);
+    bool dict_created = false;
+    if(file_stream_open(file_stream, NFC_TEST_DICT_PATH, FSAM_WRITE, FSOM_OPEN_ALWAYS)) {
+        dict_created = stream_write_cstring(file_stream, "# Index test\n") > 0;
+        for(uint32_t i = 0; i < NFC_TEST_DICT_INDEX_KEYS && dict_created; i++) {
+            uint64_t key = nfc_test_dict_index_key(i);
+            dict_created = stream_write_format(
+                               file_stream,
+                               "%04lX%08lX\n",
+                               (uint32_t)(key >> 32),
+                               (uint32_t)key) == NFC_TEST_DICT_LINE_LEN;
+        }
+    }
+    file_stream_close(file_stream);
+    stream_free(file_stream);
+
+    return dict_created;
+}
+
+MU_TEST(mf_classic_dict_index_test) {
+    Storage* storage = furi_record_open(RECORD_STORAGE);
+    mu_assert(nfc_test_dict_index_create(storage), "dict create assert failed\r\n");
+
+    MfClassicDict* instance = mf_classic_dict_alloc(MfClassicDictTypeUnitTest);
+    mu_assert(instance != NULL, "mf_classic_dict_alloc\r\n");
+    mu_assert(
+        mf_classic_dict_get_total_keys(instance) == NFC_TEST_DICT_INDEX_KEYS,
+        "total_keys assert failed\r\n");
+
+    // Every key is found at its first position
+    uint8_t key_bytes[6];
+    uint32_t target = 0;
+    for(uint32_t i = 0; i < NFC_TEST_DICT_INDEX_KEYS; i++) {
+        nfc_util_num2bytes(nfc_test_dict_index_key(i), 6, key_bytes);
+        mu_assert(
+            mf_classic_dict_find_index(instance, key_bytes, &target),
+            "mf_classic_dict_find_index == true assert failed\r\n");
+        uint32_t expected = (i % 100 == 99) ? i - 50 : i;
+        mu_assert(target == expected, "invalid key index\r\n");
+    }
+
+    nfc_util_num2bytes(0x123456789ABC, 6, key_bytes);
+    mu_assert(
+        !mf_classic_dict_is_key_present(instance, key_bytes),
+        "mf_classic_dict_is_key_present == false assert failed\r\n");
+
+    // Appended key is found without rebuilding the dict
+    mu_assert(
+        mf_classic_dict_add_key(instance, key_bytes),
+        "mf_classic_dict_add_key == true assert failed\r\n");
+    mu_assert(
+        mf_classic_dict_find_index(instance, key_bytes, &target),
+        "mf_classic_dict_find_index == true assert failed\r\n");
+    mu_assert(target == NFC_TEST_DICT_INDEX_KEYS, "invalid appended key index\r\n");
+
+    uint64_t key = 0;
+    for(uint32_t i = 0; i < NFC_TEST_DICT_INDEX_KEYS; i += 37) {
+        mu_assert(mf_classic_dict_rewind(instance), "mf_classic_dict_rewind assert failed\r\n");
+        mu_assert(
+            mf_classic_dict_get_key_at_index(instance, &key, i),
+            "mf_classic_dict_get_key_at_index == true assert failed\r\n");
+        mu_assert(key == nfc_test_dict_index_key(i), "invalid key at index\r\n");
+    }
+    mf_classic_dict_free(instance);
+
+    // Saved index is reused and still sees the appended key
+    instance = mf_classic_dict_alloc(MfClassicDictTypeUnitTest);
+    mu_assert(instance != NULL, "mf_classic_dict_alloc\r\n");
+    mu_assert(
+        mf_classic_dict_is_key_present(instance, key_bytes),
+        "mf_classic_dict_is_key_present == true assert failed\r\n");
+    mf_classic_dict_free(instance);
+
+    mu_assert(
+        storage_simply_remove(storage, NFC_TEST_DICT_PATH), "remove == true assert failed\r\n");
+    mu_assert(
+        storage_simply_remove(storage, NFC_TEST_DICT_INDEX_PATH),
+        "remove == true assert failed\r\n");
+    furi_record_close(RECORD_STORAGE);
+}
+
+MU_TEST(mf_classic_dict_iteration_test) {
+    Storage* storage = furi_record_open(RECORD_STORAGE);
+    mu_assert(nfc_test_dict_index_create(storage), "dict create assert failed\r\n");
+
+    MfClassicDict* instance = mf_classic_dict_alloc(MfClassicDictTypeUnitTest);
+    mu_assert(instance != NULL, "mf_classic_dict_alloc\r\n");
+
+    // Text parsing, as used by key list
+    FuriString* temp_str = furi_string_alloc();
+    uint32_t keys_read = 0;
+    uint32_t start = furi_get_tick();
+    while(mf_classic_dict_get_next_key_str(instance, temp_str)) {
+        keys_read++;
+    }
+    uint32_t text_ms = furi_get_tick() - start;
+    furi_string_free(temp_str);
+    mu_assert(keys_read == NFC_TEST_DICT_INDEX_KEYS, "get_next_key_str count assert failed\r\n");
+
+    // Pre-parsed keys, as used by dict attack: once per sector, first pass builds the index
+    uint64_t key = 0;
+    uint32_t binary_ms = 0;
+    for(size_t pass = 0; pass < 3; pass++) {
+        mu_assert(mf_classic_dict_rewind(instance), "mf_classic_dict_rewind assert failed\r\n");
+        keys_read = 0;
+        start = furi_get_tick();
+        while(mf_classic_dict_get_next_key(instance, &key)) {
+            mu_assert(key == nfc_test_dict_index_key(keys_read), "invalid key\r\n");
+            keys_read++;
+        }
+        if(pass > 0) binary_ms += furi_get_tick() - start;
+        mu_assert(keys_read == NFC_TEST_DICT_INDEX_KEYS, "get_next_key count assert failed\r\n");
+    }
+
+    printf(
+        "Dict iteration: text %lu keys/s, pre-parsed %lu keys/s\r\n",
+        NFC_TEST_DICT_INDEX_KEYS * 1000 / MAX(text_ms, 1UL),
+        NFC_TEST_DICT_INDEX_KEYS * 2 * 1000 / MAX(binary_ms, 1UL));
+
+    mf_classic_dict_free(instance);
+    mu_assert(
+        storage_simply_remove(storage, NFC_TEST_DICT_PATH), "remove == true assert failed\r\n");
+    mu_assert(
+        storage_simply_remove(storage, NFC_TEST_DICT_INDEX_PATH),
+        "remove == true assert failed\r\n");
+    furi_record_close(RECORD_STORAGE);
+}
+
+static uint64_t nfc_test_key_scheduler_card_key(uint8_t sector, MfClassicKey key_type) {
+    // Card with three applications: transport keys, separate A/B keys and shared A/B keys
+    if(sector < 4) return 0xFFFFFFFFFFFF;
+    if(sector < 8) return (key_type == MfClassicKeyA) ? 0xA0A1A2A3A4A5 : 0xD3F7D3F7D3F7;
+    return 0x4D3A99C351DD;
+}
+
+MU_TEST(mf_classic_key_scheduler_test) {
+    const uint64_t dict[] = {
+        0x000000000000,
+        0x4D3A99C351DD,
+        0xB0B1B2B3B4B5,
+        0xA0A1A2A3A4A5,
+        0xFFFFFFFFFFFF,
+        0xD3F7D3F7D3F7,
+        0x1A2B3C4D5E6F,
+    };
+    const size_t dict_size = COUNT_OF(dict);
+
+    MfClassicData data = {.type = MfClassicType1k};
+    uint8_t total_sectors = mf_classic_get_total_sectors_num(data.type);
+    MfClassicKeyScheduler* scheduler = mf_classic_key_scheduler_alloc(&data);
+    mu_assert(
+        !mf_classic_key_scheduler_is_done(scheduler),
+        "scheduler_is_done == false assert failed\r\n");
+
+    uint32_t attempts = 0;
+    size_t keys_used = 0;
+    for(; keys_used < dict_size; keys_used++) {
+        if(mf_classic_key_scheduler_is_done(scheduler)) break;
+        uint64_t key = dict[keys_used];
+        uint64_t tried_mask[2] = {};
+        mf_classic_key_scheduler_set_key(scheduler, key);
+
+        MfClassicKeySlot slot = {};
+        MfClassicKeySlot prev_slot = {};
+        bool prev_key_found = false;
+        while(mf_classic_key_scheduler_get_next_slot(scheduler, &slot)) {
+            mu_assert(slot.sector < total_sectors, "invalid slot sector\r\n");
+            mu_assert(
+                !mf_classic_is_key_found(&data, slot.sector, slot.key_type),
+                "slot with found key scheduled\r\n");
+            mu_assert(
+                !(tried_mask[slot.key_type] & (1ULL << slot.sector)), "slot tried twice\r\n");
+
+            // After a hit the key is tried on the sibling slot first, then on neighbour sectors
+            if(prev_key_found) {
+                uint8_t sec = prev_slot.sector;
+                MfClassicKey other = (prev_slot.key_type == MfClassicKeyA) ? MfClassicKeyB :
+                                                                              MfClassicKeyA;
+                bool sibling_pending = !mf_classic_is_key_found(&data, sec, other) &&
+                                       !(tried_mask[other] & (1ULL << sec));
+                if(sibling_pending) {
+                    mu_assert(
+                        slot.sector == sec && slot.key_type == other,
+                        "sibling slot not scheduled after hit\r\n");
+                } else {
+                    bool neighbour_pending = false;
+                    for(int8_t diff = -1; diff <= 1; diff += 2) {
+                        int16_t neighbour = sec + diff;
+                        if(neighbour < 0 || neighbour >= total_sectors) continue;
+                        if(mf_classic_is_key_found(&data, neighbour, prev_slot.key_type)) continue;
+                        if(tried_mask[prev_slot.key_type] & (1ULL << neighbour)) continue;
+                        neighbour_pending = true;
+                    }
+                    if(neighbour_pending) {
+                        mu_assert(
+                            (slot.sector + 1 == sec || slot.sector == sec + 1),
+                            "neighbour slot not scheduled after hit\r\n");
+                    }
+                }
+            }
+
+            bool key_found = nfc_test_key_scheduler_card_key(slot.sector, slot.key_type) == key;
+            tried_mask[slot.key_type] |= 1ULL << slot.sector;
+            mf_classic_key_scheduler_set_result(scheduler, &slot, key_found);
+            attempts++;
+            prev_slot = slot;
+            prev_key_found = key_found;
+        }
+    }
+
+    mu_assert(mf_classic_key_scheduler_is_done(scheduler), "not all keys found\r\n");
+    mu_assert(
+        mf_classic_key_scheduler_get_first_unknown_sector(scheduler) == total_sectors,
+        "first unknown sector assert failed\r\n");
+    // Last card key is the 6th one, the decoy after it is never tried
+    mu_assert(keys_used == dict_size - 1, "dict keys used assert failed\r\n");
+    mu_assert(attempts <= keys_used * total_sectors * 2, "too many attempts\r\n");
+    for(uint8_t i = 0; i < total_sectors; i++) {
+        MfClassicSectorTrailer* sec_tr = mf_classic_get_sector_trailer_by_sector(&data, i);
+        mu_assert(
+            nfc_util_bytes2num(sec_tr->key_a, 6) ==
+                nfc_test_key_scheduler_card_key(i, MfClassicKeyA),
+            "invalid key A\r\n");
+        mu_assert(
+            nfc_util_bytes2num(sec_tr->key_b, 6) ==
+                nfc_test_key_scheduler_card_key(i, MfClassicKeyB),
+            "invalid key B\r\n");
+    }
+    printf(
+        "Key scheduler: %lu attempts for %u keys, %u slots\r\n",
+        attempts,
+        keys_used,
+        total_sectors * 2);
+
+    mf_classic_key_scheduler_free(scheduler);
+}
+
+static uint32_t nfc_test_crypto1_random(uint32_t* seed) {
+    *seed = *seed * 1664525 + 1013904223;
+    return *seed;
+}
+
+MU_TEST(crypto1_sliced_test) {
+    uint32_t seed = 0x12345678;
+    Crypto1 states[CRYPTO1_SLICED_LANES];
+    Crypto1Sliced* sliced = malloc(sizeof(Crypto1Sliced));
+    crypto1_sliced_reset(sliced);
+
+    // Key is restored from the state and rollback undoes clocking
+    for(uint8_t lane = 0; lane < CRYPTO1_SLICED_LANES; lane++) {
+        uint64_t key = ((uint64_t)nfc_test_crypto1_random(&seed) << 16 ^
+                        nfc_test_crypto1_random(&seed)) &
+                       0xFFFFFFFFFFFF;
+        crypto1_init(&states[lane], key);
+        mu_assert(crypto1_get_key(&states[lane]) == key, "crypto1_get_key assert failed\r\n");
+        Crypto1 crypto = states[lane];
+        uint32_t in = nfc_test_crypto1_random(&seed);
+        uint32_t out = crypto1_word(&crypto, in, lane & 1);
+        mu_assert(
+            crypto1_rollback_word(&crypto, in, lane & 1) == out,
+            "crypto1_rollback_word output assert failed\r\n");
+        mu_assert(
+            crypto1_get_key(&crypto) == key, "crypto1_rollback_word state assert failed\r\n");
+        crypto1_sliced_set_state(sliced, lane, &states[lane]);
+    }
+
+    // Every lane follows the scalar implementation
+    for(uint8_t i = 0; i < 64; i++) {
+        uint8_t in = nfc_test_crypto1_random(&seed) & 1;
+        int is_encrypted = i & 1;
+        uint32_t out = crypto1_sliced_bit(sliced, in ? UINT32_MAX : 0, is_encrypted);
+        for(uint8_t lane = 0; lane < CRYPTO1_SLICED_LANES; lane++) {
+            mu_assert(
+                FURI_BIT(out, lane) == crypto1_bit(&states[lane], in, is_encrypted),
+                "crypto1_sliced_bit assert failed\r\n");
+        }
+    }
+    for(uint8_t i = 0; i < 16; i++) {
+        uint8_t in = nfc_test_crypto1_random(&seed) & 1;
+        uint32_t out = crypto1_sliced_rollback_bit(sliced, in ? UINT32_MAX : 0, 1);
+        for(uint8_t lane = 0; lane < CRYPTO1_SLICED_LANES; lane++) {
+            mu_assert(
+                FURI_BIT(out, lane) == crypto1_rollback_bit(&states[lane], in, 1),
+                "crypto1_sliced_rollback_bit assert failed\r\n");
+        }
+    }
+    for(uint8_t lane = 0; lane < CRYPTO1_SLICED_LANES; lane++) {
+        Crypto1 crypto = {};
+        crypto1_sliced_get_state(sliced, lane, &crypto);
+        mu_assert(
+            crypto.odd == (states[lane].odd & 0xffffff) &&
+                crypto.even == (states[lane].even & 0xffffff),
+            "crypto1_sliced_get_state assert failed\r\n");
+    }
+
+    // Only the lane with the same keystream matches
+    Crypto1 crypto = states[7];
+    uint32_t keystream = crypto1_word(&crypto, 0, 0);
+    Crypto1Sliced sliced_copy = *sliced;
+    uint32_t lanes = crypto1_sliced_word_match(&sliced_copy, 0, keystream, UINT32_MAX);
+    mu_assert(lanes == (1UL << 7), "crypto1_sliced_word_match assert failed\r\n");
+
+    // Keystream throughput of one state against all lanes
+    const uint32_t words = 256;
+    uint32_t start = furi_get_tick();
+    for(uint32_t i = 0; i < words; i++) {
+        crypto1_word(&crypto, 0, 0);
+    }
+    uint32_t scalar_ms = furi_get_tick() - start;
+    start = furi_get_tick();
+    for(uint32_t i = 0; i < words; i++) {
+        crypto1_sliced_word(sliced, 0, 0);
+    }
+    uint32_t sliced_ms = furi_get_tick() - start;
+    printf(
+        "Crypto1: scalar %lu bits/s, sliced %lu bits/s\r\n",
+        words * 32 * 1000 / MAX(scalar_ms, 1UL),
+        words * 32 * CRYPTO1_SLICED_LANES * 1000 / MAX(sliced_ms, 1UL));
+
+    free(sliced);
+}
+
+MU_TEST(mfkey32_parse_params_test) {
+    FuriString* line = furi_string_alloc_set(
+        "Sec 5 key B cuid 2a234f80 nt0 55721809 nr0 ce9985f6 ar0 772f55be "
+        "nt1 a27173f2 nr1 e386b505 ar1 5fa65203\n");
+    Mfkey32Params params = {};
+    mu_assert(mfkey32_parse_params(line, &params), "mfkey32_parse_params assert failed\r\n");
+    mu_assert(params.sector == 5, "invalid sector\r\n");
+    mu_assert(params.key == MfClassicKeyB, "invalid key type\r\n");
+    mu_assert(params.cuid == 0x2a234f80, "invalid cuid\r\n");
+    mu_assert(params.nt0 == 0x55721809, "invalid nt0\r\n");
+    mu_assert(params.ar1 == 0x5fa65203, "invalid ar1\r\n");
+
+    furi_string_set(line, "Sec 5 key C cuid 2a234f80\n");
+    mu_assert(!mfkey32_parse_params(line, &params), "mfkey32_parse_params assert failed\r\n");
+    furi_string_free(line);
+}
+
+static void mfkey_recovery_test_key(uint64_t key, const Mfkey32Params* params, uint32_t at0) {
+    uint64_t found_key = 0;
+    mu_assert(mfkey32_recover_key(params, &found_key), "mfkey32_recover_key assert failed\r\n");
+    mu_assert(found_key == key, "mfkey32 recovered wrong key\r\n");
+
+    found_key = 0;
+    mu_assert(
+        mfkey64_recover_key(params->cuid, params->nt0, params->nr0, params->ar0, at0, &found_key),
+        "mfkey64_recover_key assert failed\r\n");
+    mu_assert(found_key == key, "mfkey64 recovered wrong key\r\n");
+}
+
+MU_TEST(mfkey_recovery_test) {
+    // Key and reader nonces are picked so that the state is found in the 28th pair of chunks
+    Mfkey32Params params = {
+        .cuid = 0x2a234f80,
+        .nt0 = 0x55721809,
+        .nr0 = 0xf2e26303,
+        .ar0 = 0xd6d511c6,
+        .nt1 = 0xa27173f2,
+        .nr1 = 0x9036ae9c,
+        .ar1 = 0x3049446d,
+    };
+    mfkey_recovery_test_key(0x3b3873d92b66, &params, 0x0b177c2d);
+
+    // Same nonces from the card, state is found in the 109th pair of chunks
+    params.nr0 = 0x62a048c9;
+    params.ar0 = 0x0f5c867e;
+    params.nr1 = 0x34674b5e;
+    params.ar1 = 0x5a6a487b;
+    mfkey_recovery_test_key(0x4d994fc2a90f, &params, 0x8822070f);
+}
+
 MU_TEST(nfca_file_test) {
     NfcDevice* nfc = nfc_device_alloc();
     mu_assert(nfc != NULL, "nfc_device_data != NULL assert failed\r\n");
@@ -493,6 +883,12 @@ MU_TEST_SUITE(nfc) {
     MU_RUN_TEST(nfc_digital_signal_test);
     MU_RUN_TEST(mf_classic_dict_test);
     MU_RUN_TEST(mf_classic_dict_load_test);
+    MU_RUN_TEST(mf_classic_dict_index_test);
+    MU_RUN_TEST(mf_classic_dict_iteration_test);
+    MU_RUN_TEST(mf_classic_key_scheduler_test);
+    MU_RUN_TEST(crypto1_sliced_test);
+    MU_RUN_TEST(mfkey32_parse_params_test);
+    MU_RUN_TEST(mfkey_recovery_test);
 
     nfc_test_free();
 }
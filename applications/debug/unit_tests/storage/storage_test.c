@@ -1,6 +1,7 @@
 #include "../minunit.h"
 #include <furi.h>
 #include <storage/storage.h>
+#include <gui/modules/file_browser_worker.h>
 
 #define STORAGE_LOCKED_FILE EXT_PATH("locked_file.test")
 #define STORAGE_LOCKED_DIR STORAGE_INT_PATH_PREFIX
@@ -84,11 +85,139 @@ MU_TEST(storage_file_open_close) {
     furi_record_close(RECORD_STORAGE);
 }
 
+#define STORAGE_IO_FILE EXT_PATH("io_file.test")
+
+typedef struct {
+    FuriSemaphore* semaphore;
+    size_t size;
+} StorageAsyncIoContext;
+
+static void storage_file_async_io_callback(File* file, size_t size, void* context) {
+    UNUSED(file);
+    StorageAsyncIoContext* io_context = context;
+    io_context->size = size;
+    furi_semaphore_release(io_context->semaphore);
+}
+
+MU_TEST(storage_file_vectored_io) {
+    Storage* storage = furi_record_open(RECORD_STORAGE);
+    File* file = storage_file_alloc(storage);
+
+    char header[] = "head";
+    char body[] = "0123456789";
+    StorageIoVec write_vec[] = {
+        {.buff = header, .size = 4},
+        {.buff = NULL, .size = 0},
+        {.buff = body, .size = 10},
+    };
+
+    mu_check(storage_file_open(file, STORAGE_IO_FILE, FSAM_WRITE, FSOM_CREATE_ALWAYS));
+    mu_assert_int_eq(14, storage_file_writev(file, write_vec, COUNT_OF(write_vec)));
+    storage_file_close(file);
+
+    char read_header[4];
+    char read_body[16];
+    StorageIoVec read_vec[] = {
+        {.buff = read_header, .size = sizeof(read_header)},
+        {.buff = read_body, .size = sizeof(read_body)},
+    };
+
+    mu_check(storage_file_open(file, STORAGE_IO_FILE, FSAM_READ, FSOM_OPEN_EXISTING));
+    // Short read of the last segment
+    mu_assert_int_eq(14, storage_file_readv(file, read_vec, COUNT_OF(read_vec)));
+    mu_assert_mem_eq(header, read_header, 4);
+    mu_assert_mem_eq(body, read_body, 10);
+    mu_assert_int_eq(0, storage_file_readv(file, read_vec, COUNT_OF(read_vec)));
+    storage_file_close(file);
+
+    storage_file_free(file);
+    mu_check(storage_simply_remove(storage, STORAGE_IO_FILE));
+    furi_record_close(RECORD_STORAGE);
+}
+
+MU_TEST(storage_file_async_io) {
+    Storage* storage = furi_record_open(RECORD_STORAGE);
+    File* file = storage_file_alloc(storage);
+    StorageAsyncIoContext io_context = {
+        .semaphore = furi_semaphore_alloc(1, 0),
+        .size = 0,
+    };
+
+    const char data[] = "async data";
+    mu_check(storage_file_open(file, STORAGE_IO_FILE, FSAM_READ_WRITE, FSOM_CREATE_ALWAYS));
+    storage_file_write_async(file, data, 10, storage_file_async_io_callback, &io_context);
+    mu_assert_int_eq(
+        FuriStatusOk, furi_semaphore_acquire(io_context.semaphore, FuriWaitForever));
+    mu_assert_int_eq(10, io_context.size);
+
+    char buffer[16];
+    mu_check(storage_file_seek(file, 0, true));
+    storage_file_read_async(
+        file, buffer, sizeof(buffer), storage_file_async_io_callback, &io_context);
+    mu_assert_int_eq(
+        FuriStatusOk, furi_semaphore_acquire(io_context.semaphore, FuriWaitForever));
+    mu_assert_int_eq(10, io_context.size);
+    mu_assert_mem_eq(data, buffer, 10);
+
+    storage_file_close(file);
+    storage_file_free(file);
+    furi_semaphore_free(io_context.semaphore);
+    mu_check(storage_simply_remove(storage, STORAGE_IO_FILE));
+    furi_record_close(RECORD_STORAGE);
+}
+
+#define STORAGE_MANY_FILES_DIR EXT_PATH("many_files_test")
+#define STORAGE_MANY_FILES_COUNT 64
+
+MU_TEST(storage_file_open_many) {
+    Storage* storage = furi_record_open(RECORD_STORAGE);
+    File** files = malloc(sizeof(File*) * STORAGE_MANY_FILES_COUNT);
+    FuriString* path = furi_string_alloc();
+
+    storage_simply_remove_recursive(storage, STORAGE_MANY_FILES_DIR);
+    mu_check(storage_simply_mkdir(storage, STORAGE_MANY_FILES_DIR));
+
+    for(size_t i = 0; i < STORAGE_MANY_FILES_COUNT; i++) {
+        furi_string_printf(path, "%s/%u", STORAGE_MANY_FILES_DIR, i);
+        files[i] = storage_file_alloc(storage);
+        mu_check(storage_file_open(
+            files[i], furi_string_get_cstr(path), FSAM_WRITE, FSOM_CREATE_ALWAYS));
+    }
+
+    // Every open file is found by path and by handle
+    uint32_t tick = furi_get_tick();
+    for(size_t i = 0; i < STORAGE_MANY_FILES_COUNT; i++) {
+        furi_string_printf(path, "%s/%u", STORAGE_MANY_FILES_DIR, i);
+        mu_assert_int_eq(
+            FSE_ALREADY_OPEN, storage_common_remove(storage, furi_string_get_cstr(path)));
+        mu_assert_int_eq(1, storage_file_write(files[i], &i, 1));
+    }
+    FURI_LOG_I(
+        "StorageTest",
+        "%u lookups with %u open files: %lums",
+        STORAGE_MANY_FILES_COUNT * 2,
+        STORAGE_MANY_FILES_COUNT,
+        furi_get_tick() - tick);
+
+    for(size_t i = 0; i < STORAGE_MANY_FILES_COUNT; i++) {
+        mu_check(storage_file_close(files[i]));
+        storage_file_free(files[i]);
+    }
+
+    mu_check(storage_simply_remove_recursive(storage, STORAGE_MANY_FILES_DIR));
+    furi_string_free(path);
+    free(files);
+    furi_record_close(RECORD_STORAGE);
+}
+
 MU_TEST_SUITE(storage_file) {
     storage_file_open_lock_setup();
     MU_RUN_TEST(storage_file_open_close);
     MU_RUN_TEST(storage_file_open_lock);
     storage_file_open_lock_teardown();
+    MU_RUN_TEST(storage_file_vectored_io);
+    MU_RUN_TEST(storage_file_async_io);
+    MU_RUN_TEST(storage_file_open_many);
 }
 
 MU_TEST(storage_dir_open_close) {
@@ -303,9 +432,128 @@ MU_TEST_SUITE(storage_rename) {
     furi_record_close(RECORD_STORAGE);
 }
 
+#define STORAGE_BROWSER_DIR EXT_PATH("browser_cache_test")
+#define STORAGE_BROWSER_TIMEOUT 1000
+
+typedef struct {
+    FuriSemaphore* folder_semaphore;
+    FuriSemaphore* load_semaphore;
+    uint32_t folder_items;
+    int32_t folder_idx;
+    uint32_t loaded_items;
+} StorageBrowserContext;
+
+static void storage_browser_folder_callback(
+    void* context,
+    uint32_t item_cnt,
+    int32_t file_idx,
+    bool is_root) {
+    UNUSED(is_root);
+    StorageBrowserContext* browser_context = context;
+    browser_context->folder_items = item_cnt;
+    browser_context->folder_idx = file_idx;
+    furi_semaphore_release(browser_context->folder_semaphore);
+}
+
+static void storage_browser_item_callback(
+    void* context,
+    FuriString* item_path,
+    bool is_folder,
+    bool is_last) {
+    UNUSED(item_path);
+    UNUSED(is_folder);
+    StorageBrowserContext* browser_context = context;
+    if(is_last) {
+        furi_semaphore_release(browser_context->load_semaphore);
+    } else {
+        browser_context->loaded_items++;
+    }
+}
+
+// Refresh with a marker index and drop the folder events that came before it
+static bool storage_browser_sync(
+    BrowserWorker* browser,
+    StorageBrowserContext* browser_context,
+    int32_t marker) {
+    file_browser_worker_folder_refresh(browser, marker);
+    do {
+        if(furi_semaphore_acquire(browser_context->folder_semaphore, STORAGE_BROWSER_TIMEOUT) !=
+           FuriStatusOk) {
+            return false;
+        }
+    } while(browser_context->folder_idx != marker);
+    while(furi_semaphore_acquire(browser_context->folder_semaphore, 0) == FuriStatusOk) {
+    }
+    return true;
+}
+
+static uint32_t
+    storage_browser_load(BrowserWorker* browser, StorageBrowserContext* browser_context) {
+    browser_context->loaded_items = 0;
+    file_browser_worker_load(browser, 0, 16);
+    if(furi_semaphore_acquire(browser_context->load_semaphore, STORAGE_BROWSER_TIMEOUT) !=
+       FuriStatusOk) {
+        return 0;
+    }
+    return browser_context->loaded_items;
+}
+
+MU_TEST(storage_browser_cache) {
+    Storage* storage = furi_record_open(RECORD_STORAGE);
+    StorageBrowserContext browser_context = {
+        .folder_semaphore = furi_semaphore_alloc(8, 0),
+        .load_semaphore = furi_semaphore_alloc(1, 0),
+    };
+
+    storage_simply_remove_recursive(storage, STORAGE_BROWSER_DIR);
+    mu_check(storage_simply_mkdir(storage, STORAGE_BROWSER_DIR));
+    mu_check(write_file_13DA(storage, STORAGE_BROWSER_DIR "/1.test"));
+    mu_check(write_file_13DA(storage, STORAGE_BROWSER_DIR "/2.test"));
+    mu_check(write_file_13DA(storage, STORAGE_BROWSER_DIR "/3.test"));
+    // Folder is cached only after the second of the last storage change
+    furi_delay_ms(1100);
+
+    FuriString* path = furi_string_alloc_set(STORAGE_BROWSER_DIR);
+    BrowserWorker* browser = file_browser_worker_alloc(path, NULL, "*", false, false);
+    file_browser_worker_set_callback_context(browser, &browser_context);
+    file_browser_worker_set_folder_callback(browser, storage_browser_folder_callback);
+    file_browser_worker_set_item_callback(browser, storage_browser_item_callback);
+
+    // The first folder enter may come before or after the callbacks are set
+    mu_check(storage_browser_sync(browser, &browser_context, 1));
+    mu_check(storage_browser_sync(browser, &browser_context, 2));
+    mu_assert_int_eq(3, browser_context.folder_items);
+    mu_assert_int_eq(3, storage_browser_load(browser, &browser_context));
+
+    // Listing is refreshed after a file is created or removed
+    mu_check(write_file_13DA(storage, STORAGE_BROWSER_DIR "/4.test"));
+    mu_assert_int_eq(4, storage_browser_load(browser, &browser_context));
+
+    file_browser_worker_folder_enter(browser, path, 0);
+    mu_assert_int_eq(
+        FuriStatusOk,
+        furi_semaphore_acquire(browser_context.folder_semaphore, STORAGE_BROWSER_TIMEOUT));
+    mu_assert_int_eq(4, browser_context.folder_items);
+
+    mu_check(storage_simply_remove(storage, STORAGE_BROWSER_DIR "/1.test"));
+    mu_assert_int_eq(3, storage_browser_load(browser, &browser_context));
+
+    file_browser_worker_free(browser);
+    furi_string_free(path);
+    furi_semaphore_free(browser_context.folder_semaphore);
+    furi_semaphore_free(browser_context.load_semaphore);
+    mu_check(storage_simply_remove_recursive(storage, STORAGE_BROWSER_DIR));
+    furi_record_close(RECORD_STORAGE);
+}
+
+MU_TEST_SUITE(storage_browser) {
+    MU_RUN_TEST(storage_browser_cache);
+}
+
 int run_minunit_test_storage() {
     MU_RUN_SUITE(storage_file);
     MU_RUN_SUITE(storage_dir);
     MU_RUN_SUITE(storage_rename);
+    MU_RUN_SUITE(storage_browser);
     return MU_EXIT_CODE;
 }
@@ -315,6 +315,13 @@ MU_TEST(stream_composite_test) {
         stream, EXT_PATH("filestream.str"), FSAM_READ_WRITE, FSOM_CREATE_ALWAYS));
     MU_RUN_TEST_1(stream_composite_subtest, stream);
     stream_free(stream);
+
+    // test buffered file stream with cache smaller than the data
+    stream = buffered_file_stream_alloc_ex(storage, 16);
+    mu_check(buffered_file_stream_open(
+        stream, EXT_PATH("filestream.str"), FSAM_READ_WRITE, FSOM_CREATE_ALWAYS));
+    MU_RUN_TEST_1(stream_composite_subtest, stream);
+    stream_free(stream);
     furi_record_close(RECORD_STORAGE);
 }
 
@@ -518,12 +525,157 @@ MU_TEST(stream_buffered_large_file_test) {
     furi_string_free(output_data);
 }
 
+MU_TEST_1(stream_large_delete_and_insert_subtest, Stream* stream) {
+    Stream* expected = string_stream_alloc();
+    FuriString* insert_data;
+    FuriString* large_insert_data;
+    FuriString* expected_data;
+    FuriString* output_data;
+    insert_data = furi_string_alloc();
+    large_insert_data = furi_string_alloc();
+    expected_data = furi_string_alloc();
+    output_data = furi_string_alloc();
+
+    // file data is moved in 2 KB blocks, about 11 KB of data and 5 KB inserts span several
+    stream_clean(stream);
+    for(uint8_t i = 0; i < 64; ++i) {
+        mu_check(stream_write_format(stream, "%u: %s\n", i, stream_test_data) > 0);
+        mu_check(stream_write_format(expected, "%u: %s\n", i, stream_test_data) > 0);
+        furi_string_cat_printf(insert_data, "%02u", i);
+    }
+    for(uint8_t i = 0; i < 32; ++i) {
+        furi_string_cat_printf(large_insert_data, "%s\n", stream_test_data);
+    }
+
+    // insert, overwrite with the same size, grow and shrink, with small and large inserts
+    const size_t positions[] = {0, 100, 5000, 8000, 3, 6000, 20};
+    const size_t delete_sizes[] = {0, 128, 64, 3000, 9000, 100, 8000};
+    for(size_t i = 0; i < COUNT_OF(positions); i++) {
+        FuriString* data = (i < 5) ? insert_data : large_insert_data;
+        size_t position = MIN(positions[i], stream_size(expected));
+        mu_check(stream_seek(stream, position, StreamOffsetFromStart));
+        mu_check(stream_seek(expected, position, StreamOffsetFromStart));
+        mu_check(stream_delete_and_insert_string(stream, delete_sizes[i], data));
+        mu_check(stream_delete_and_insert_string(expected, delete_sizes[i], data));
+        mu_assert_int_eq(stream_tell(expected), stream_tell(stream));
+        mu_assert_int_eq(stream_size(expected), stream_size(stream));
+    }
+
+    // check against the string stream
+    FuriString* tmp;
+    tmp = furi_string_alloc();
+    mu_check(stream_rewind(stream));
+    while(stream_read_line(stream, tmp)) {
+        furi_string_cat(output_data, tmp);
+    }
+    mu_check(stream_rewind(expected));
+    while(stream_read_line(expected, tmp)) {
+        furi_string_cat(expected_data, tmp);
+    }
+    furi_string_free(tmp);
+    mu_check(furi_string_equal(expected_data, output_data));
+
+    furi_string_free(insert_data);
+    furi_string_free(large_insert_data);
+    furi_string_free(expected_data);
+    furi_string_free(output_data);
+    stream_free(expected);
+}
+
+MU_TEST(stream_large_delete_and_insert_test) {
+    Storage* storage = furi_record_open(RECORD_STORAGE);
+
+    Stream* stream = file_stream_alloc(storage);
+    mu_check(
+        file_stream_open(stream, EXT_PATH("filestream.str"), FSAM_READ_WRITE, FSOM_CREATE_ALWAYS));
+    MU_RUN_TEST_1(stream_large_delete_and_insert_subtest, stream);
+    stream_free(stream);
+
+    stream = buffered_file_stream_alloc(storage);
+    mu_check(buffered_file_stream_open(
+        stream, EXT_PATH("filestream.str"), FSAM_READ_WRITE, FSOM_CREATE_ALWAYS));
+    MU_RUN_TEST_1(stream_large_delete_and_insert_subtest, stream);
+    stream_free(stream);
+
+    furi_record_close(RECORD_STORAGE);
+}
+
+MU_TEST_1(stream_peek_subtest, Stream* stream) {
+    const uint8_t* data = NULL;
+    FuriString* output_data;
+    output_data = furi_string_alloc();
+
+    // peek does not move the position
+    mu_check(stream_rewind(stream));
+    size_t size = stream_peek(stream, &data);
+    mu_check(size > 0);
+    mu_assert_int_eq(stream_test_data[0], data[0]);
+    mu_assert_int_eq(0, stream_tell(stream));
+
+    // consume all data in peeked windows
+    while((size = stream_peek(stream, &data)) > 0) {
+        for(size_t i = 0; i < size; i++) {
+            furi_string_push_back(output_data, data[i]);
+        }
+        mu_check(stream_seek(stream, size, StreamOffsetFromCurrent));
+    }
+    mu_check(stream_eof(stream));
+    mu_assert_int_eq(stream_size(stream), furi_string_size(output_data));
+
+    // data written after the last peek is visible
+    mu_assert_int_eq(1, stream_write_char(stream, '!'));
+    mu_check(stream_seek(stream, -1, StreamOffsetFromCurrent));
+    mu_assert_int_eq(1, stream_peek(stream, &data));
+    mu_assert_int_eq('!', data[0]);
+
+    furi_string_free(output_data);
+}
+
+MU_TEST(stream_peek_test) {
+    Storage* storage = furi_record_open(RECORD_STORAGE);
+
+    // streams with internal buffer
+    Stream* stream = string_stream_alloc();
+    for(size_t i = 0; i < 64; ++i) {
+        mu_check(stream_write_cstring(stream, stream_test_data));
+    }
+    MU_RUN_TEST_1(stream_peek_subtest, stream);
+    stream_free(stream);
+
+    stream = buffered_file_stream_alloc(storage);
+    mu_check(buffered_file_stream_open(
+        stream, EXT_PATH("filestream.str"), FSAM_READ_WRITE, FSOM_CREATE_ALWAYS));
+    for(size_t i = 0; i < 64; ++i) {
+        mu_check(stream_write_cstring(stream, stream_test_data));
+    }
+    MU_RUN_TEST_1(stream_peek_subtest, stream);
+    stream_free(stream);
+
+    stream = buffered_file_stream_alloc_ex(storage, 4096);
+    mu_check(buffered_file_stream_open(
+        stream, EXT_PATH("filestream.str"), FSAM_READ_WRITE, FSOM_OPEN_EXISTING));
+    MU_RUN_TEST_1(stream_peek_subtest, stream);
+    stream_free(stream);
+
+    // file stream has nothing to borrow from
+    const uint8_t* data = NULL;
+    stream = file_stream_alloc(storage);
+    mu_check(
+        file_stream_open(stream, EXT_PATH("filestream.str"), FSAM_READ_WRITE, FSOM_OPEN_EXISTING));
+    mu_assert_int_eq(0, stream_peek(stream, &data));
+    stream_free(stream);
+
+    furi_record_close(RECORD_STORAGE);
+}
+
 MU_TEST_SUITE(stream_suite) {
     MU_RUN_TEST(stream_write_read_save_load_test);
     MU_RUN_TEST(stream_composite_test);
     MU_RUN_TEST(stream_split_test);
     MU_RUN_TEST(stream_buffered_write_after_read_test);
     MU_RUN_TEST(stream_buffered_large_file_test);
+    MU_RUN_TEST(stream_large_delete_and_insert_test);
+    MU_RUN_TEST(stream_peek_test);
 }
 
 int run_minunit_test_stream() {
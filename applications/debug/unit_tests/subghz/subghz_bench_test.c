@@ -0,0 +1,382 @@
+#include <furi.h>
+#include <furi_hal.h>
+#include "../minunit.h"
+#include <lib/subghz/receiver.h>
+#include <lib/subghz/protocols/protocol_items.h>
+#include <lib/subghz/subghz_keystore.h>
+#include <lib/subghz/protocols/keeloq_common.h>
+#include <flipper_format/flipper_format_i.h>
+
+#define TAG "SubGhzBench"
+
+#define SUBGHZ_BENCH_KEYSTORE_PATH EXT_PATH("subghz/assets/keeloq_mfcodes")
+#define SUBGHZ_BENCH_CAME_ATOMO_PATH EXT_PATH("subghz/assets/came_atomo")
+#define SUBGHZ_BENCH_NICE_FLOR_S_PATH EXT_PATH("subghz/assets/nice_flor_s")
+#define SUBGHZ_BENCH_RANDOM_RAW_PATH EXT_PATH("unit_tests/subghz/test_random_raw.sub")
+// Must match TEST_RANDOM_COUNT_PARSE in subghz_test.c: the bench feeds the same capture
+#define SUBGHZ_BENCH_RANDOM_COUNT_PARSE 273
+// DoorHan parcel from doorhan.sub, and a parcel no keystore entry decrypts
+#define SUBGHZ_BENCH_KEELOQ_HIT 0x4850F07233789514
+#define SUBGHZ_BENCH_KEELOQ_MISS 0xDEADBEEF01234567
+// Changes only hop part of the parcel: same serial, new counter
+#define SUBGHZ_BENCH_KEELOQ_NEXT_HOP 0x0100000000000000
+// Same block size as SubGhzWorker delivers at most
+#define SUBGHZ_BENCH_BATCH_SIZE 64
+
+typedef struct {
+    SubGhzProtocolDecoderBase* decoder;
+    uint64_t cycles;
+    uint32_t hits;
+} SubGhzBenchSlot;
+
+typedef struct {
+    SubGhzEnvironment* environment;
+    SubGhzReceiver* receiver;
+    uint64_t receiver_cycles;
+    uint32_t receiver_hits;
+
+    SubGhzReceiver* batch_receiver;
+    uint64_t batch_receiver_cycles;
+    uint32_t batch_receiver_hits;
+    LevelDuration batch[SUBGHZ_BENCH_BATCH_SIZE];
+
+    SubGhzBenchSlot* slots;
+    size_t slots_count;
+
+    int32_t* raw;
+    size_t raw_capacity;
+    size_t pulse_count;
+} SubGhzBench;
+
+static void subghz_bench_receiver_callback(
+    SubGhzReceiver* receiver,
+    SubGhzProtocolDecoderBase* decoder_base,
+    void* context) {
+    UNUSED(decoder_base);
+    SubGhzBench* bench = context;
+    // Same behavior as the random decode test: restart all decoders after a hit
+    subghz_receiver_reset(receiver);
+    bench->receiver_hits++;
+}
+
+static void subghz_bench_batch_receiver_callback(
+    SubGhzReceiver* receiver,
+    SubGhzProtocolDecoderBase* decoder_base,
+    void* context) {
+    UNUSED(decoder_base);
+    SubGhzBench* bench = context;
+    // Within a batch this resets only the decoder that reported
+    subghz_receiver_reset(receiver);
+    bench->batch_receiver_hits++;
+}
+
+static void subghz_bench_slot_callback(SubGhzProtocolDecoderBase* decoder_base, void* context) {
+    SubGhzBenchSlot* slot = context;
+    decoder_base->protocol->decoder->reset(decoder_base);
+    slot->hits++;
+}
+
+static SubGhzBench* subghz_bench_alloc() {
+    SubGhzBench* bench = malloc(sizeof(SubGhzBench));
+
+    bench->environment = subghz_environment_alloc();
+    subghz_environment_load_keystore(bench->environment, SUBGHZ_BENCH_KEYSTORE_PATH);
+    subghz_environment_set_came_atomo_rainbow_table_file_name(
+        bench->environment, SUBGHZ_BENCH_CAME_ATOMO_PATH);
+    subghz_environment_set_nice_flor_s_rainbow_table_file_name(
+        bench->environment, SUBGHZ_BENCH_NICE_FLOR_S_PATH);
+    subghz_environment_set_protocol_registry(
+        bench->environment, (void*)&subghz_protocol_registry);
+
+    bench->receiver = subghz_receiver_alloc_init(bench->environment);
+    subghz_receiver_set_filter(bench->receiver, SubGhzProtocolFlag_Decodable);
+    subghz_receiver_set_rx_callback(bench->receiver, subghz_bench_receiver_callback, bench);
+    bench->receiver_cycles = 0;
+    bench->receiver_hits = 0;
+
+    bench->batch_receiver = subghz_receiver_alloc_init(bench->environment);
+    subghz_receiver_set_filter(bench->batch_receiver, SubGhzProtocolFlag_Decodable);
+    subghz_receiver_set_rx_callback(
+        bench->batch_receiver, subghz_bench_batch_receiver_callback, bench);
+    bench->batch_receiver_cycles = 0;
+    bench->batch_receiver_hits = 0;
+
+    // Standalone decoder per protocol, so every feed can be measured separately
+    size_t registry_count = subghz_protocol_registry_count(&subghz_protocol_registry);
+    bench->slots = malloc(sizeof(SubGhzBenchSlot) * registry_count);
+    bench->slots_count = 0;
+    for(size_t i = 0; i < registry_count; i++) {
+        const SubGhzProtocol* protocol =
+            subghz_protocol_registry_get_by_index(&subghz_protocol_registry, i);
+        if(!protocol->decoder || !protocol->decoder->alloc) continue;
+        if(!(protocol->flag & SubGhzProtocolFlag_Decodable)) continue;
+
+        SubGhzBenchSlot* slot = &bench->slots[bench->slots_count++];
+        slot->decoder = protocol->decoder->alloc(bench->environment);
+        slot->cycles = 0;
+        slot->hits = 0;
+        subghz_protocol_decoder_base_set_decoder_callback(
+            slot->decoder, subghz_bench_slot_callback, slot);
+    }
+
+    bench->raw = NULL;
+    bench->raw_capacity = 0;
+    bench->pulse_count = 0;
+
+    return bench;
+}
+
+static void subghz_bench_free(SubGhzBench* bench) {
+    for(size_t i = 0; i < bench->slots_count; i++) {
+        SubGhzProtocolDecoderBase* decoder = bench->slots[i].decoder;
+        decoder->protocol->decoder->free(decoder);
+    }
+    free(bench->slots);
+    free(bench->raw);
+
+    subghz_receiver_free(bench->receiver);
+    subghz_receiver_free(bench->batch_receiver);
+    subghz_environment_free(bench->environment);
+    free(bench);
+}
+
+static void subghz_bench_feed_chunk(SubGhzBench* bench, size_t count) {
+    // Receiver: what the SubGhzWorker thread pays per pulse
+    uint32_t start = DWT->CYCCNT;
+    for(size_t i = 0; i < count; i++) {
+        int32_t value = bench->raw[i];
+        subghz_receiver_decode(bench->receiver, value > 0, (uint32_t)abs(value));
+    }
+    bench->receiver_cycles += DWT->CYCCNT - start;
+
+    // Same pulses in worker sized blocks, conversion is not timed
+    for(size_t offset = 0; offset < count; offset += SUBGHZ_BENCH_BATCH_SIZE) {
+        size_t batch_count = MIN((size_t)SUBGHZ_BENCH_BATCH_SIZE, count - offset);
+        for(size_t i = 0; i < batch_count; i++) {
+            int32_t value = bench->raw[offset + i];
+            bench->batch[i] = level_duration_make(value > 0, (uint32_t)abs(value));
+        }
+        start = DWT->CYCCNT;
+        subghz_receiver_decode_batch(bench->batch_receiver, bench->batch, batch_count);
+        bench->batch_receiver_cycles += DWT->CYCCNT - start;
+    }
+
+    // Standalone decoders: who is responsible for that cost
+    for(size_t slot_index = 0; slot_index < bench->slots_count; slot_index++) {
+        SubGhzBenchSlot* slot = &bench->slots[slot_index];
+        SubGhzDecoderFeed feed = slot->decoder->protocol->decoder->feed;
+
+        start = DWT->CYCCNT;
+        for(size_t i = 0; i < count; i++) {
+            int32_t value = bench->raw[i];
+            feed(slot->decoder, value > 0, (uint32_t)abs(value));
+        }
+        slot->cycles += DWT->CYCCNT - start;
+    }
+
+    bench->pulse_count += count;
+}
+
+static bool subghz_bench_replay_raw(SubGhzBench* bench, const char* path) {
+    Storage* storage = furi_record_open(RECORD_STORAGE);
+    FlipperFormat* flipper_format = flipper_format_file_alloc(storage);
+    FuriString* temp_str = furi_string_alloc();
+    uint32_t temp_data32 = 0;
+    bool result = false;
+
+    do {
+        if(!flipper_format_file_open_existing(flipper_format, path)) {
+            FURI_LOG_E(TAG, "Error open file %s", path);
+            break;
+        }
+
+        if(!flipper_format_read_header(flipper_format, temp_str, &temp_data32)) {
+            FURI_LOG_E(TAG, "Missing or incorrect header");
+            break;
+        }
+
+        if(strcmp(furi_string_get_cstr(temp_str), SUBGHZ_RAW_FILE_TYPE) != 0 ||
+           temp_data32 != SUBGHZ_RAW_FILE_VERSION) {
+            FURI_LOG_E(TAG, "Type or version mismatch");
+            break;
+        }
+
+        // Capture is too big for RAM: parse one RAW_Data line at a time, time only decoding
+        uint32_t count = 0;
+        bool read_error = false;
+        while(flipper_format_get_value_count(flipper_format, "RAW_Data", &count)) {
+            if(count > bench->raw_capacity) {
+                bench->raw = realloc(bench->raw, count * sizeof(int32_t)); //-V701
+                bench->raw_capacity = count;
+            }
+            if(!flipper_format_read_int32(flipper_format, "RAW_Data", bench->raw, count)) {
+                FURI_LOG_E(TAG, "Unable to read RAW_Data");
+                read_error = true;
+                break;
+            }
+            subghz_bench_feed_chunk(bench, count);
+        }
+
+        result = !read_error && bench->pulse_count;
+    } while(false);
+
+    furi_string_free(temp_str);
+    flipper_format_free(flipper_format);
+    furi_record_close(RECORD_STORAGE);
+
+    return result;
+}
+
+static uint32_t subghz_bench_cycles_to_us(uint64_t cycles) {
+    return cycles / furi_hal_cortex_instructions_per_microsecond();
+}
+
+static void subghz_bench_report(SubGhzBench* bench) {
+    uint32_t receiver_us = subghz_bench_cycles_to_us(bench->receiver_cycles);
+    uint32_t pulses_per_second =
+        receiver_us ? ((uint64_t)bench->pulse_count * 1000000) / receiver_us : 0;
+
+    printf(
+        "\r\nSubGhz decode bench: %zu pulses, %lu us, %lu pulses/s, %lu decoded\r\n",
+        bench->pulse_count,
+        receiver_us,
+        pulses_per_second,
+        bench->receiver_hits);
+    printf(
+        "Batched by %d: %lu us, %lu decoded\r\n",
+        SUBGHZ_BENCH_BATCH_SIZE,
+        subghz_bench_cycles_to_us(bench->batch_receiver_cycles),
+        bench->batch_receiver_hits);
+    printf("%-16s %12s %10s %6s\r\n", "protocol", "us", "cyc/pulse", "hits");
+
+    for(size_t i = 0; i < bench->slots_count; i++) {
+        SubGhzBenchSlot* slot = &bench->slots[i];
+        printf(
+            "%-16s %12lu %10lu %6lu\r\n",
+            slot->decoder->protocol->name,
+            subghz_bench_cycles_to_us(slot->cycles),
+            (uint32_t)(slot->cycles / bench->pulse_count),
+            slot->hits);
+    }
+}
+
+/** Time manufacture search for one parcel, as done by get_string */
+static uint32_t subghz_bench_keeloq_lookup(
+    SubGhzProtocolDecoderBase* decoder,
+    uint64_t data,
+    FuriString* output) {
+    FlipperFormat* flipper_format = flipper_format_string_alloc();
+    uint32_t data_count_bit = 64;
+    uint8_t key_data[sizeof(uint64_t)] = {0};
+    for(size_t i = 0; i < sizeof(uint64_t); i++) {
+        key_data[sizeof(uint64_t) - i - 1] = (data >> (i * 8)) & 0xFF;
+    }
+    flipper_format_write_uint32(flipper_format, "Bit", &data_count_bit, 1);
+    flipper_format_write_hex(flipper_format, "Key", key_data, sizeof(uint64_t));
+    decoder->protocol->decoder->deserialize(decoder, flipper_format);
+    flipper_format_free(flipper_format);
+
+    furi_string_reset(output);
+    uint32_t start = DWT->CYCCNT;
+    subghz_protocol_decoder_base_get_string(decoder, output);
+    return subghz_bench_cycles_to_us(DWT->CYCCNT - start);
+}
+
+MU_TEST(subghz_bench_keeloq_search_test) {
+    SubGhzEnvironment* environment = subghz_environment_alloc();
+    subghz_environment_load_keystore(environment, SUBGHZ_BENCH_KEYSTORE_PATH);
+    const SubGhzProtocol* protocol =
+        subghz_protocol_registry_get_by_name(&subghz_protocol_registry, "KeeLoq");
+    SubGhzProtocolDecoderBase* decoder = protocol->decoder->alloc(environment);
+    FuriString* output = furi_string_alloc();
+
+    SubGhzKeystore* keystore = subghz_environment_get_keystore(environment);
+    size_t keystore_size = SubGhzKeyArray_size(*subghz_keystore_get_data(keystore));
+    uint32_t miss_cold_us = subghz_bench_keeloq_lookup(decoder, SUBGHZ_BENCH_KEELOQ_MISS, output);
+    uint32_t miss_repeat_us =
+        subghz_bench_keeloq_lookup(decoder, SUBGHZ_BENCH_KEELOQ_MISS, output);
+    uint32_t miss_next_us = subghz_bench_keeloq_lookup(
+        decoder, SUBGHZ_BENCH_KEELOQ_MISS ^ SUBGHZ_BENCH_KEELOQ_NEXT_HOP, output);
+    uint32_t hit_us = subghz_bench_keeloq_lookup(decoder, SUBGHZ_BENCH_KEELOQ_HIT, output);
+    bool hit_found = furi_string_search_str(output, "DoorHan") != FURI_STRING_FAILURE;
+
+    printf(
+        "\r\nKeeLoq search, %zu keys: miss %lu us, same parcel %lu us, "
+        "next hop %lu us, hit %lu us\r\n",
+        keystore_size,
+        miss_cold_us,
+        miss_repeat_us,
+        miss_next_us,
+        hit_us);
+
+    furi_string_free(output);
+    protocol->decoder->free(decoder);
+    subghz_environment_free(environment);
+
+    mu_assert(keystore_size, "Keystore is empty\r\n");
+    mu_assert(hit_found, "DoorHan manufacture not found\r\n");
+}
+
+MU_TEST(subghz_bench_keeloq_cipher_test) {
+    uint64_t keys[KEELOQ_MULTI_KEY_COUNT];
+    uint32_t single[KEELOQ_MULTI_KEY_COUNT];
+    uint32_t multi[KEELOQ_MULTI_KEY_COUNT];
+    uint32_t data = furi_hal_random_get();
+    for(size_t i = 0; i < KEELOQ_MULTI_KEY_COUNT; i++) {
+        keys[i] = ((uint64_t)furi_hal_random_get() << 32) | furi_hal_random_get();
+    }
+
+    uint32_t start = DWT->CYCCNT;
+    for(size_t i = 0; i < KEELOQ_MULTI_KEY_COUNT; i++) {
+        single[i] = subghz_protocol_keeloq_common_decrypt(data, keys[i]);
+    }
+    uint32_t single_cycles = DWT->CYCCNT - start;
+
+    start = DWT->CYCCNT;
+    subghz_protocol_keeloq_common_decrypt_multi(data, keys, KEELOQ_MULTI_KEY_COUNT, multi);
+    uint32_t multi_cycles = DWT->CYCCNT - start;
+
+    printf(
+        "\r\nKeeLoq decrypt, %d keys: single %lu cyc/key, multi %lu cyc/key\r\n",
+        KEELOQ_MULTI_KEY_COUNT,
+        single_cycles / KEELOQ_MULTI_KEY_COUNT,
+        multi_cycles / KEELOQ_MULTI_KEY_COUNT);
+
+    for(size_t i = 0; i < KEELOQ_MULTI_KEY_COUNT; i++) {
+        mu_assert_int_eq(single[i], multi[i]);
+        mu_assert_int_eq(data, subghz_protocol_keeloq_common_encrypt(single[i], keys[i]));
+    }
+}
+
+MU_TEST(subghz_bench_random_raw_test) {
+    SubGhzBench* bench = subghz_bench_alloc();
+
+    bool replayed = subghz_bench_replay_raw(bench, SUBGHZ_BENCH_RANDOM_RAW_PATH);
+    if(replayed) {
+        subghz_bench_report(bench);
+    }
+
+    uint32_t receiver_hits = bench->receiver_hits;
+    uint32_t batch_receiver_hits = bench->batch_receiver_hits;
+    uint32_t slot_hits = 0;
+    for(size_t i = 0; i < bench->slots_count; i++) {
+        slot_hits += bench->slots[i].hits;
+    }
+    subghz_bench_free(bench);
+
+    mu_assert(replayed, "Bench replay error\r\n");
+    mu_assert_int_eq(SUBGHZ_BENCH_RANDOM_COUNT_PARSE, receiver_hits);
+    // Batched decoders are independent: exactly what standalone per-pulse feeds decode
+    mu_assert_int_eq(slot_hits, batch_receiver_hits);
+}
+
+MU_TEST_SUITE(subghz_bench) {
+    MU_RUN_TEST(subghz_bench_random_raw_test);
+    MU_RUN_TEST(subghz_bench_keeloq_cipher_test);
+    MU_RUN_TEST(subghz_bench_keeloq_search_test);
+}
+
+int run_minunit_test_subghz_bench() {
+    MU_RUN_SUITE(subghz_bench);
+    return MU_EXIT_CODE;
+}
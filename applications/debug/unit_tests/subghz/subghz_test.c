@@ -5,6 +5,7 @@
 #include <lib/subghz/transmitter.h>
 #include <lib/subghz/subghz_keystore.h>
 #include <lib/subghz/subghz_file_encoder_worker.h>
+#include <lib/subghz/subghz_worker.h>
 #include <lib/subghz/protocols/protocol_items.h>
 #include <flipper_format/flipper_format_i.h>
 
@@ -12,6 +13,7 @@
 #define KEYSTORE_DIR_NAME EXT_PATH("subghz/assets/keeloq_mfcodes")
 #define CAME_ATOMO_DIR_NAME EXT_PATH("subghz/assets/came_atomo")
 #define NICE_FLOR_S_DIR_NAME EXT_PATH("subghz/assets/nice_flor_s")
+#define KEYSTORE_BINARY_TEST_PATH EXT_PATH("unit_tests/subghz/keystore_test.bin")
 #define TEST_RANDOM_DIR_NAME EXT_PATH("unit_tests/subghz/test_random_raw.sub")
 #define TEST_RANDOM_COUNT_PARSE 273
 #define TEST_TIMEOUT 10000
@@ -209,6 +211,63 @@ MU_TEST(subghz_keystore_test) {
         "Test keystore error");
 }
 
+MU_TEST(subghz_keystore_binary_test) {
+    SubGhzKeystore* keystore = subghz_keystore_alloc();
+    SubGhzKeystore* binary_keystore = subghz_keystore_alloc();
+    SubGhzKeystoreBinary* binary = subghz_keystore_binary_alloc();
+    FuriString* name = furi_string_alloc();
+    uint32_t iv_data[4] = {0x01234567, 0x89ABCDEF, 0xFEDCBA98, 0x76543210};
+
+    mu_assert(subghz_keystore_load(keystore, KEYSTORE_DIR_NAME), "Test keystore error");
+    mu_assert(
+        subghz_keystore_save_binary(keystore, KEYSTORE_BINARY_TEST_PATH, (uint8_t*)iv_data),
+        "Save binary keystore error");
+
+    // Loaded binary keystore is the same keystore
+    mu_assert(
+        subghz_keystore_load(binary_keystore, KEYSTORE_BINARY_TEST_PATH),
+        "Load binary keystore error");
+    SubGhzKeyArray_t* keys = subghz_keystore_get_data(keystore);
+    SubGhzKeyArray_t* binary_keys = subghz_keystore_get_data(binary_keystore);
+    size_t keys_count = SubGhzKeyArray_size(*keys);
+    mu_assert_int_eq(keys_count, SubGhzKeyArray_size(*binary_keys));
+    for(size_t i = 0; i < keys_count; i++) {
+        SubGhzKey* key = SubGhzKeyArray_get(*keys, i);
+        SubGhzKey* binary_key = SubGhzKeyArray_get(*binary_keys, i);
+        mu_assert(key->key == binary_key->key, "Binary keystore key mismatch");
+        mu_assert_int_eq(key->type, binary_key->type);
+        mu_assert_string_eq(key->name, binary_key->name);
+    }
+
+    // Random access finds the first record with the key, without loading it
+    mu_assert(
+        subghz_keystore_binary_open(binary, KEYSTORE_BINARY_TEST_PATH),
+        "Open binary keystore error");
+    mu_assert_int_eq(keys_count, subghz_keystore_binary_get_count(binary));
+    for(size_t i = 0; i < keys_count; i += 16) {
+        SubGhzKey* key = SubGhzKeyArray_get(*keys, i);
+        size_t first = 0;
+        while(SubGhzKeyArray_get(*keys, first)->key != key->key) first++;
+
+        SubGhzKeystoreRecord record;
+        mu_assert(subghz_keystore_binary_find(binary, key->key, &record), "Key not found");
+        mu_assert_int_eq(SubGhzKeyArray_get(*keys, first)->type, record.type);
+        mu_assert(subghz_keystore_binary_get_name(binary, &record, name), "Name read error");
+        mu_assert_string_eq(SubGhzKeyArray_get(*keys, first)->name, furi_string_get_cstr(name));
+    }
+    SubGhzKeystoreRecord record;
+    mu_assert(!subghz_keystore_binary_find(binary, 0, &record), "Found missing key");
+
+    subghz_keystore_binary_free(binary);
+    furi_string_free(name);
+    subghz_keystore_free(binary_keystore);
+    subghz_keystore_free(keystore);
+
+    Storage* storage = furi_record_open(RECORD_STORAGE);
+    storage_simply_remove(storage, KEYSTORE_BINARY_TEST_PATH);
+    furi_record_close(RECORD_STORAGE);
+}
+
 typedef enum {
     SubGhzHalAsyncTxTestTypeNormal,
     SubGhzHalAsyncTxTestTypeInvalidStart,
@@ -355,6 +414,141 @@ MU_TEST(subghz_hal_async_tx_test) {
         "Test furi_hal_async_tx reset end");
 }
 
+// Feed pulses between worker stream reads, far below the stream buffer size
+#define SUBGHZ_WORKER_TEST_FEED_BLOCK 256
+#define SUBGHZ_WORKER_TEST_PAIRS_MAX 16
+
+typedef struct {
+    LevelDuration pairs[SUBGHZ_WORKER_TEST_PAIRS_MAX];
+    size_t count;
+} SubGhzWorkerTest;
+
+static void subghz_worker_test_pair_callback(void* context, bool level, uint32_t duration) {
+    SubGhzWorkerTest* test = context;
+    if(test->count < SUBGHZ_WORKER_TEST_PAIRS_MAX) {
+        test->pairs[test->count++] = level_duration_make(level, duration);
+    }
+}
+
+static void subghz_worker_test_pair_batch_callback(
+    void* context,
+    const LevelDuration* level_duration,
+    size_t count) {
+    SubGhzWorkerTest* test = context;
+    for(size_t i = 0; i < count && test->count < SUBGHZ_WORKER_TEST_PAIRS_MAX; i++) {
+        test->pairs[test->count++] = level_duration[i];
+    }
+}
+
+static void subghz_worker_test_filter(bool batch) {
+    // Glitch shorter than filter duration is merged into the surrounding low pulses
+    const LevelDuration input[] = {
+        level_duration_make(false, 200),
+        level_duration_make(true, 500),
+        level_duration_make(false, 1000),
+        level_duration_make(true, 10),
+        level_duration_make(false, 1000),
+        level_duration_make(true, 300),
+        level_duration_make(false, 800),
+        level_duration_make(true, 100),
+    };
+    // Last pair stays pending in the filter until the level changes again
+    const LevelDuration expected[] = {
+        level_duration_make(false, 200),
+        level_duration_make(true, 500),
+        level_duration_make(false, 2010),
+        level_duration_make(true, 300),
+        level_duration_make(false, 800),
+    };
+
+    SubGhzWorkerTest test = {.count = 0};
+    SubGhzWorker* worker = subghz_worker_alloc();
+    subghz_worker_set_context(worker, &test);
+    if(batch) {
+        subghz_worker_set_pair_batch_callback(worker, subghz_worker_test_pair_batch_callback);
+    } else {
+        subghz_worker_set_pair_callback(worker, subghz_worker_test_pair_callback);
+    }
+    subghz_worker_start(worker);
+    for(size_t i = 0; i < COUNT_OF(input); i++) {
+        subghz_worker_rx_callback(
+            level_duration_get_level(input[i]), level_duration_get_duration(input[i]), worker);
+    }
+    furi_delay_ms(50);
+    subghz_worker_stop(worker);
+    subghz_worker_free(worker);
+
+    mu_assert_int_eq(COUNT_OF(expected), test.count);
+    for(size_t i = 0; i < COUNT_OF(expected); i++) {
+        mu_check(!level_duration_is_reset(test.pairs[i]));
+        mu_assert_int_eq(
+            level_duration_get_level(expected[i]), level_duration_get_level(test.pairs[i]));
+        mu_assert_int_eq(
+            level_duration_get_duration(expected[i]), level_duration_get_duration(test.pairs[i]));
+    }
+}
+
+/** Feed capture through SubGhzWorker with its filter on, decode in batches like the apps */
+static bool subghz_worker_decode_test(const char* path) {
+    subghz_test_decoder_count = 0;
+    subghz_receiver_reset(receiver_handler);
+
+    SubGhzWorker* worker = subghz_worker_alloc();
+    subghz_worker_set_overrun_callback(
+        worker, (SubGhzWorkerOverrunCallback)subghz_receiver_reset);
+    subghz_worker_set_pair_batch_callback(
+        worker, (SubGhzWorkerPairBatchCallback)subghz_receiver_decode_batch);
+    subghz_worker_set_context(worker, receiver_handler);
+    subghz_worker_start(worker);
+
+    file_worker_encoder_handler = subghz_file_encoder_worker_alloc();
+    if(subghz_file_encoder_worker_start(file_worker_encoder_handler, path)) {
+        // the worker needs a file in order to open and read part of the file
+        furi_delay_ms(100);
+
+        uint32_t test_start = furi_get_tick();
+        size_t fed = 0;
+        LevelDuration level_duration;
+        while(furi_get_tick() - test_start < TEST_TIMEOUT) {
+            level_duration =
+                subghz_file_encoder_worker_get_level_duration(file_worker_encoder_handler);
+            if(level_duration_is_reset(level_duration)) break;
+            if(level_duration_is_wait(level_duration)) {
+                // Storage is slower than the feed, let the file worker catch up
+                furi_delay_ms(1);
+                continue;
+            }
+            subghz_worker_rx_callback(
+                level_duration_get_level(level_duration),
+                level_duration_get_duration(level_duration),
+                worker);
+            if(++fed % SUBGHZ_WORKER_TEST_FEED_BLOCK == 0) furi_delay_ms(1);
+        }
+        furi_delay_ms(50);
+    }
+    if(subghz_file_encoder_worker_is_running(file_worker_encoder_handler)) {
+        subghz_file_encoder_worker_stop(file_worker_encoder_handler);
+    }
+    subghz_file_encoder_worker_free(file_worker_encoder_handler);
+
+    subghz_worker_stop(worker);
+    subghz_worker_free(worker);
+
+    FURI_LOG_T(TAG, "\r\n Worker count parse \033[0;33m%d\033[0m ", subghz_test_decoder_count);
+    return subghz_test_decoder_count ? true : false;
+}
+
+MU_TEST(subghz_worker_filter_test) {
+    subghz_worker_test_filter(false);
+    subghz_worker_test_filter(true);
+}
+
+MU_TEST(subghz_worker_decode_princeton_test) {
+    mu_assert(
+        subghz_worker_decode_test(EXT_PATH("unit_tests/subghz/princeton_raw.sub")),
+        "Test worker decoder " SUBGHZ_PROTOCOL_PRINCETON_NAME " error\r\n");
+}
+
 //test decoders
 MU_TEST(subghz_decoder_came_atomo_test) {
     mu_assert(
@@ -750,8 +944,11 @@ MU_TEST(subghz_random_test) {
 MU_TEST_SUITE(subghz) {
     subghz_test_init();
     MU_RUN_TEST(subghz_keystore_test);
+    MU_RUN_TEST(subghz_keystore_binary_test);
 
     MU_RUN_TEST(subghz_hal_async_tx_test);
+    MU_RUN_TEST(subghz_worker_filter_test);
+    MU_RUN_TEST(subghz_worker_decode_princeton_test);
 
     MU_RUN_TEST(subghz_decoder_came_atomo_test);
     MU_RUN_TEST(subghz_decoder_came_test);
@@ -19,6 +19,7 @@ int run_minunit_test_flipper_format_string();
 int run_minunit_test_stream();
 int run_minunit_test_storage();
 int run_minunit_test_subghz();
+int run_minunit_test_subghz_bench();
 int run_minunit_test_dirwalk();
 int run_minunit_test_power();
 int run_minunit_test_protocol_dict();
@@ -47,6 +48,7 @@ const UnitTest unit_tests[] = {
     {.name = "flipper_format_string", .entry = run_minunit_test_flipper_format_string},
     {.name = "rpc", .entry = run_minunit_test_rpc},
     {.name = "subghz", .entry = run_minunit_test_subghz},
+    {.name = "subghz_bench", .entry = run_minunit_test_subghz_bench},
     {.name = "infrared", .entry = run_minunit_test_infrared},
     {.name = "nfc", .entry = run_minunit_test_nfc},
     {.name = "power", .entry = run_minunit_test_power},
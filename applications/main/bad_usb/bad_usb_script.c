@@ -10,7 +10,7 @@
 
 #define TAG "BadUSB"
 #define WORKER_TAG TAG "Worker"
-#define FILE_BUFFER_LEN 16
+#define FILE_BUFFER_LEN 256
 
 #define SCRIPT_STATE_ERROR (-1)
 #define SCRIPT_STATE_END (-2)
@@ -30,8 +30,8 @@ struct BadUsbScript {
     uint32_t defdelay;
     FuriThread* thread;
     uint8_t file_buf[FILE_BUFFER_LEN + 1];
-    uint8_t buf_start;
-    uint8_t buf_len;
+    uint16_t buf_start;
+    uint16_t buf_len;
     bool file_end;
     FuriString* line;
 
@@ -362,7 +362,7 @@ static bool ducky_set_usb_id(BadUsbScript* bad_usb, const char* line) {
 }
 
 static bool ducky_script_preload(BadUsbScript* bad_usb, File* script_file) {
-    uint8_t ret = 0;
+    uint16_t ret = 0;
     uint32_t line_len = 0;
 
     furi_string_reset(bad_usb->line);
@@ -441,7 +441,7 @@ static int32_t ducky_script_execute_next(BadUsbScript* bad_usb, File* script_fil
             bad_usb->buf_start = 0;
             if(bad_usb->buf_len == 0) return SCRIPT_STATE_END;
         }
-        for(uint8_t i = bad_usb->buf_start; i < (bad_usb->buf_start + bad_usb->buf_len); i++) {
+        for(uint16_t i = bad_usb->buf_start; i < (bad_usb->buf_start + bad_usb->buf_len); i++) {
             if(bad_usb->file_buf[i] == '\n' && furi_string_size(bad_usb->line) > 0) {
                 bad_usb->st.line_cur++;
                 bad_usb->buf_len = bad_usb->buf_len + bad_usb->buf_start - (i + 1);
@@ -2,13 +2,84 @@
 
 #include <stdlib.h>
 #include <m-dict.h>
+#include <m-array.h>
 #include <flipper_format/flipper_format.h>
+#include <toolbox/stream/file_stream.h>
+#include <toolbox/varint.h>
+#include <toolbox/crc32_calc.h>
+#include <infrared_worker.h>
 
 #include "infrared_signal.h"
 
+#define TAG "InfraredBruteForce"
+
+/* Compiled database is stored next to the source one: foo.ir -> foo.irdb */
+#define INFRARED_BRUTE_FORCE_DB_SUFFIX "db"
+#define INFRARED_BRUTE_FORCE_DB_MAGIC (0x42445249UL) /* "IRDB" */
+#define INFRARED_BRUTE_FORCE_DB_VERSION (2UL)
+#define INFRARED_BRUTE_FORCE_DB_VARINT_SIZE_MAX (5U)
+
+/*
+ * Compiled database layout, all values are little endian:
+ * - InfraredBruteForceDbHeader
+ * - signals in source file order, each one is InfraredBruteForceDbSignalType byte and
+ *   InfraredBruteForceDbMessage or InfraredBruteForceDbRaw with varint packed timings
+ * - group_count InfraredBruteForceDbGroup entries, each one followed by its name
+ * - signal_count offsets of signals, grouped by name
+ */
+typedef struct {
+    uint32_t magic;
+    uint32_t version;
+    uint32_t source_size;
+    uint32_t source_crc;
+    uint32_t group_count;
+    uint32_t groups_offset;
+    uint32_t signal_count;
+    uint32_t offsets_offset;
+} InfraredBruteForceDbHeader;
+
+typedef enum {
+    InfraredBruteForceDbSignalTypeMessage,
+    InfraredBruteForceDbSignalTypeRaw,
+} InfraredBruteForceDbSignalType;
+
+typedef struct {
+    uint8_t protocol;
+    uint32_t address;
+    uint32_t command;
+} __attribute__((packed)) InfraredBruteForceDbMessage;
+
+typedef struct {
+    uint32_t frequency;
+    float duty_cycle;
+    uint16_t timings_size;
+    uint16_t data_size;
+} __attribute__((packed)) InfraredBruteForceDbRaw;
+
+typedef struct {
+    uint32_t first;
+    uint32_t count;
+    uint8_t name_size;
+} __attribute__((packed)) InfraredBruteForceDbGroup;
+
+typedef struct {
+    uint32_t group;
+    uint32_t offset;
+} InfraredBruteForceDbEntry;
+
+ARRAY_DEF(InfraredBruteForceDbEntryArray, InfraredBruteForceDbEntry, M_POD_OPLIST);
+ARRAY_DEF(InfraredBruteForceDbUintArray, uint32_t, M_DEFAULT_OPLIST);
+DICT_DEF2(
+    InfraredBruteForceDbGroupDict,
+    FuriString*,
+    FURI_STRING_OPLIST,
+    uint32_t,
+    M_DEFAULT_OPLIST);
+
 typedef struct {
     uint32_t index;
     uint32_t count;
+    uint32_t first;
 } InfraredBruteForceRecord;
 
 DICT_DEF2(
@@ -19,17 +90,26 @@ DICT_DEF2(
     M_POD_OPLIST);
 
 struct InfraredBruteForce {
+    Stream* db;
     FlipperFormat* ff;
+    bool use_db;
     const char* db_filename;
     FuriString* current_record_name;
     InfraredSignal* current_signal;
     InfraredBruteForceRecordDict_t records;
+    uint32_t offsets_offset;
+    uint32_t current_first;
+    uint32_t current_count;
+    uint32_t current_position;
     bool is_started;
 };
 
 InfraredBruteForce* infrared_brute_force_alloc() {
     InfraredBruteForce* brute_force = malloc(sizeof(InfraredBruteForce));
+    brute_force->db = NULL;
     brute_force->ff = NULL;
+    brute_force->use_db = false;
+    brute_force->offsets_offset = 0;
     brute_force->db_filename = NULL;
     brute_force->current_signal = NULL;
     brute_force->is_started = false;
@@ -50,15 +130,333 @@ void infrared_brute_force_set_db_filename(InfraredBruteForce* brute_force, const
     brute_force->db_filename = db_filename;
 }
 
-bool infrared_brute_force_calculate_messages(InfraredBruteForce* brute_force) {
-    furi_assert(!brute_force->is_started);
-    furi_assert(brute_force->db_filename);
+static void infrared_brute_force_db_get_path(InfraredBruteForce* brute_force, FuriString* path) {
+    furi_string_printf(path, "%s" INFRARED_BRUTE_FORCE_DB_SUFFIX, brute_force->db_filename);
+}
+
+static bool infrared_brute_force_db_write_signal(Stream* db, InfraredSignal* signal) {
+    bool success = false;
+
+    if(infrared_signal_is_raw(signal)) {
+        const InfraredRawSignal* raw = infrared_signal_get_raw_signal(signal);
+        uint8_t* data = malloc(raw->timings_size * INFRARED_BRUTE_FORCE_DB_VARINT_SIZE_MAX);
+
+        // Most of timings fit in 2 bytes
+        size_t data_size = 0;
+        for(size_t i = 0; i < raw->timings_size; ++i) {
+            data_size += varint_uint32_pack(raw->timings[i], &data[data_size]);
+        }
+
+        const uint8_t type = InfraredBruteForceDbSignalTypeRaw;
+        const InfraredBruteForceDbRaw header = {
+            .frequency = raw->frequency,
+            .duty_cycle = raw->duty_cycle,
+            .timings_size = raw->timings_size,
+            .data_size = data_size,
+        };
+        success = (stream_write(db, &type, sizeof(type)) == sizeof(type)) &&
+                  (stream_write(db, (const uint8_t*)&header, sizeof(header)) == sizeof(header)) &&
+                  (stream_write(db, data, data_size) == data_size);
+        free(data);
+    } else {
+        const InfraredMessage* message = infrared_signal_get_message(signal);
+        const uint8_t type = InfraredBruteForceDbSignalTypeMessage;
+        const InfraredBruteForceDbMessage packed = {
+            .protocol = message->protocol,
+            .address = message->address,
+            .command = message->command,
+        };
+        success = (stream_write(db, &type, sizeof(type)) == sizeof(type)) &&
+                  (stream_write(db, (const uint8_t*)&packed, sizeof(packed)) == sizeof(packed));
+    }
+
+    return success;
+}
+
+static bool infrared_brute_force_db_read_signal(Stream* db, InfraredSignal* signal) {
+    bool success = false;
+    uint8_t type;
+
+    if(stream_read(db, &type, sizeof(type)) != sizeof(type)) return false;
+
+    if(type == InfraredBruteForceDbSignalTypeMessage) {
+        InfraredBruteForceDbMessage packed;
+        if(stream_read(db, (uint8_t*)&packed, sizeof(packed)) == sizeof(packed)) {
+            const InfraredMessage message = {
+                .protocol = packed.protocol,
+                .address = packed.address,
+                .command = packed.command,
+                .repeat = false,
+            };
+            infrared_signal_set_message(signal, &message);
+            success = true;
+        }
+    } else if(type == InfraredBruteForceDbSignalTypeRaw) {
+        InfraredBruteForceDbRaw header;
+        if(stream_read(db, (uint8_t*)&header, sizeof(header)) != sizeof(header)) return false;
+        if(header.timings_size > MAX_TIMINGS_AMOUNT) return false;
+
+        uint8_t* data = malloc(header.data_size);
+        uint32_t* timings = malloc(header.timings_size * sizeof(uint32_t));
+
+        if(stream_read(db, data, header.data_size) == header.data_size) {
+            size_t timings_size = 0;
+            size_t data_read = 0;
+            while(data_read < header.data_size && timings_size < header.timings_size) {
+                data_read += varint_uint32_unpack(
+                    &timings[timings_size++], &data[data_read], header.data_size - data_read);
+            }
+
+            success = (timings_size == header.timings_size) && (data_read == header.data_size);
+            if(success) {
+                infrared_signal_set_raw_signal(
+                    signal, timings, timings_size, header.frequency, header.duty_cycle);
+            }
+        }
+
+        free(timings);
+        free(data);
+    }
+
+    return success;
+}
+
+static bool infrared_brute_force_db_compile(
+    Storage* storage,
+    const char* source_path,
+    const char* db_path,
+    const InfraredBruteForceDbHeader* source) {
+    FlipperFormat* ff = flipper_format_buffered_file_alloc(storage);
+    Stream* db = file_stream_alloc(storage);
+    FuriString* name = furi_string_alloc();
+    InfraredSignal* signal = infrared_signal_alloc();
+
+    InfraredBruteForceDbEntryArray_t entries;
+    InfraredBruteForceDbUintArray_t counts;
+    InfraredBruteForceDbGroupDict_t groups;
+    InfraredBruteForceDbEntryArray_init(entries);
+    InfraredBruteForceDbUintArray_init(counts);
+    InfraredBruteForceDbGroupDict_init(groups);
+
+    InfraredBruteForceDbHeader header = *source;
+    bool is_created = false;
+    bool success = false;
+
+    // Skip raw signal data when looking for names
+    flipper_format_set_key_index(ff, true);
+
+    do {
+        if(!flipper_format_buffered_file_open_existing(ff, source_path)) break;
+        if(!file_stream_open(db, db_path, FSAM_READ_WRITE, FSOM_CREATE_ALWAYS)) break;
+        is_created = true;
+        if(stream_write(db, (const uint8_t*)&header, sizeof(header)) != sizeof(header)) break;
+
+        // Signals are stored in source order, offset table groups them by name
+        bool write_error = false;
+        while(flipper_format_read_string(ff, "name", name)) {
+            if(!infrared_signal_read_body(signal, ff)) continue;
+
+            uint32_t* group = InfraredBruteForceDbGroupDict_get(groups, name);
+            if(!group) {
+                if(furi_string_size(name) > UINT8_MAX) continue;
+                const uint32_t group_index = InfraredBruteForceDbUintArray_size(counts);
+                InfraredBruteForceDbGroupDict_set_at(groups, name, group_index);
+                InfraredBruteForceDbUintArray_push_back(counts, 0);
+                group = InfraredBruteForceDbGroupDict_get(groups, name);
+            }
+
+            InfraredBruteForceDbEntry* entry = InfraredBruteForceDbEntryArray_push_new(entries);
+            entry->group = *group;
+            entry->offset = stream_tell(db);
+            ++(*InfraredBruteForceDbUintArray_get(counts, *group));
+
+            if(!infrared_brute_force_db_write_signal(db, signal)) {
+                write_error = true;
+                break;
+            }
+        }
+        if(write_error) break;
+
+        // Counts become indexes of group first entries
+        uint32_t first = 0;
+        for(size_t i = 0; i < InfraredBruteForceDbUintArray_size(counts); ++i) {
+            uint32_t* count = InfraredBruteForceDbUintArray_get(counts, i);
+            const uint32_t group_count = *count;
+            *count = first;
+            first += group_count;
+        }
+
+        header.group_count = InfraredBruteForceDbUintArray_size(counts);
+        header.groups_offset = stream_tell(db);
+
+        InfraredBruteForceDbGroupDict_it_t it;
+        for(InfraredBruteForceDbGroupDict_it(it, groups); !InfraredBruteForceDbGroupDict_end_p(it);
+            InfraredBruteForceDbGroupDict_next(it)) {
+            const InfraredBruteForceDbGroupDict_itref_t* item =
+                InfraredBruteForceDbGroupDict_cref(it);
+            const uint32_t group_first = *InfraredBruteForceDbUintArray_get(counts, item->value);
+            const uint32_t group_next =
+                (item->value + 1 < header.group_count) ?
+                    *InfraredBruteForceDbUintArray_get(counts, item->value + 1) :
+                    InfraredBruteForceDbEntryArray_size(entries);
+            const InfraredBruteForceDbGroup group = {
+                .first = group_first,
+                .count = group_next - group_first,
+                .name_size = furi_string_size(item->key),
+            };
+            if(stream_write(db, (const uint8_t*)&group, sizeof(group)) != sizeof(group) ||
+               stream_write_string(db, item->key) != group.name_size) {
+                write_error = true;
+                break;
+            }
+        }
+        if(write_error) break;
+
+        // Counts advance to the next free slot of each group while offsets are placed
+        const size_t signal_count = InfraredBruteForceDbEntryArray_size(entries);
+        uint32_t* offsets = malloc(signal_count * sizeof(uint32_t));
+        for(size_t i = 0; i < signal_count; ++i) {
+            const InfraredBruteForceDbEntry* entry =
+                InfraredBruteForceDbEntryArray_cget(entries, i);
+            uint32_t* slot = InfraredBruteForceDbUintArray_get(counts, entry->group);
+            offsets[(*slot)++] = entry->offset;
+        }
+
+        header.signal_count = signal_count;
+        header.offsets_offset = stream_tell(db);
+        const size_t offsets_size = signal_count * sizeof(uint32_t);
+        write_error = stream_write(db, (const uint8_t*)offsets, offsets_size) != offsets_size;
+        free(offsets);
+        if(write_error) break;
+
+        // Header goes last, so database is valid only if it was written completely
+        header.magic = INFRARED_BRUTE_FORCE_DB_MAGIC;
+        header.version = INFRARED_BRUTE_FORCE_DB_VERSION;
+        if(!stream_rewind(db)) break;
+        if(stream_write(db, (const uint8_t*)&header, sizeof(header)) != sizeof(header)) break;
+
+        success = true;
+    } while(false);
+
+    file_stream_close(db);
+    if(!success) {
+        FURI_LOG_E(TAG, "Failed to compile %s", source_path);
+        // Do not touch whatever occupies the path if it could not be created
+        if(is_created) storage_common_remove(storage, db_path);
+    }
+
+    InfraredBruteForceDbGroupDict_clear(groups);
+    InfraredBruteForceDbUintArray_clear(counts);
+    InfraredBruteForceDbEntryArray_clear(entries);
+    infrared_signal_free(signal);
+    furi_string_free(name);
+    stream_free(db);
+    flipper_format_free(ff);
+
+    return success;
+}
+
+/* Size and CRC of the source file, storage timestamp changes on every write to the card */
+static bool infrared_brute_force_db_get_source(
+    Storage* storage,
+    const char* source_path,
+    InfraredBruteForceDbHeader* source) {
+    File* file = storage_file_alloc(storage);
+    bool success = storage_file_open(file, source_path, FSAM_READ, FSOM_OPEN_EXISTING);
+    if(success) {
+        source->source_size = storage_file_size(file);
+        source->source_crc = crc32_calc_file(file, NULL, NULL);
+    }
+    storage_file_free(file);
+    return success;
+}
+
+/* Open compiled database, build it first if it is missing or does not match the source */
+static bool infrared_brute_force_db_open(
+    InfraredBruteForce* brute_force,
+    Storage* storage,
+    Stream* db,
+    InfraredBruteForceDbHeader* header) {
+    FuriString* db_path = furi_string_alloc();
+    infrared_brute_force_db_get_path(brute_force, db_path);
+
+    InfraredBruteForceDbHeader source = {0};
     bool success = false;
 
+    do {
+        if(!infrared_brute_force_db_get_source(storage, brute_force->db_filename, &source)) break;
+
+        if(file_stream_open(db, furi_string_get_cstr(db_path), FSAM_READ, FSOM_OPEN_EXISTING)) {
+            success = (stream_read(db, (uint8_t*)header, sizeof(*header)) == sizeof(*header)) &&
+                      (header->magic == INFRARED_BRUTE_FORCE_DB_MAGIC) &&
+                      (header->version == INFRARED_BRUTE_FORCE_DB_VERSION) &&
+                      (header->source_size == source.source_size) &&
+                      (header->source_crc == source.source_crc);
+            if(success) break;
+        }
+        file_stream_close(db);
+
+        FURI_LOG_I(TAG, "Compiling %s", brute_force->db_filename);
+        if(!infrared_brute_force_db_compile(
+               storage, brute_force->db_filename, furi_string_get_cstr(db_path), &source))
+            break;
+
+        if(!file_stream_open(db, furi_string_get_cstr(db_path), FSAM_READ, FSOM_OPEN_EXISTING))
+            break;
+        success = (stream_read(db, (uint8_t*)header, sizeof(*header)) == sizeof(*header));
+    } while(false);
+
+    furi_string_free(db_path);
+    return success;
+}
+
+static bool infrared_brute_force_db_calculate_messages(InfraredBruteForce* brute_force) {
+    Storage* storage = furi_record_open(RECORD_STORAGE);
+    Stream* db = file_stream_alloc(storage);
+    InfraredBruteForceDbHeader header;
+
+    bool success = infrared_brute_force_db_open(brute_force, storage, db, &header) &&
+                   stream_seek(db, header.groups_offset, StreamOffsetFromStart);
+
+    if(success) {
+        FuriString* group_name = furi_string_alloc();
+        char name[UINT8_MAX];
+
+        for(uint32_t i = 0; i < header.group_count; ++i) {
+            InfraredBruteForceDbGroup group;
+            if(stream_read(db, (uint8_t*)&group, sizeof(group)) != sizeof(group) ||
+               stream_read(db, (uint8_t*)name, group.name_size) != group.name_size) {
+                success = false;
+                break;
+            }
+            furi_string_set_strn(group_name, name, group.name_size);
+
+            InfraredBruteForceRecord* record =
+                InfraredBruteForceRecordDict_get(brute_force->records, group_name);
+            if(record) {
+                record->first = group.first;
+                record->count = group.count;
+            }
+        }
+
+        furi_string_free(group_name);
+        brute_force->offsets_offset = header.offsets_offset;
+    }
+
+    file_stream_close(db);
+    stream_free(db);
+    furi_record_close(RECORD_STORAGE);
+    return success;
+}
+
+/* Count signals in the source file, used when compiled database is not available */
+static bool infrared_brute_force_ff_calculate_messages(InfraredBruteForce* brute_force) {
     Storage* storage = furi_record_open(RECORD_STORAGE);
     FlipperFormat* ff = flipper_format_buffered_file_alloc(storage);
 
-    success = flipper_format_buffered_file_open_existing(ff, brute_force->db_filename);
+    // Skip raw signal data when looking for names
+    flipper_format_set_key_index(ff, true);
+    bool success = flipper_format_buffered_file_open_existing(ff, brute_force->db_filename);
     if(success) {
         FuriString* signal_name;
         signal_name = furi_string_alloc();
@@ -77,6 +475,30 @@ bool infrared_brute_force_calculate_messages(InfraredBruteForce* brute_force) {
     return success;
 }
 
+static void infrared_brute_force_reset_counts(InfraredBruteForce* brute_force) {
+    InfraredBruteForceRecordDict_it_t it;
+    for(InfraredBruteForceRecordDict_it(it, brute_force->records);
+        !InfraredBruteForceRecordDict_end_p(it);
+        InfraredBruteForceRecordDict_next(it)) {
+        InfraredBruteForceRecord* record = &InfraredBruteForceRecordDict_ref(it)->value;
+        record->count = 0;
+        record->first = 0;
+    }
+}
+
+bool infrared_brute_force_calculate_messages(InfraredBruteForce* brute_force) {
+    furi_assert(!brute_force->is_started);
+    furi_assert(brute_force->db_filename);
+
+    infrared_brute_force_reset_counts(brute_force);
+    brute_force->use_db = infrared_brute_force_db_calculate_messages(brute_force);
+    if(brute_force->use_db) return true;
+
+    FURI_LOG_W(TAG, "Compiled database is not available, reading %s", brute_force->db_filename);
+    infrared_brute_force_reset_counts(brute_force);
+    return infrared_brute_force_ff_calculate_messages(brute_force);
+}
+
 bool infrared_brute_force_start(
     InfraredBruteForce* brute_force,
     uint32_t index,
@@ -94,6 +516,9 @@ bool infrared_brute_force_start(
             *record_count = record->value.count;
             if(*record_count) {
                 furi_string_set(brute_force->current_record_name, record->key);
+                brute_force->current_first = record->value.first;
+                brute_force->current_count = record->value.count;
+                brute_force->current_position = 0;
             }
             break;
         }
@@ -101,11 +526,22 @@ bool infrared_brute_force_start(
 
     if(*record_count) {
         Storage* storage = furi_record_open(RECORD_STORAGE);
-        brute_force->ff = flipper_format_buffered_file_alloc(storage);
         brute_force->current_signal = infrared_signal_alloc();
         brute_force->is_started = true;
-        success =
-            flipper_format_buffered_file_open_existing(brute_force->ff, brute_force->db_filename);
+
+        if(brute_force->use_db) {
+            FuriString* db_path = furi_string_alloc();
+            infrared_brute_force_db_get_path(brute_force, db_path);
+            brute_force->db = file_stream_alloc(storage);
+            success = file_stream_open(
+                brute_force->db, furi_string_get_cstr(db_path), FSAM_READ, FSOM_OPEN_EXISTING);
+            furi_string_free(db_path);
+        } else {
+            brute_force->ff = flipper_format_buffered_file_alloc(storage);
+            flipper_format_set_key_index(brute_force->ff, true);
+            success = flipper_format_buffered_file_open_existing(
+                brute_force->ff, brute_force->db_filename);
+        }
         if(!success) infrared_brute_force_stop(brute_force);
     }
     return success;
@@ -119,28 +555,54 @@ void infrared_brute_force_stop(InfraredBruteForce* brute_force) {
     furi_assert(brute_force->is_started);
     furi_string_reset(brute_force->current_record_name);
     infrared_signal_free(brute_force->current_signal);
-    flipper_format_free(brute_force->ff);
+    if(brute_force->db) stream_free(brute_force->db);
+    if(brute_force->ff) flipper_format_free(brute_force->ff);
     brute_force->current_signal = NULL;
+    brute_force->db = NULL;
     brute_force->ff = NULL;
     brute_force->is_started = false;
     furi_record_close(RECORD_STORAGE);
 }
 
-bool infrared_brute_force_send_next(InfraredBruteForce* brute_force) {
+InfraredSignal* infrared_brute_force_read_next(InfraredBruteForce* brute_force) {
     furi_assert(brute_force->is_started);
-    const bool success = infrared_signal_search_and_read(
-        brute_force->current_signal, brute_force->ff, brute_force->current_record_name);
-    if(success) {
-        infrared_signal_transmit(brute_force->current_signal);
+    bool success = false;
+
+    if(brute_force->use_db) {
+        if(brute_force->current_position >= brute_force->current_count) return NULL;
+
+        const uint32_t index = brute_force->current_first + brute_force->current_position;
+        uint32_t offset;
+        success =
+            stream_seek(
+                brute_force->db,
+                brute_force->offsets_offset + index * sizeof(uint32_t),
+                StreamOffsetFromStart) &&
+            (stream_read(brute_force->db, (uint8_t*)&offset, sizeof(offset)) == sizeof(offset)) &&
+            stream_seek(brute_force->db, offset, StreamOffsetFromStart) &&
+            infrared_brute_force_db_read_signal(brute_force->db, brute_force->current_signal);
+        if(success) ++brute_force->current_position;
+    } else {
+        success = infrared_signal_search_and_read(
+            brute_force->current_signal, brute_force->ff, brute_force->current_record_name);
     }
-    return success;
+
+    return success ? brute_force->current_signal : NULL;
+}
+
+bool infrared_brute_force_send_next(InfraredBruteForce* brute_force) {
+    InfraredSignal* signal = infrared_brute_force_read_next(brute_force);
+    if(signal) {
+        infrared_signal_transmit(signal);
+    }
+    return signal != NULL;
 }
 
 void infrared_brute_force_add_record(
     InfraredBruteForce* brute_force,
     uint32_t index,
     const char* name) {
-    InfraredBruteForceRecord value = {.index = index, .count = 0};
+    InfraredBruteForceRecord value = {.index = index, .count = 0, .first = 0};
     FuriString* key;
     key = furi_string_alloc_set(name);
     InfraredBruteForceRecordDict_set_at(brute_force->records, key, value);
@@ -3,6 +3,8 @@
 #include <stdint.h>
 #include <stdbool.h>
 
+#include "infrared_signal.h"
+
 typedef struct InfraredBruteForce InfraredBruteForce;
 
 InfraredBruteForce* infrared_brute_force_alloc();
@@ -16,6 +18,8 @@ bool infrared_brute_force_start(
 bool infrared_brute_force_is_started(InfraredBruteForce* brute_force);
 void infrared_brute_force_stop(InfraredBruteForce* brute_force);
 bool infrared_brute_force_send_next(InfraredBruteForce* brute_force);
+/* Read next signal of the started record without transmitting it, NULL at the end */
+InfraredSignal* infrared_brute_force_read_next(InfraredBruteForce* brute_force);
 void infrared_brute_force_add_record(
     InfraredBruteForce* brute_force,
     uint32_t index,
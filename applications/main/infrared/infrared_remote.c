@@ -4,20 +4,75 @@
 #include <stddef.h>
 #include <stdlib.h>
 #include <m-array.h>
+#include <m-dict.h>
 #include <toolbox/path.h>
 #include <storage/storage.h>
 #include <core/common_defines.h>
 
 #define TAG "InfraredRemote"
 
+#define INFRARED_REMOTE_BUTTON_NONE SIZE_MAX
+
+/* Buttons sharing signal fingerprint, linked through button_signal_next */
+typedef struct {
+    size_t first;
+    size_t last;
+} InfraredButtonSignalChain;
+
 ARRAY_DEF(InfraredButtonArray, InfraredRemoteButton*, M_PTR_OPLIST);
+ARRAY_DEF(InfraredButtonIndexArray, size_t, M_DEFAULT_OPLIST);
+DICT_DEF2(InfraredButtonNameDict, FuriString*, FURI_STRING_OPLIST, size_t, M_DEFAULT_OPLIST);
+DICT_DEF2(
+    InfraredButtonSignalDict,
+    uint32_t,
+    M_DEFAULT_OPLIST,
+    InfraredButtonSignalChain,
+    M_POD_OPLIST);
 
 struct InfraredRemote {
     InfraredButtonArray_t buttons;
+    InfraredButtonNameDict_t button_names;
+    InfraredButtonSignalDict_t button_signals;
+    InfraredButtonIndexArray_t button_signal_next;
     FuriString* name;
     FuriString* path;
 };
 
+/* Only the first button with given name is indexed, all are chained by signal fingerprint */
+static void infrared_remote_index_button(InfraredRemote* remote, size_t index) {
+    InfraredRemoteButton* button = *InfraredButtonArray_get(remote->buttons, index);
+
+    FuriString* name = furi_string_alloc_set(infrared_remote_button_get_name(button));
+    if(!InfraredButtonNameDict_get(remote->button_names, name)) {
+        InfraredButtonNameDict_set_at(remote->button_names, name, index);
+    }
+    furi_string_free(name);
+
+    furi_assert(InfraredButtonIndexArray_size(remote->button_signal_next) == index);
+    InfraredButtonIndexArray_push_back(remote->button_signal_next, INFRARED_REMOTE_BUTTON_NONE);
+
+    const uint32_t fingerprint =
+        infrared_signal_get_fingerprint(infrared_remote_button_get_signal(button));
+    InfraredButtonSignalChain* chain =
+        InfraredButtonSignalDict_get(remote->button_signals, fingerprint);
+    if(chain) {
+        *InfraredButtonIndexArray_get(remote->button_signal_next, chain->last) = index;
+        chain->last = index;
+    } else {
+        const InfraredButtonSignalChain new_chain = {.first = index, .last = index};
+        InfraredButtonSignalDict_set_at(remote->button_signals, fingerprint, new_chain);
+    }
+}
+
+static void infrared_remote_index_buttons(InfraredRemote* remote) {
+    InfraredButtonNameDict_reset(remote->button_names);
+    InfraredButtonSignalDict_reset(remote->button_signals);
+    InfraredButtonIndexArray_reset(remote->button_signal_next);
+    for(size_t i = 0; i < InfraredButtonArray_size(remote->buttons); ++i) {
+        infrared_remote_index_button(remote, i);
+    }
+}
+
 static void infrared_remote_clear_buttons(InfraredRemote* remote) {
     InfraredButtonArray_it_t it;
     for(InfraredButtonArray_it(it, remote->buttons); !InfraredButtonArray_end_p(it);
@@ -25,11 +80,17 @@ static void infrared_remote_clear_buttons(InfraredRemote* remote) {
         infrared_remote_button_free(*InfraredButtonArray_cref(it));
     }
     InfraredButtonArray_reset(remote->buttons);
+    InfraredButtonNameDict_reset(remote->button_names);
+    InfraredButtonSignalDict_reset(remote->button_signals);
+    InfraredButtonIndexArray_reset(remote->button_signal_next);
 }
 
 InfraredRemote* infrared_remote_alloc() {
     InfraredRemote* remote = malloc(sizeof(InfraredRemote));
     InfraredButtonArray_init(remote->buttons);
+    InfraredButtonNameDict_init(remote->button_names);
+    InfraredButtonSignalDict_init(remote->button_signals);
+    InfraredButtonIndexArray_init(remote->button_signal_next);
     remote->name = furi_string_alloc();
     remote->path = furi_string_alloc();
     return remote;
@@ -38,6 +99,9 @@ InfraredRemote* infrared_remote_alloc() {
 void infrared_remote_free(InfraredRemote* remote) {
     infrared_remote_clear_buttons(remote);
     InfraredButtonArray_clear(remote->buttons);
+    InfraredButtonNameDict_clear(remote->button_names);
+    InfraredButtonSignalDict_clear(remote->button_signals);
+    InfraredButtonIndexArray_clear(remote->button_signal_next);
     furi_string_free(remote->path);
     furi_string_free(remote->name);
     free(remote);
@@ -75,9 +139,30 @@ InfraredRemoteButton* infrared_remote_get_button(InfraredRemote* remote, size_t
 }
 
 bool infrared_remote_find_button_by_name(InfraredRemote* remote, const char* name, size_t* index) {
-    for(size_t i = 0; i < InfraredButtonArray_size(remote->buttons); i++) {
+    FuriString* key = furi_string_alloc_set(name);
+    const size_t* found = InfraredButtonNameDict_get(remote->button_names, key);
+    furi_string_free(key);
+
+    if(found) {
+        *index = *found;
+    }
+    return found != NULL;
+}
+
+bool infrared_remote_find_button_by_signal(
+    InfraredRemote* remote,
+    const InfraredSignal* signal,
+    size_t* index) {
+    const uint32_t fingerprint = infrared_signal_get_fingerprint(signal);
+    const InfraredButtonSignalChain* chain =
+        InfraredButtonSignalDict_get(remote->button_signals, fingerprint);
+    if(!chain) return false;
+
+    // Similar signals always share fingerprint, only buttons in the chain can match
+    for(size_t i = chain->first; i != INFRARED_REMOTE_BUTTON_NONE;
+        i = *InfraredButtonIndexArray_get(remote->button_signal_next, i)) {
         InfraredRemoteButton* button = *InfraredButtonArray_get(remote->buttons, i);
-        if(!strcmp(infrared_remote_button_get_name(button), name)) {
+        if(infrared_signal_is_similar(infrared_remote_button_get_signal(button), signal)) {
             *index = i;
             return true;
         }
@@ -90,6 +175,7 @@ bool infrared_remote_add_button(InfraredRemote* remote, const char* name, Infrar
     infrared_remote_button_set_name(button, name);
     infrared_remote_button_set_signal(button, signal);
     InfraredButtonArray_push_back(remote->buttons, button);
+    infrared_remote_index_button(remote, InfraredButtonArray_size(remote->buttons) - 1);
     return infrared_remote_store(remote);
 }
 
@@ -97,6 +183,7 @@ bool infrared_remote_rename_button(InfraredRemote* remote, const char* new_name,
     furi_assert(index < InfraredButtonArray_size(remote->buttons));
     InfraredRemoteButton* button = *InfraredButtonArray_get(remote->buttons, index);
     infrared_remote_button_set_name(button, new_name);
+    infrared_remote_index_buttons(remote);
     return infrared_remote_store(remote);
 }
 
@@ -105,6 +192,7 @@ bool infrared_remote_delete_button(InfraredRemote* remote, size_t index) {
     InfraredRemoteButton* button;
     InfraredButtonArray_pop_at(&button, remote->buttons, index);
     infrared_remote_button_free(button);
+    infrared_remote_index_buttons(remote);
     return infrared_remote_store(remote);
 }
 
@@ -168,6 +256,7 @@ bool infrared_remote_load(InfraredRemote* remote, FuriString* path) {
                 infrared_remote_button_free(button);
             }
         }
+        infrared_remote_index_buttons(remote);
         success = true;
     } while(false);
 
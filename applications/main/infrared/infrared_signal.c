@@ -8,6 +8,12 @@
 
 #define TAG "InfraredSignal"
 
+#define INFRARED_SIGNAL_TIMINGS_CHUNK 64U
+
+#define INFRARED_SIGNAL_FINGERPRINT_SEED (2166136261UL)
+#define INFRARED_SIGNAL_FINGERPRINT_PRIME (16777619UL)
+#define INFRARED_SIGNAL_TOLERANCE_PERCENT (25UL)
+
 struct InfraredSignal {
     bool is_raw;
     union {
@@ -124,29 +130,89 @@ static inline bool infrared_signal_read_message(InfraredSignal* signal, FlipperF
 }
 
 static inline bool infrared_signal_read_raw(InfraredSignal* signal, FlipperFormat* ff) {
-    uint32_t timings_size, frequency;
+    uint32_t frequency;
     float duty_cycle;
 
     bool success = flipper_format_read_uint32(ff, "frequency", &frequency, 1) &&
                    flipper_format_read_float(ff, "duty_cycle", &duty_cycle, 1) &&
-                   flipper_format_get_value_count(ff, "data", &timings_size);
+                   flipper_format_read_array_begin(ff, "data");
 
-    if(!success || timings_size > MAX_TIMINGS_AMOUNT) {
+    if(!success) {
         return false;
     }
 
-    uint32_t* timings = malloc(sizeof(uint32_t) * timings_size);
-    success = flipper_format_read_uint32(ff, "data", timings, timings_size);
+    // Timings are read in one pass, without counting them first
+    size_t timings_capacity = INFRARED_SIGNAL_TIMINGS_CHUNK;
+    size_t timings_size = 0;
+    uint32_t* timings = malloc(sizeof(uint32_t) * timings_capacity);
+
+    while(true) {
+        if(timings_size == timings_capacity) {
+            // One extra timing to detect oversized signals
+            timings_capacity = MIN(timings_capacity * 2, MAX_TIMINGS_AMOUNT + 1);
+            timings = realloc(timings, sizeof(uint32_t) * timings_capacity);
+        }
+
+        uint16_t timings_read = 0;
+        success = flipper_format_read_array_uint32(
+            ff, &timings[timings_size], timings_capacity - timings_size, &timings_read);
+        timings_size += timings_read;
+
+        if(!success || timings_read == 0 || timings_size > MAX_TIMINGS_AMOUNT) break;
+    }
 
-    if(success) {
+    if(success && timings_size <= MAX_TIMINGS_AMOUNT) {
         infrared_signal_set_raw_signal(signal, timings, timings_size, frequency, duty_cycle);
+    } else {
+        success = false;
     }
 
     free(timings);
     return success;
 }
 
-static bool infrared_signal_read_body(InfraredSignal* signal, FlipperFormat* ff) {
+static inline uint32_t
+    infrared_signal_fingerprint_add(uint32_t fingerprint, const void* data, size_t size) {
+    const uint8_t* bytes = data;
+    for(size_t i = 0; i < size; ++i) {
+        fingerprint = (fingerprint ^ bytes[i]) * INFRARED_SIGNAL_FINGERPRINT_PRIME;
+    }
+    return fingerprint;
+}
+
+/* Timing values are left out: any quantization step can be crossed by capture jitter,
+ * while similar raw signals always have the same number of timings */
+static uint32_t infrared_signal_get_raw_fingerprint(const InfraredRawSignal* raw) {
+    const uint32_t timings_size = raw->timings_size;
+    return infrared_signal_fingerprint_add(
+        INFRARED_SIGNAL_FINGERPRINT_SEED, &timings_size, sizeof(uint32_t));
+}
+
+static uint32_t infrared_signal_get_message_fingerprint(const InfraredMessage* message) {
+    const uint32_t protocol = message->protocol;
+    uint32_t fingerprint = INFRARED_SIGNAL_FINGERPRINT_SEED;
+    fingerprint = infrared_signal_fingerprint_add(fingerprint, &protocol, sizeof(uint32_t));
+    fingerprint =
+        infrared_signal_fingerprint_add(fingerprint, &message->address, sizeof(uint32_t));
+    fingerprint =
+        infrared_signal_fingerprint_add(fingerprint, &message->command, sizeof(uint32_t));
+    return fingerprint;
+}
+
+static bool
+    infrared_signal_is_raw_similar(const InfraredRawSignal* a, const InfraredRawSignal* b) {
+    if(a->timings_size != b->timings_size) return false;
+
+    for(size_t i = 0; i < a->timings_size; ++i) {
+        const uint32_t longer = MAX(a->timings[i], b->timings[i]);
+        const uint32_t shorter = MIN(a->timings[i], b->timings[i]);
+        if((longer - shorter) * 100UL > longer * INFRARED_SIGNAL_TOLERANCE_PERCENT) return false;
+    }
+
+    return true;
+}
+
+bool infrared_signal_read_body(InfraredSignal* signal, FlipperFormat* ff) {
     FuriString* tmp = furi_string_alloc();
 
     bool success = false;
@@ -180,7 +246,7 @@ void infrared_signal_free(InfraredSignal* signal) {
     free(signal);
 }
 
-bool infrared_signal_is_raw(InfraredSignal* signal) {
+bool infrared_signal_is_raw(const InfraredSignal* signal) {
     return signal->is_raw;
 }
 
@@ -189,6 +255,25 @@ bool infrared_signal_is_valid(InfraredSignal* signal) {
                             infrared_signal_is_message_valid(&signal->payload.message);
 }
 
+uint32_t infrared_signal_get_fingerprint(const InfraredSignal* signal) {
+    return signal->is_raw ? infrared_signal_get_raw_fingerprint(&signal->payload.raw) :
+                            infrared_signal_get_message_fingerprint(&signal->payload.message);
+}
+
+bool infrared_signal_is_similar(const InfraredSignal* signal, const InfraredSignal* other) {
+    if(signal->is_raw != other->is_raw) {
+        return false;
+    } else if(signal->is_raw) {
+        return infrared_signal_is_raw_similar(&signal->payload.raw, &other->payload.raw);
+    } else {
+        const InfraredMessage* message = &signal->payload.message;
+        const InfraredMessage* other_message = &other->payload.message;
+        return (message->protocol == other_message->protocol) &&
+               (message->address == other_message->address) &&
+               (message->command == other_message->command);
+    }
+}
+
 void infrared_signal_set_signal(InfraredSignal* signal, const InfraredSignal* other) {
     if(other->is_raw) {
         const InfraredRawSignal* raw = &other->payload.raw;
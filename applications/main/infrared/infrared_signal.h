@@ -19,9 +19,15 @@ typedef struct {
 InfraredSignal* infrared_signal_alloc();
 void infrared_signal_free(InfraredSignal* signal);
 
-bool infrared_signal_is_raw(InfraredSignal* signal);
+bool infrared_signal_is_raw(const InfraredSignal* signal);
 bool infrared_signal_is_valid(InfraredSignal* signal);
 
+/* Hash of signal contents, similar signals always share it: raw ones are keyed on
+ * the number of timings, parsed ones on protocol, address and command */
+uint32_t infrared_signal_get_fingerprint(const InfraredSignal* signal);
+/* Compare signals ignoring carrier and small timing deviations */
+bool infrared_signal_is_similar(const InfraredSignal* signal, const InfraredSignal* other);
+
 void infrared_signal_set_signal(InfraredSignal* signal, const InfraredSignal* other);
 
 void infrared_signal_set_raw_signal(
@@ -37,6 +43,7 @@ InfraredMessage* infrared_signal_get_message(InfraredSignal* signal);
 
 bool infrared_signal_save(InfraredSignal* signal, FlipperFormat* ff, const char* name);
 bool infrared_signal_read(InfraredSignal* signal, FlipperFormat* ff, FuriString* name);
+bool infrared_signal_read_body(InfraredSignal* signal, FlipperFormat* ff);
 bool infrared_signal_search_and_read(
     InfraredSignal* signal,
     FlipperFormat* ff,
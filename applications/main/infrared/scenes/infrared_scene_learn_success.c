@@ -15,7 +15,18 @@ void infrared_scene_learn_success_on_enter(void* context) {
 
     if(infrared_signal_is_raw(signal)) {
         InfraredRawSignal* raw = infrared_signal_get_raw_signal(signal);
-        dialog_ex_set_header(dialog_ex, "Unknown", 95, 10, AlignCenter, AlignCenter);
+        size_t button_index;
+        // Name the button of the current remote this capture matches, if any
+        if(!infrared->app_state.is_learning_new_remote &&
+           infrared_remote_find_button_by_signal(infrared->remote, signal, &button_index)) {
+            InfraredRemoteButton* button =
+                infrared_remote_get_button(infrared->remote, button_index);
+            infrared_text_store_set(infrared, 1, "%s", infrared_remote_button_get_name(button));
+            dialog_ex_set_header(
+                dialog_ex, infrared->text_store[1], 95, 10, AlignCenter, AlignCenter);
+        } else {
+            dialog_ex_set_header(dialog_ex, "Unknown", 95, 10, AlignCenter, AlignCenter);
+        }
         infrared_text_store_set(infrared, 0, "%d samples", raw->timings_size);
         dialog_ex_set_text(dialog_ex, infrared->text_store[0], 75, 23, AlignLeft, AlignTop);
 
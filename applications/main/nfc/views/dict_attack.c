@@ -24,8 +24,6 @@ typedef struct {
     uint8_t keys_found;
     uint16_t dict_keys_total;
     uint16_t dict_keys_current;
-    bool is_key_attack;
-    uint8_t key_attack_current_sector;
 } DictAttackViewModel;
 
 static void dict_attack_draw_callback(Canvas* canvas, void* model) {
@@ -41,15 +39,7 @@ static void dict_attack_draw_callback(Canvas* canvas, void* model) {
         canvas_set_font(canvas, FontSecondary);
         canvas_draw_str_aligned(
             canvas, 64, 0, AlignCenter, AlignTop, furi_string_get_cstr(m->header));
-        if(m->is_key_attack) {
-            snprintf(
-                draw_str,
-                sizeof(draw_str),
-                "Reuse key check for sector: %d",
-                m->key_attack_current_sector);
-        } else {
-            snprintf(draw_str, sizeof(draw_str), "Unlocking sector: %d", m->sector_current);
-        }
+        snprintf(draw_str, sizeof(draw_str), "Unlocking sector: %d", m->sector_current);
         canvas_draw_str_aligned(canvas, 0, 10, AlignLeft, AlignTop, draw_str);
         float dict_progress = m->dict_keys_total == 0 ?
                                   0 :
@@ -131,7 +121,6 @@ void dict_attack_reset(DictAttack* dict_attack) {
             model->keys_found = 0;
             model->dict_keys_total = 0;
             model->dict_keys_current = 0;
-            model->is_key_attack = false;
             furi_string_reset(model->header);
         },
         false);
@@ -214,7 +203,6 @@ void dict_attack_inc_current_sector(DictAttack* dict_attack) {
         {
             if(model->sector_current < model->sectors_total) {
                 model->sector_current++;
-                model->dict_keys_current = 0;
             }
         },
         true);
@@ -254,28 +242,3 @@ void dict_attack_inc_current_dict_key(DictAttack* dict_attack, uint16_t keys_tri
         },
         true);
 }
-
-void dict_attack_set_key_attack(DictAttack* dict_attack, bool is_key_attack, uint8_t sector) {
-    furi_assert(dict_attack);
-    with_view_model(
-        dict_attack->view,
-        DictAttackViewModel * model,
-        {
-            model->is_key_attack = is_key_attack;
-            model->key_attack_current_sector = sector;
-        },
-        true);
-}
-
-void dict_attack_inc_key_attack_current_sector(DictAttack* dict_attack) {
-    furi_assert(dict_attack);
-    with_view_model(
-        dict_attack->view,
-        DictAttackViewModel * model,
-        {
-            if(model->key_attack_current_sector < model->sectors_total) {
-                model->key_attack_current_sector++;
-            }
-        },
-        true);
-}
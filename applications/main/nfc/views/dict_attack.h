@@ -37,8 +37,4 @@ void dict_attack_inc_keys_found(DictAttack* dict_attack);
 
 void dict_attack_set_total_dict_keys(DictAttack* dict_attack, uint16_t dict_keys_total);
 
-void dict_attack_inc_current_dict_key(DictAttack* dict_attack, uint16_t keys_tried);
-
-void dict_attack_set_key_attack(DictAttack* dict_attack, bool is_key_attack, uint8_t sector);
-
-void dict_attack_inc_key_attack_current_sector(DictAttack* dict_attack);
\ No newline at end of file
+void dict_attack_inc_current_dict_key(DictAttack* dict_attack, uint16_t keys_tried);
\ No newline at end of file
@@ -443,11 +443,12 @@ static void subghz_cli_command_print_usage() {
             "\tencrypt_keeloq <path_decrypted_file> <path_encrypted_file> <IV:16 bytes in hex>\t - Encrypt keeloq manufacture keys\r\n");
         printf(
             "\tencrypt_raw <path_decrypted_file> <path_encrypted_file> <IV:16 bytes in hex>\t - Encrypt RAW data\r\n");
+        printf(
+            "\tcompile_keeloq <path_keystore_file> <path_binary_file> <IV:16 bytes in hex>\t - Compile keeloq manufacture keys to binary keystore\r\n");
     }
 }
 
-static void subghz_cli_command_encrypt_keeloq(Cli* cli, FuriString* args) {
-    UNUSED(cli);
+static void subghz_cli_command_save_keeloq(FuriString* args, bool binary) {
     uint8_t iv[16];
 
     FuriString* source;
@@ -478,7 +479,10 @@ static void subghz_cli_command_encrypt_keeloq(Cli* cli, FuriString* args) {
             break;
         }
 
-        if(!subghz_keystore_save(keystore, furi_string_get_cstr(destination), iv)) {
+        const char* destination_path = furi_string_get_cstr(destination);
+        bool saved = binary ? subghz_keystore_save_binary(keystore, destination_path, iv) :
+                              subghz_keystore_save(keystore, destination_path, iv);
+        if(!saved) {
             printf("Failed to save Keystore");
             break;
         }
@@ -489,6 +493,16 @@ static void subghz_cli_command_encrypt_keeloq(Cli* cli, FuriString* args) {
     furi_string_free(source);
 }
 
+static void subghz_cli_command_encrypt_keeloq(Cli* cli, FuriString* args) {
+    UNUSED(cli);
+    subghz_cli_command_save_keeloq(args, false);
+}
+
+static void subghz_cli_command_compile_keeloq(Cli* cli, FuriString* args) {
+    UNUSED(cli);
+    subghz_cli_command_save_keeloq(args, true);
+}
+
 static void subghz_cli_command_encrypt_raw(Cli* cli, FuriString* args) {
     UNUSED(cli);
     uint8_t iv[16];
@@ -749,6 +763,11 @@ static void subghz_cli_command(Cli* cli, FuriString* args, void* context) {
                 break;
             }
 
+            if(furi_string_cmp_str(cmd, "compile_keeloq") == 0) {
+                subghz_cli_command_compile_keeloq(cli, args);
+                break;
+            }
+
             if(furi_string_cmp_str(cmd, "tx_carrier") == 0) {
                 subghz_cli_command_tx_carrier(cli, args, context);
                 break;
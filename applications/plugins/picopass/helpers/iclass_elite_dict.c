@@ -10,6 +10,7 @@
 
 #define ICLASS_ELITE_KEY_LINE_LEN (17)
 #define ICLASS_ELITE_KEY_LEN (8)
+#define ICLASS_ELITE_DICT_STREAM_CACHE_SIZE (4096)
 
 struct IclassEliteDict {
     Stream* stream;
@@ -35,7 +36,7 @@ bool iclass_elite_dict_check_presence(IclassEliteDictType dict_type) {
 IclassEliteDict* iclass_elite_dict_alloc(IclassEliteDictType dict_type) {
     IclassEliteDict* dict = malloc(sizeof(IclassEliteDict));
     Storage* storage = furi_record_open(RECORD_STORAGE);
-    dict->stream = buffered_file_stream_alloc(storage);
+    dict->stream = buffered_file_stream_alloc_ex(storage, ICLASS_ELITE_DICT_STREAM_CACHE_SIZE);
     furi_record_close(RECORD_STORAGE);
     FuriString* next_line = furi_string_alloc();
 
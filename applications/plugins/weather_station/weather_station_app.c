@@ -101,8 +101,8 @@ WeatherStationApp* weather_station_app_alloc() {
     subghz_receiver_set_filter(app->txrx->receiver, SubGhzProtocolFlag_Decodable);
     subghz_worker_set_overrun_callback(
         app->txrx->worker, (SubGhzWorkerOverrunCallback)subghz_receiver_reset);
-    subghz_worker_set_pair_callback(
-        app->txrx->worker, (SubGhzWorkerPairCallback)subghz_receiver_decode);
+    subghz_worker_set_pair_batch_callback(
+        app->txrx->worker, (SubGhzWorkerPairBatchCallback)subghz_receiver_decode_batch);
     subghz_worker_set_context(app->txrx->worker, app->txrx->receiver);
 
     furi_hal_power_suppress_charge_enter();
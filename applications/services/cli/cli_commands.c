@@ -185,6 +185,12 @@ void cli_command_log(Cli* cli, FuriString* args, void* context) {
 
     furi_hal_console_set_tx_callback(NULL, NULL);
 
+    FuriLogStats stats;
+    furi_log_get_stats(&stats);
+    if(stats.dropped || stats.stalled) {
+        printf("Log records dropped: %lu, stalled: %lu\r\n", stats.dropped, stats.stalled);
+    }
+
     if(restore_log_level) {
         // There will be strange behaviour if log level is set from settings while log command is running
         furi_log_set_level(previous_level);
@@ -373,6 +379,20 @@ void cli_command_free(Cli* cli, FuriString* args, void* context) {
     printf("Total heap size: %zu\r\n", memmgr_get_total_heap());
     printf("Minimum heap size: %zu\r\n", memmgr_get_minimum_free_heap());
     printf("Maximum heap block: %zu\r\n", memmgr_heap_get_max_free_block());
+    printf("Free heap blocks: %zu\r\n", memmgr_heap_get_free_block_count());
+
+    for(size_t i = 0; i < memmgr_heap_get_slab_class_count(); i++) {
+        MemmgrHeapSlabStats stats;
+        memmgr_heap_get_slab_stats(i, &stats);
+        printf(
+            "Slab %zu: pages %zu, objects %zu/%zu, hits %lu, misses %lu\r\n",
+            stats.object_size,
+            stats.pages,
+            stats.objects_used,
+            stats.objects_total,
+            stats.hits,
+            stats.misses);
+    }
 
     printf("Pool free: %zu\r\n", memmgr_pool_get_free());
     printf("Maximum pool block: %zu\r\n", memmgr_pool_get_max_block());
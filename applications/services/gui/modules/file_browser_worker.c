@@ -8,6 +8,7 @@
 #include <furi.h>
 #include <stddef.h>
 #include "toolbox/path.h"
+#include <furi_hal.h>
 
 #define TAG "BrowserWorker"
 
@@ -15,6 +16,8 @@
 #define BROWSER_ROOT STORAGE_ANY_PATH_PREFIX
 #define FILE_NAME_LEN_MAX 256
 #define LONG_LOAD_THRESHOLD 100
+// Folders with more names than this are read from storage on every load
+#define BROWSER_CACHE_NAMES_SIZE_MAX (32 * 1024)
 
 typedef enum {
     WorkerEvtStop = (1 << 0),
@@ -31,6 +34,14 @@ typedef enum {
 
 ARRAY_DEF(idx_last_array, int32_t)
 
+typedef struct {
+    uint32_t name_offset;
+    bool is_folder;
+} BrowserCacheItem;
+
+ARRAY_DEF(BrowserCacheItemArray, BrowserCacheItem, M_POD_OPLIST)
+ARRAY_DEF(BrowserCacheNameArray, char, M_POD_OPLIST)
+
 struct BrowserWorker {
     FuriThread* thread;
 
@@ -45,6 +56,13 @@ struct BrowserWorker {
     bool hide_dot_files;
     idx_last_array_t idx_last;
 
+    // Filtered entries of the last initialized folder, names are null-terminated
+    FuriString* cache_path;
+    uint32_t cache_timestamp;
+    bool cache_valid;
+    BrowserCacheItemArray_t cache_items;
+    BrowserCacheNameArray_t cache_names;
+
     void* cb_ctx;
     BrowserWorkerFolderOpenCallback folder_cb;
     BrowserWorkerListLoadCallback list_load_cb;
@@ -104,6 +122,51 @@ static bool browser_filter_by_name(BrowserWorker* browser, FuriString* name, boo
     return false;
 }
 
+static void browser_cache_reset(BrowserWorker* browser) {
+    browser->cache_valid = false;
+    BrowserCacheItemArray_reset(browser->cache_items);
+    BrowserCacheNameArray_reset(browser->cache_names);
+}
+
+static bool browser_cache_push(BrowserWorker* browser, const char* name, bool is_folder) {
+    size_t name_offset = BrowserCacheNameArray_size(browser->cache_names);
+    size_t name_size = strlen(name) + 1;
+    if(name_offset + name_size > BROWSER_CACHE_NAMES_SIZE_MAX) {
+        return false;
+    }
+
+    BrowserCacheNameArray_resize(browser->cache_names, name_offset + name_size);
+    memcpy(BrowserCacheNameArray_get(browser->cache_names, name_offset), name, name_size);
+
+    BrowserCacheItem* item = BrowserCacheItemArray_push_new(browser->cache_items);
+    item->name_offset = name_offset;
+    item->is_folder = is_folder;
+    return true;
+}
+
+static const char* browser_cache_get_name(BrowserWorker* browser, const BrowserCacheItem* item) {
+    return BrowserCacheNameArray_cget(browser->cache_names, item->name_offset);
+}
+
+static bool browser_cache_get_timestamp(FuriString* path, uint32_t* timestamp) {
+    Storage* storage = furi_record_open(RECORD_STORAGE);
+    bool state = (storage_common_timestamp(storage, furi_string_get_cstr(path), timestamp) ==
+                  FSE_OK);
+    furi_record_close(RECORD_STORAGE);
+    return state;
+}
+
+static bool browser_cache_is_valid(BrowserWorker* browser, FuriString* path) {
+    if(!browser->cache_valid || (furi_string_cmp(browser->cache_path, path) != 0)) {
+        return false;
+    }
+
+    // Any change of the storage timestamp invalidates the cache, even if RTC went backwards
+    uint32_t timestamp = 0;
+    return browser_cache_get_timestamp(path, &timestamp) &&
+           (timestamp == browser->cache_timestamp);
+}
+
 static bool browser_folder_check_and_switch(FuriString* path) {
     FileInfo file_info;
     Storage* storage = furi_record_open(RECORD_STORAGE);
@@ -139,6 +202,30 @@ static bool browser_folder_init(
     FileInfo file_info;
     uint32_t total_files_cnt = 0;
 
+    *item_cnt = 0;
+    *file_idx = -1;
+
+    if(browser_cache_is_valid(browser, path)) {
+        *item_cnt = BrowserCacheItemArray_size(browser->cache_items);
+        if(!furi_string_empty(filename)) {
+            for(uint32_t i = 0; i < *item_cnt; i++) {
+                const BrowserCacheItem* item = BrowserCacheItemArray_cget(browser->cache_items, i);
+                if(furi_string_cmp_str(filename, browser_cache_get_name(browser, item)) == 0) {
+                    *file_idx = i;
+                    break;
+                }
+            }
+        }
+        return true;
+    }
+
+    browser_cache_reset(browser);
+    furi_string_set(browser->cache_path, path);
+    // Storage timestamp has one second resolution, so it is not changed by the next write
+    // in the second of the last one. Folder is not cached until that second has passed.
+    bool cache_enabled = browser_cache_get_timestamp(path, &browser->cache_timestamp) &&
+                         (browser->cache_timestamp != furi_hal_rtc_get_timestamp());
+
     Storage* storage = furi_record_open(RECORD_STORAGE);
     File* directory = storage_file_alloc(storage);
 
@@ -146,9 +233,6 @@ static bool browser_folder_init(
     FuriString* name_str;
     name_str = furi_string_alloc();
 
-    *item_cnt = 0;
-    *file_idx = -1;
-
     if(storage_dir_open(directory, furi_string_get_cstr(path))) {
         state = true;
         while(1) {
@@ -164,6 +248,10 @@ static bool browser_folder_init(
                             *file_idx = *item_cnt;
                         }
                     }
+                    if(cache_enabled) {
+                        cache_enabled = browser_cache_push(
+                            browser, name_temp, (file_info.flags & FSF_DIRECTORY));
+                    }
                     (*item_cnt)++;
                 }
                 if(total_files_cnt == LONG_LOAD_THRESHOLD) {
@@ -183,11 +271,64 @@ static bool browser_folder_init(
 
     furi_record_close(RECORD_STORAGE);
 
+    if(state && cache_enabled) {
+        // Release growth slack
+        BrowserCacheItemArray_reserve(browser->cache_items, 0);
+        BrowserCacheNameArray_reserve(browser->cache_names, 0);
+        browser->cache_valid = true;
+    } else {
+        browser_cache_reset(browser);
+    }
+
     return state;
 }
 
+static bool browser_folder_load_cached(
+    BrowserWorker* browser,
+    FuriString* path,
+    uint32_t offset,
+    uint32_t count) {
+    uint32_t items_total = BrowserCacheItemArray_size(browser->cache_items);
+    if(offset > items_total) {
+        return false;
+    }
+
+    if(browser->list_load_cb) {
+        browser->list_load_cb(browser->cb_ctx, offset);
+    }
+
+    FuriString* name_str;
+    name_str = furi_string_alloc();
+
+    uint32_t items_cnt = 0;
+    while((items_cnt < count) && (offset + items_cnt < items_total)) {
+        const BrowserCacheItem* item =
+            BrowserCacheItemArray_cget(browser->cache_items, offset + items_cnt);
+        furi_string_printf(
+            name_str,
+            "%s/%s",
+            furi_string_get_cstr(path),
+            browser_cache_get_name(browser, item));
+        if(browser->list_item_cb) {
+            browser->list_item_cb(browser->cb_ctx, name_str, item->is_folder, false);
+        }
+        items_cnt++;
+    }
+    if(browser->list_item_cb) {
+        browser->list_item_cb(browser->cb_ctx, NULL, false, true);
+    }
+
+    furi_string_free(name_str);
+
+    return (items_cnt == count);
+}
+
 static bool
     browser_folder_load(BrowserWorker* browser, FuriString* path, uint32_t offset, uint32_t count) {
+    if(browser_cache_is_valid(browser, path)) {
+        return browser_folder_load_cached(browser, path, offset, count);
+    }
+
     FileInfo file_info;
 
     Storage* storage = furi_record_open(RECORD_STORAGE);
@@ -286,6 +427,8 @@ static int32_t browser_worker(void* context) {
                 path_extract_filename(browser->path_next, filename, false);
             }
             idx_last_array_reset(browser->idx_last);
+            // Filter settings may have changed
+            browser_cache_reset(browser);
 
             furi_thread_flags_set(furi_thread_get_id(browser->thread), WorkerEvtFolderEnter);
         }
@@ -339,6 +482,7 @@ static int32_t browser_worker(void* context) {
 
             int32_t file_idx = 0;
             furi_string_reset(filename);
+            browser_cache_reset(browser);
             browser_folder_init(browser, path, filename, &items_cnt, &file_idx);
             FURI_LOG_D(
                 TAG,
@@ -378,6 +522,9 @@ BrowserWorker* file_browser_worker_alloc(
     BrowserWorker* browser = malloc(sizeof(BrowserWorker));
 
     idx_last_array_init(browser->idx_last);
+    browser->cache_path = furi_string_alloc();
+    BrowserCacheItemArray_init(browser->cache_items);
+    BrowserCacheNameArray_init(browser->cache_names);
 
     browser->filter_extension = furi_string_alloc_set(filter_ext);
     browser->skip_assets = skip_assets;
@@ -410,6 +557,9 @@ void file_browser_worker_free(BrowserWorker* browser) {
     furi_string_free(browser->path_start);
 
     idx_last_array_clear(browser->idx_last);
+    furi_string_free(browser->cache_path);
+    BrowserCacheItemArray_clear(browser->cache_items);
+    BrowserCacheNameArray_clear(browser->cache_names);
 
     free(browser);
 }
@@ -317,6 +317,27 @@ static void rpc_system_storage_list_process(const PB_Main* request, void* contex
     furi_record_close(RECORD_STORAGE);
 }
 
+typedef struct {
+    FuriSemaphore* semaphore;
+    size_t size;
+} RpcStorageReadContext;
+
+static void rpc_system_storage_read_callback(File* file, size_t size, void* context) {
+    UNUSED(file);
+    RpcStorageReadContext* read_context = context;
+    read_context->size = size;
+    furi_semaphore_release(read_context->semaphore);
+}
+
+static pb_bytes_array_t*
+    rpc_system_storage_read_start(File* file, size_t size, RpcStorageReadContext* read_context) {
+    pb_bytes_array_t* data = malloc(PB_BYTES_ARRAY_T_ALLOCSIZE(size));
+    data->size = 0;
+    storage_file_read_async(
+        file, &data->bytes[0], size, rpc_system_storage_read_callback, read_context);
+    return data;
+}
+
 static void rpc_system_storage_read_process(const PB_Main* request, void* context) {
     furi_assert(request);
     furi_assert(context);
@@ -339,37 +360,43 @@ static void rpc_system_storage_read_process(const PB_Main* request, void* contex
 
     if(fs_operation_success) {
         size_t size_left = storage_file_size(file);
+        RpcStorageReadContext read_context = {
+            .semaphore = furi_semaphore_alloc(1, 0),
+            .size = 0,
+        };
+
+        size_t read_size = MIN(size_left, MAX_DATA_SIZE);
+        pb_bytes_array_t* data = rpc_system_storage_read_start(file, read_size, &read_context);
+        bool has_next = false;
+
         do {
+            furi_semaphore_acquire(read_context.semaphore, FuriWaitForever);
+            data->size = read_context.size;
+            size_left -= read_context.size;
+            fs_operation_success = (read_context.size == read_size);
+            has_next = fs_operation_success && (size_left > 0);
+
             response->command_id = request->command_id;
             response->which_content = PB_Main_storage_read_response_tag;
             response->command_status = PB_CommandStatus_OK;
-
-            size_t read_size = MIN(size_left, MAX_DATA_SIZE);
-            if(read_size) {
-                response->content.storage_read_response.has_file = true;
-                response->content.storage_read_response.file.data =
-                    malloc(PB_BYTES_ARRAY_T_ALLOCSIZE(read_size));
-                uint8_t* buffer = &response->content.storage_read_response.file.data->bytes[0];
-                uint16_t* read_size_msg = &response->content.storage_read_response.file.data->size;
-
-                *read_size_msg = storage_file_read(file, buffer, read_size);
-                size_left -= *read_size_msg;
-                fs_operation_success = (*read_size_msg == read_size);
-
-                response->has_next = fs_operation_success && (size_left > 0);
-            } else {
-                response->content.storage_read_response.file.data =
-                    malloc(PB_BYTES_ARRAY_T_ALLOCSIZE(0));
-                response->content.storage_read_response.file.data->size = 0;
-                response->content.storage_read_response.has_file = true;
-                response->has_next = false;
-                fs_operation_success = true;
+            response->content.storage_read_response.has_file = true;
+            response->content.storage_read_response.file.data = data;
+            response->has_next = has_next;
+
+            // Next chunk is read by the storage thread while this one is being sent
+            if(has_next) {
+                read_size = MIN(size_left, MAX_DATA_SIZE);
+                data = rpc_system_storage_read_start(file, read_size, &read_context);
             }
 
             if(fs_operation_success) {
                 rpc_send_and_release(session, response);
+            } else {
+                free(response->content.storage_read_response.file.data);
             }
-        } while((size_left != 0) && fs_operation_success);
+        } while(has_next);
+
+        furi_semaphore_free(read_context.semaphore);
     }
 
     if(!fs_operation_success) {
@@ -19,6 +19,22 @@ extern "C" {
 
 typedef struct Storage Storage;
 
+/** Buffer of vectored and asynchronous file operations */
+typedef struct {
+    void* buff;
+    uint16_t size;
+} StorageIoVec;
+
+/** Asynchronous file operation callback, called from the storage thread.
+ * Storage serves no other request while it runs, so it must not block and must not
+ * call the storage API: a synchronous request would wait on the thread that runs it.
+ * Signal a thread flag or post to a queue and do the rest from your own thread.
+ * @param file pointer to file object
+ * @param size how many bytes were actually read or written
+ * @param context callback context
+ */
+typedef void (*StorageFileIoCallback)(File* file, size_t size, void* context);
+
 /** Allocates and initializes a file descriptor
  * @return File*
  */
@@ -97,6 +113,56 @@ uint16_t storage_file_read(File* file, void* buff, uint16_t bytes_to_read);
  */
 uint16_t storage_file_write(File* file, const void* buff, uint16_t bytes_to_write);
 
+/** Reads bytes from a file into several buffers in one storage request
+ * @param file pointer to file object.
+ * @param vec array of buffers, filled in order
+ * @param count number of buffers
+ * @return size_t how many bytes were actually read
+ */
+size_t storage_file_readv(File* file, const StorageIoVec* vec, size_t count);
+
+/** Writes bytes from several buffers to a file in one storage request
+ * @param file pointer to file object.
+ * @param vec array of buffers, written in order
+ * @param count number of buffers
+ * @return size_t how many bytes were actually written
+ */
+size_t storage_file_writev(File* file, const StorageIoVec* vec, size_t count);
+
+/** Starts reading bytes from a file into a buffer, returns without waiting.
+ * Requests are processed in order, so other operations on the file may be issued
+ * right away. Buffer must stay valid until the callback is called.
+ * @param file pointer to file object.
+ * @param buff pointer to a buffer, for reading
+ * @param bytes_to_read how many bytes to read
+ * @param callback completion callback, called from the storage thread, must not
+ * block or call the storage API, see StorageFileIoCallback
+ * @param context callback context
+ */
+void storage_file_read_async(
+    File* file,
+    void* buff,
+    uint16_t bytes_to_read,
+    StorageFileIoCallback callback,
+    void* context);
+
+/** Starts writing bytes from a buffer to a file, returns without waiting.
+ * Requests are processed in order, so other operations on the file may be issued
+ * right away. Buffer must stay valid until the callback is called.
+ * @param file pointer to file object.
+ * @param buff pointer to buffer, for writing
+ * @param bytes_to_write how many bytes to write
+ * @param callback completion callback, called from the storage thread, must not
+ * block or call the storage API, see StorageFileIoCallback
+ * @param context callback context
+ */
+void storage_file_write_async(
+    File* file,
+    const void* buff,
+    uint16_t bytes_to_write,
+    StorageFileIoCallback callback,
+    void* context);
+
 /** Moves the r/w pointer 
  * @param file pointer to file object.
  * @param offset offset to move the r/w pointer
@@ -5,6 +5,9 @@
 #include <lib/toolbox/args.h>
 #include <lib/toolbox/md5.h>
 #include <lib/toolbox/dir_walk.h>
+#include <lib/toolbox/stream/file_stream.h>
+#include <lib/flipper_format/flipper_format.h>
+#include <lib/flipper_format/flipper_format_i.h>
 #include <storage/storage.h>
 #include <storage/storage_sd_api.h>
 #include <power/power_service/power.h>
@@ -33,6 +36,8 @@ static void storage_cli_print_usage() {
     printf("\tmd5\t - md5 hash of the file\r\n");
     printf("\tstat\t - info about file or dir\r\n");
     printf("\ttimestamp\t - last modification timestamp\r\n");
+    printf(
+        "\tpack\t - pack numeric values of flipper format file, <args> must contain the key\r\n");
 };
 
 static void storage_cli_print_error(FS_Error error) {
@@ -507,6 +512,115 @@ static void storage_cli_md5(Cli* cli, FuriString* path) {
     furi_record_close(RECORD_STORAGE);
 }
 
+// Returns false if the line is not a plain list of values in int32 range, it is copied as is
+static bool storage_cli_pack_parse(const char* line, int32_t** values, size_t* count) {
+    size_t capacity = 0;
+    *count = 0;
+
+    while(true) {
+        while(*line == ' ') line++;
+        if(*line == '\0' || *line == '\r' || *line == '\n') break;
+
+        // long is 32 bit and strtol saturates silently, wider parse catches out of range values
+        char* end = NULL;
+        const long long value = strtoll(line, &end, 10);
+        if(end == line || value < INT32_MIN || value > INT32_MAX) return false;
+        line = end;
+
+        if(*count == capacity) {
+            capacity = capacity ? capacity * 2 : 64;
+            *values = realloc(*values, capacity * sizeof(int32_t));
+        }
+        (*values)[(*count)++] = (int32_t)value;
+    }
+
+    return *count > 0 && *count <= UINT16_MAX;
+}
+
+static void storage_cli_pack(Cli* cli, FuriString* path, FuriString* args) {
+    UNUSED(cli);
+    Storage* api = furi_record_open(RECORD_STORAGE);
+    FuriString* key = furi_string_alloc();
+    FuriString* prefix = furi_string_alloc();
+    FuriString* line = furi_string_alloc();
+    FuriString* tmp_path = furi_string_alloc_printf("%s.tmp", furi_string_get_cstr(path));
+    Stream* source = file_stream_alloc(api);
+    FlipperFormat* target = flipper_format_file_alloc(api);
+    Stream* target_stream = flipper_format_get_raw_stream(target);
+    int32_t* values = NULL;
+    size_t lines_packed = 0;
+    bool success = false;
+
+    do {
+        if(!args_read_string_and_trim(args, key)) {
+            storage_cli_print_usage();
+            break;
+        }
+        furi_string_printf(prefix, "%s: ", furi_string_get_cstr(key));
+
+        if(!file_stream_open(
+               source, furi_string_get_cstr(path), FSAM_READ, FSOM_OPEN_EXISTING)) {
+            storage_cli_print_error(file_stream_get_error(source));
+            break;
+        }
+        if(!flipper_format_file_open_always(target, furi_string_get_cstr(tmp_path))) {
+            storage_cli_print_error(file_stream_get_error(target_stream));
+            break;
+        }
+
+        success = true;
+        while(success && stream_read_line(source, line)) {
+            size_t count;
+            if(furi_string_start_with(line, prefix) &&
+               storage_cli_pack_parse(
+                   furi_string_get_cstr(line) + furi_string_size(prefix), &values, &count)) {
+                success = flipper_format_write_int32_packed(
+                    target, furi_string_get_cstr(key), values, count);
+                lines_packed++;
+            } else {
+                success = stream_write_string(target_stream, line) == furi_string_size(line);
+            }
+        }
+    } while(false);
+
+    file_stream_close(source);
+    flipper_format_file_close(target);
+
+    if(success) {
+        FileInfo source_info = {0};
+        FileInfo target_info = {0};
+        storage_common_stat(api, furi_string_get_cstr(path), &source_info);
+        storage_common_stat(api, furi_string_get_cstr(tmp_path), &target_info);
+
+        FS_Error error = storage_common_remove(api, furi_string_get_cstr(path));
+        if(error == FSE_OK) {
+            error = storage_common_rename(
+                api, furi_string_get_cstr(tmp_path), furi_string_get_cstr(path));
+        }
+
+        if(error == FSE_OK) {
+            printf(
+                "Packed %zu lines, %lu -> %lu bytes\r\n",
+                lines_packed,
+                (uint32_t)source_info.size,
+                (uint32_t)target_info.size);
+        } else {
+            storage_cli_print_error(error);
+        }
+    } else {
+        storage_common_remove(api, furi_string_get_cstr(tmp_path));
+    }
+
+    free(values);
+    flipper_format_free(target);
+    stream_free(source);
+    furi_string_free(tmp_path);
+    furi_string_free(line);
+    furi_string_free(prefix);
+    furi_string_free(key);
+    furi_record_close(RECORD_STORAGE);
+}
+
 void storage_cli(Cli* cli, FuriString* args, void* context) {
     UNUSED(context);
     FuriString* cmd;
@@ -595,6 +709,11 @@ void storage_cli(Cli* cli, FuriString* args, void* context) {
             break;
         }
 
+        if(furi_string_cmp_str(cmd, "pack") == 0) {
+            storage_cli_pack(cli, path, args);
+            break;
+        }
+
         if(furi_string_cmp_str(cmd, "timestamp") == 0) {
             storage_cli_timestamp(cli, path);
             break;
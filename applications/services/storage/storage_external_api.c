@@ -51,6 +51,7 @@
 #define S_RETURN_BOOL (return_data.bool_value);
 #define S_RETURN_UINT16 (return_data.uint16_value);
 #define S_RETURN_UINT64 (return_data.uint64_value);
+#define S_RETURN_SIZE (return_data.size_value);
 #define S_RETURN_ERROR (return_data.error_value);
 #define S_RETURN_CSTRING (return_data.cstring_value);
 
@@ -186,6 +187,93 @@ uint16_t storage_file_write(File* file, const void* buff, uint16_t bytes_to_writ
     return S_RETURN_UINT16;
 }
 
+static size_t storage_file_iovec(
+    File* file,
+    const StorageIoVec* vec,
+    size_t count,
+    StorageCommand command) {
+    if(count == 0) {
+        return 0;
+    }
+
+    S_FILE_API_PROLOGUE;
+    S_API_PROLOGUE;
+
+    SAData data = {
+        .fiovec = {
+            .file = file,
+            .vec = vec,
+            .count = count,
+        }};
+
+    S_API_MESSAGE(command);
+    S_API_EPILOGUE;
+    return S_RETURN_SIZE;
+}
+
+size_t storage_file_readv(File* file, const StorageIoVec* vec, size_t count) {
+    return storage_file_iovec(file, vec, count, StorageCommandFileReadV);
+}
+
+size_t storage_file_writev(File* file, const StorageIoVec* vec, size_t count) {
+    return storage_file_iovec(file, vec, count, StorageCommandFileWriteV);
+}
+
+// Request lives on the heap and is freed by the storage thread after the callback
+static void storage_file_iovec_async(
+    File* file,
+    void* buff,
+    uint16_t size,
+    StorageCommand command,
+    StorageFileIoCallback callback,
+    void* context) {
+    furi_assert(callback);
+    S_FILE_API_PROLOGUE;
+
+    StorageAsyncRequest* request = malloc(sizeof(StorageAsyncRequest));
+    request->file = file;
+    request->vec.buff = buff;
+    request->vec.size = size;
+    request->callback = callback;
+    request->context = context;
+    request->data.fiovec.file = file;
+    request->data.fiovec.vec = &request->vec;
+    request->data.fiovec.count = 1;
+
+    StorageMessage message = {
+        .semaphore = NULL,
+        .command = command,
+        .data = &request->data,
+        .return_data = &request->return_data,
+        .async = request,
+    };
+
+    furi_check(
+        furi_message_queue_put(storage->message_queue, &message, FuriWaitForever) ==
+        FuriStatusOk);
+}
+
+void storage_file_read_async(
+    File* file,
+    void* buff,
+    uint16_t bytes_to_read,
+    StorageFileIoCallback callback,
+    void* context) {
+    storage_file_iovec_async(
+        file, buff, bytes_to_read, StorageCommandFileReadV, callback, context);
+}
+
+void storage_file_write_async(
+    File* file,
+    const void* buff,
+    uint16_t bytes_to_write,
+    StorageFileIoCallback callback,
+    void* context) {
+    // Buffer is only read by the write command
+    storage_file_iovec_async(
+        file, (void*)buff, bytes_to_write, StorageCommandFileWriteV, callback, context);
+}
+
 bool storage_file_seek(File* file, uint32_t offset, bool from_start) {
     S_FILE_API_PROLOGUE;
     S_API_PROLOGUE;
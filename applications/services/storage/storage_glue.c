@@ -1,33 +1,6 @@
 #include "storage_glue.h"
 #include <furi_hal.h>
 
-/****************** storage file ******************/
-
-void storage_file_init(StorageFile* obj) {
-    obj->file = NULL;
-    obj->type = ST_ERROR;
-    obj->file_data = NULL;
-    obj->path = furi_string_alloc();
-}
-
-void storage_file_init_set(StorageFile* obj, const StorageFile* src) {
-    obj->file = src->file;
-    obj->type = src->type;
-    obj->file_data = src->file_data;
-    obj->path = furi_string_alloc_set(src->path);
-}
-
-void storage_file_set(StorageFile* obj, const StorageFile* src) { //-V524
-    obj->file = src->file;
-    obj->type = src->type;
-    obj->file_data = src->file_data;
-    furi_string_set(obj->path, src->path);
-}
-
-void storage_file_clear(StorageFile* obj) {
-    furi_string_free(obj->path);
-}
-
 /****************** storage data ******************/
 
 void storage_data_init(StorageData* storage) {
@@ -35,7 +8,8 @@ void storage_data_init(StorageData* storage) {
     furi_check(storage->mutex != NULL);
     storage->data = NULL;
     storage->status = StorageStatusNotReady;
-    StorageFileList_init(storage->files);
+    StorageFileDict_init(storage->files);
+    StoragePathHashDict_init(storage->path_hashes);
 }
 
 bool storage_data_lock(StorageData* storage) {
@@ -92,30 +66,25 @@ uint32_t storage_data_get_timestamp(StorageData* storage) {
 
 /****************** storage glue ******************/
 
-bool storage_has_file(const File* file, StorageData* storage_data) {
-    bool result = false;
-
-    StorageFileList_it_t it;
-    for(StorageFileList_it(it, storage_data->files); !StorageFileList_end_p(it);
-        StorageFileList_next(it)) {
-        const StorageFile* storage_file = StorageFileList_cref(it);
-
-        if(storage_file->file->file_id == file->file_id) {
-            result = true;
-            break;
-        }
-    }
-
-    return result;
+static StorageFile* storage_get_storage_file(const File* file, StorageData* storage) {
+    StorageFile** storage_file = StorageFileDict_get(storage->files, file->file_id);
+    return storage_file ? *storage_file : NULL;
 }
 
-bool storage_path_already_open(FuriString* path, StorageFileList_t array) {
-    bool open = false;
+bool storage_has_file(const File* file, StorageData* storage_data) {
+    return storage_get_storage_file(file, storage_data) != NULL;
+}
 
-    StorageFileList_it_t it;
+bool storage_path_already_open(FuriString* path, StorageData* storage) {
+    uint32_t* count = StoragePathHashDict_get(storage->path_hashes, furi_string_hash(path));
+    if(count == NULL) return false;
 
-    for(StorageFileList_it(it, array); !StorageFileList_end_p(it); StorageFileList_next(it)) {
-        const StorageFile* storage_file = StorageFileList_cref(it);
+    // Hash collision is possible, compare paths of open files
+    bool open = false;
+    StorageFileDict_it_t it;
+    for(StorageFileDict_it(it, storage->files); !StorageFileDict_end_p(it);
+        StorageFileDict_next(it)) {
+        const StorageFile* storage_file = StorageFileDict_cref(it)->value;
 
         if(furi_string_cmp(storage_file->path, path) == 0) {
             open = true;
@@ -127,40 +96,14 @@ bool storage_path_already_open(FuriString* path, StorageFileList_t array) {
 }
 
 void storage_set_storage_file_data(const File* file, void* file_data, StorageData* storage) {
-    StorageFile* founded_file = NULL;
-
-    StorageFileList_it_t it;
-
-    for(StorageFileList_it(it, storage->files); !StorageFileList_end_p(it);
-        StorageFileList_next(it)) {
-        StorageFile* storage_file = StorageFileList_ref(it);
-
-        if(storage_file->file->file_id == file->file_id) {
-            founded_file = storage_file;
-            break;
-        }
-    }
-
+    StorageFile* founded_file = storage_get_storage_file(file, storage);
     furi_check(founded_file != NULL);
 
     founded_file->file_data = file_data;
 }
 
 void* storage_get_storage_file_data(const File* file, StorageData* storage) {
-    const StorageFile* founded_file = NULL;
-
-    StorageFileList_it_t it;
-
-    for(StorageFileList_it(it, storage->files); !StorageFileList_end_p(it);
-        StorageFileList_next(it)) {
-        const StorageFile* storage_file = StorageFileList_cref(it);
-
-        if(storage_file->file->file_id == file->file_id) {
-            founded_file = storage_file;
-            break;
-        }
-    }
-
+    const StorageFile* founded_file = storage_get_storage_file(file, storage);
     furi_check(founded_file != NULL);
 
     return founded_file->file_data;
@@ -171,29 +114,32 @@ void storage_push_storage_file(
     FuriString* path,
     StorageType type,
     StorageData* storage) {
-    StorageFile* storage_file = StorageFileList_push_new(storage->files);
+    StorageFile* storage_file = malloc(sizeof(StorageFile));
 
     file->file_id = (uint32_t)storage_file;
     storage_file->file = file;
     storage_file->type = type;
-    furi_string_set(storage_file->path, path);
+    storage_file->file_data = NULL;
+    storage_file->path = furi_string_alloc_set(path);
+
+    StorageFileDict_set_at(storage->files, file->file_id, storage_file);
+    (*StoragePathHashDict_get_at(storage->path_hashes, furi_string_hash(path)))++;
 }
 
 bool storage_pop_storage_file(File* file, StorageData* storage) {
-    StorageFileList_it_t it;
-    bool result = false;
-
-    for(StorageFileList_it(it, storage->files); !StorageFileList_end_p(it);
-        StorageFileList_next(it)) {
-        if(StorageFileList_cref(it)->file->file_id == file->file_id) {
-            result = true;
-            break;
-        }
+    StorageFile* storage_file = storage_get_storage_file(file, storage);
+    if(storage_file == NULL) return false;
+
+    size_t hash = furi_string_hash(storage_file->path);
+    uint32_t* count = StoragePathHashDict_get(storage->path_hashes, hash);
+    furi_check(count != NULL);
+    if(--(*count) == 0) {
+        StoragePathHashDict_erase(storage->path_hashes, hash);
     }
 
-    if(result) {
-        StorageFileList_remove(storage->files, it);
-    }
+    StorageFileDict_erase(storage->files, file->file_id);
+    furi_string_free(storage_file->path);
+    free(storage_file);
 
-    return result;
+    return true;
 }
@@ -2,7 +2,7 @@
 
 #include <furi.h>
 #include "filesystem_api_internal.h"
-#include <m-list.h>
+#include <m-dict.h>
 
 #ifdef __cplusplus
 extern "C" {
@@ -32,11 +32,6 @@ typedef enum {
     StorageStatusErrorInternal, /**< any other internal error */
 } StorageStatus;
 
-void storage_file_init(StorageFile* obj);
-void storage_file_init_set(StorageFile* obj, const StorageFile* src);
-void storage_file_set(StorageFile* obj, const StorageFile* src);
-void storage_file_clear(StorageFile* obj);
-
 void storage_data_init(StorageData* storage);
 bool storage_data_lock(StorageData* storage);
 bool storage_data_unlock(StorageData* storage);
@@ -45,13 +40,11 @@ const char* storage_data_status_text(StorageData* storage);
 void storage_data_timestamp(StorageData* storage);
 uint32_t storage_data_get_timestamp(StorageData* storage);
 
-LIST_DEF(
-    StorageFileList,
-    StorageFile,
-    (INIT(API_2(storage_file_init)),
-     SET(API_6(storage_file_init_set)),
-     INIT_SET(API_6(storage_file_set)),
-     CLEAR(API_2(storage_file_clear))))
+// Open files by file_id, which is the address of the StorageFile itself
+DICT_DEF2(StorageFileDict, uint32_t, M_DEFAULT_OPLIST, StorageFile*, M_PTR_OPLIST)
+
+// Count of open files by path hash, to reject most lookups without comparing paths
+DICT_DEF2(StoragePathHashDict, size_t, M_DEFAULT_OPLIST, uint32_t, M_DEFAULT_OPLIST)
 
 struct StorageData {
     const FS_Api* fs_api;
@@ -59,12 +52,13 @@ struct StorageData {
     void* data;
     FuriMutex* mutex;
     StorageStatus status;
-    StorageFileList_t files;
+    StorageFileDict_t files;
+    StoragePathHashDict_t path_hashes;
     uint32_t timestamp;
 };
 
 bool storage_has_file(const File* file, StorageData* storage_data);
-bool storage_path_already_open(FuriString* path, StorageFileList_t files);
+bool storage_path_already_open(FuriString* path, StorageData* storage);
 
 void storage_set_storage_file_data(const File* file, void* file_data, StorageData* storage);
 void* storage_get_storage_file_data(const File* file, StorageData* storage);
@@ -1,5 +1,6 @@
 #pragma once
 #include <furi.h>
+#include "storage.h"
 
 #ifdef __cplusplus
 extern "C" {
@@ -24,6 +25,12 @@ typedef struct {
     uint16_t bytes_to_write;
 } SADataFWrite;
 
+typedef struct {
+    File* file;
+    const StorageIoVec* vec;
+    size_t count;
+} SADataFIoVec;
+
 typedef struct {
     File* file;
     uint32_t offset;
@@ -78,6 +85,7 @@ typedef union {
     SADataFOpen fopen;
     SADataFRead fread;
     SADataFWrite fwrite;
+    SADataFIoVec fiovec;
     SADataFSeek fseek;
 
     SADataDOpen dopen;
@@ -99,6 +107,7 @@ typedef union {
     bool bool_value;
     uint16_t uint16_value;
     uint64_t uint64_value;
+    size_t size_value;
     FS_Error error_value;
     const char* cstring_value;
 } SAReturn;
@@ -108,6 +117,8 @@ typedef enum {
     StorageCommandFileClose,
     StorageCommandFileRead,
     StorageCommandFileWrite,
+    StorageCommandFileReadV,
+    StorageCommandFileWriteV,
     StorageCommandFileSeek,
     StorageCommandFileTell,
     StorageCommandFileTruncate,
@@ -129,11 +140,22 @@ typedef enum {
     StorageCommandSDStatus,
 } StorageCommand;
 
+/** Request that is completed with a callback instead of a semaphore */
+typedef struct {
+    File* file;
+    StorageIoVec vec;
+    StorageFileIoCallback callback;
+    void* context;
+    SAData data;
+    SAReturn return_data;
+} StorageAsyncRequest;
+
 typedef struct {
     FuriSemaphore* semaphore;
     StorageCommand command;
     SAData* data;
     SAReturn* return_data;
+    StorageAsyncRequest* async;
 } StorageMessage;
 
 #ifdef __cplusplus
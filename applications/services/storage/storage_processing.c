@@ -32,6 +32,7 @@ static StorageData* get_storage_by_file(File* file, StorageData* storages) {
     for(uint8_t i = 0; i < STORAGE_COUNT; i++) {
         if(storage_has_file(file, &storages[i])) {
             storage_data = &storages[i];
+            break;
         }
     }
 
@@ -111,7 +112,7 @@ bool storage_process_file_open(
         real_path = furi_string_alloc_set(path);
         storage_path_change_to_real_storage(real_path, type);
 
-        if(storage_path_already_open(real_path, storage->files)) {
+        if(storage_path_already_open(real_path, storage)) {
             file->error_id = FSE_ALREADY_OPEN;
         } else {
             if(access_mode & FSAM_WRITE) {
@@ -176,6 +177,39 @@ static uint16_t storage_process_file_write(
     return ret;
 }
 
+// Vectored requests are served in one storage thread round-trip
+static size_t storage_process_file_readv(
+    Storage* app,
+    File* file,
+    const StorageIoVec* vec,
+    size_t count) {
+    size_t ret = 0;
+
+    for(size_t i = 0; i < count; i++) {
+        uint16_t size = storage_process_file_read(app, file, vec[i].buff, vec[i].size);
+        ret += size;
+        if(size != vec[i].size) break;
+    }
+
+    return ret;
+}
+
+static size_t storage_process_file_writev(
+    Storage* app,
+    File* file,
+    const StorageIoVec* vec,
+    size_t count) {
+    size_t ret = 0;
+
+    for(size_t i = 0; i < count; i++) {
+        uint16_t size = storage_process_file_write(app, file, vec[i].buff, vec[i].size);
+        ret += size;
+        if(size != vec[i].size) break;
+    }
+
+    return ret;
+}
+
 static bool storage_process_file_seek(
     Storage* app,
     File* file,
@@ -276,7 +310,7 @@ bool storage_process_dir_open(Storage* app, File* file, const char* path) {
         real_path = furi_string_alloc_set(path);
         storage_path_change_to_real_storage(real_path, type);
 
-        if(storage_path_already_open(real_path, storage->files)) {
+        if(storage_path_already_open(real_path, storage)) {
             file->error_id = FSE_ALREADY_OPEN;
         } else {
             storage_push_storage_file(file, real_path, type, storage);
@@ -382,7 +416,7 @@ static FS_Error storage_process_common_remove(Storage* app, const char* path) {
         }
 
         StorageData* storage = storage_get_storage_by_type(app, type);
-        if(storage_path_already_open(real_path, storage->files)) {
+        if(storage_path_already_open(real_path, storage)) {
             ret = FSE_ALREADY_OPEN;
             break;
         }
@@ -519,6 +553,20 @@ void storage_process_message_internal(Storage* app, StorageMessage* message) {
             message->data->fwrite.buff,
             message->data->fwrite.bytes_to_write);
         break;
+    case StorageCommandFileReadV:
+        message->return_data->size_value = storage_process_file_readv(
+            app,
+            message->data->fiovec.file,
+            message->data->fiovec.vec,
+            message->data->fiovec.count);
+        break;
+    case StorageCommandFileWriteV:
+        message->return_data->size_value = storage_process_file_writev(
+            app,
+            message->data->fiovec.file,
+            message->data->fiovec.vec,
+            message->data->fiovec.count);
+        break;
     case StorageCommandFileSeek:
         message->return_data->bool_value = storage_process_file_seek(
             app,
@@ -604,7 +652,13 @@ void storage_process_message_internal(Storage* app, StorageMessage* message) {
         break;
     }
 
-    furi_semaphore_release(message->semaphore);
+    if(message->async) {
+        StorageAsyncRequest* request = message->async;
+        request->callback(request->file, request->return_data.size_value, request->context);
+        free(request);
+    } else {
+        furi_semaphore_release(message->semaphore);
+    }
 }
 
 void storage_process_message(Storage* app, StorageMessage* message) {
@@ -1,15 +1,52 @@
 #include "log.h"
 #include "check.h"
 #include "mutex.h"
+#include "thread.h"
+#include "kernel.h"
+#include "common_defines.h"
 #include <furi_hal.h>
+#include <string.h>
 
 #define FURI_LOG_LEVEL_DEFAULT FuriLogLevelInfo
 
+// Ring of formatted records, drained by the log thread
+#define FURI_LOG_RECORD_COUNT (16U)
+#define FURI_LOG_TAG_SIZE (24U)
+#define FURI_LOG_TEXT_SIZE (192U)
+#define FURI_LOG_TAG_LEVEL_COUNT (8U)
+
+#define FURI_LOG_THREAD_STACK_SIZE (1024U)
+#define FURI_LOG_THREAD_FLAG_RECORD (1UL << 0)
+
+typedef struct {
+    volatile bool ready;
+    uint8_t level;
+    uint32_t timestamp;
+    char tag[FURI_LOG_TAG_SIZE];
+    char text[FURI_LOG_TEXT_SIZE];
+} FuriLogRecord;
+
+typedef struct {
+    char tag[FURI_LOG_TAG_SIZE];
+    FuriLogLevel level;
+} FuriLogTagLevel;
+
 typedef struct {
     FuriLogLevel log_level;
     FuriLogPuts puts;
     FuriLogTimestamp timestamp;
     FuriMutex* mutex;
+
+    FuriThread* thread;
+    volatile FuriThreadId thread_id;
+    FuriLogRecord records[FURI_LOG_RECORD_COUNT];
+    volatile uint32_t head;
+    volatile uint32_t tail;
+    volatile uint32_t dropped;
+    volatile uint32_t stalled;
+
+    FuriLogTagLevel tag_levels[FURI_LOG_TAG_LEVEL_COUNT];
+    volatile size_t tag_levels_count;
 } FuriLogParams;
 
 static FuriLogParams furi_log;
@@ -22,38 +59,166 @@ void furi_log_init() {
     furi_log.mutex = furi_mutex_alloc(FuriMutexTypeNormal);
 }
 
-void furi_log_print_format(FuriLogLevel level, const char* tag, const char* format, ...) {
-    if(level <= furi_log.log_level &&
-       furi_mutex_acquire(furi_log.mutex, FuriWaitForever) == FuriStatusOk) {
+static void furi_log_get_level_style(FuriLogLevel level, const char** color, const char** letter) {
+    *color = FURI_LOG_CLR_RESET;
+    *letter = " ";
+    switch(level) {
+    case FuriLogLevelError:
+        *color = FURI_LOG_CLR_E;
+        *letter = "E";
+        break;
+    case FuriLogLevelWarn:
+        *color = FURI_LOG_CLR_W;
+        *letter = "W";
+        break;
+    case FuriLogLevelInfo:
+        *color = FURI_LOG_CLR_I;
+        *letter = "I";
+        break;
+    case FuriLogLevelDebug:
+        *color = FURI_LOG_CLR_D;
+        *letter = "D";
+        break;
+    case FuriLogLevelTrace:
+        *color = FURI_LOG_CLR_T;
+        *letter = "T";
+        break;
+    default:
+        break;
+    }
+}
+
+static void furi_log_puts_record(const FuriLogRecord* record) {
+    const char* color;
+    const char* log_letter;
+    furi_log_get_level_style(record->level, &color, &log_letter);
+
+    char prefix[FURI_LOG_TAG_SIZE + 40];
+    snprintf(
+        prefix,
+        sizeof(prefix),
+        "%lu %s[%s][%s] " FURI_LOG_CLR_RESET,
+        record->timestamp,
+        color,
+        log_letter,
+        record->tag);
+
+    furi_log.puts(prefix);
+    furi_log.puts(record->text);
+    furi_log.puts("\r\n");
+}
+
+static bool furi_log_drain(void) {
+    bool drained = false;
+    while(furi_log.tail != furi_log.head) {
+        FuriLogRecord* record = &furi_log.records[furi_log.tail % FURI_LOG_RECORD_COUNT];
+        // Slot is reserved, but writer is still formatting it
+        if(!record->ready) break;
+
+        furi_log_puts_record(record);
+        record->ready = false;
+        furi_log.tail++;
+        drained = true;
+    }
+    return drained;
+}
+
+static int32_t furi_log_thread(void* context) {
+    UNUSED(context);
+
+    while(true) {
+        furi_thread_flags_wait(FURI_LOG_THREAD_FLAG_RECORD, FuriFlagWaitAny, FuriWaitForever);
+        if(furi_mutex_acquire(furi_log.mutex, FuriWaitForever) == FuriStatusOk) {
+            furi_log_drain();
+            furi_mutex_release(furi_log.mutex);
+        }
+    }
+
+    return 0;
+}
+
+void furi_log_start() {
+    furi_assert(furi_log.thread == NULL);
+
+    furi_log.thread =
+        furi_thread_alloc_ex("LogSrv", FURI_LOG_THREAD_STACK_SIZE, furi_log_thread, NULL);
+    furi_thread_mark_as_service(furi_log.thread);
+    furi_thread_set_priority(furi_log.thread, FuriThreadPriorityLowest);
+    furi_thread_start(furi_log.thread);
+    furi_log.thread_id = furi_thread_get_id(furi_log.thread);
+}
+
+static FuriLogLevel furi_log_get_tag_level(const char* tag) {
+    FuriLogLevel level = furi_log.log_level;
+    if(furi_log.tag_levels_count) {
+        FURI_CRITICAL_ENTER();
+        for(size_t i = 0; i < furi_log.tag_levels_count; i++) {
+            if(strncmp(furi_log.tag_levels[i].tag, tag, FURI_LOG_TAG_SIZE - 1) == 0) {
+                level = furi_log.tag_levels[i].level;
+                break;
+            }
+        }
+        FURI_CRITICAL_EXIT();
+    }
+    return level;
+}
+
+static FuriLogRecord* furi_log_reserve(void) {
+    FuriLogRecord* record = NULL;
+    FURI_CRITICAL_ENTER();
+    if(furi_log.head - furi_log.tail < FURI_LOG_RECORD_COUNT) {
+        record = &furi_log.records[furi_log.head % FURI_LOG_RECORD_COUNT];
+        furi_log.head++;
+    }
+    FURI_CRITICAL_EXIT();
+    return record;
+}
+
+static bool furi_log_can_wait(void) {
+    return !furi_is_irq_context() && xTaskGetSchedulerState() == taskSCHEDULER_RUNNING &&
+           furi_thread_get_current_id() != furi_log.thread_id;
+}
+
+static void furi_log_print_deferred(
+    FuriLogLevel level,
+    const char* tag,
+    const char* format,
+    va_list args) {
+    FuriLogRecord* record = furi_log_reserve();
+    if(!record) {
+        if(!furi_log_can_wait()) {
+            furi_log.dropped++;
+            return;
+        }
+        // Ring is full: give log thread some time, caller priority doesn't matter here
+        furi_log.stalled++;
+        do {
+            furi_delay_tick(1);
+            record = furi_log_reserve();
+        } while(!record);
+    }
+
+    record->level = level;
+    record->timestamp = furi_log.timestamp();
+    strlcpy(record->tag, tag, FURI_LOG_TAG_SIZE);
+    vsnprintf(record->text, FURI_LOG_TEXT_SIZE, format, args);
+    record->ready = true;
+
+    furi_thread_flags_set(furi_log.thread_id, FURI_LOG_THREAD_FLAG_RECORD);
+}
+
+static void furi_log_print_direct(
+    FuriLogLevel level,
+    const char* tag,
+    const char* format,
+    va_list args) {
+    if(furi_mutex_acquire(furi_log.mutex, FuriWaitForever) == FuriStatusOk) {
         FuriString* string;
         string = furi_string_alloc();
 
-        const char* color = FURI_LOG_CLR_RESET;
-        const char* log_letter = " ";
-        switch(level) {
-        case FuriLogLevelError:
-            color = FURI_LOG_CLR_E;
-            log_letter = "E";
-            break;
-        case FuriLogLevelWarn:
-            color = FURI_LOG_CLR_W;
-            log_letter = "W";
-            break;
-        case FuriLogLevelInfo:
-            color = FURI_LOG_CLR_I;
-            log_letter = "I";
-            break;
-        case FuriLogLevelDebug:
-            color = FURI_LOG_CLR_D;
-            log_letter = "D";
-            break;
-        case FuriLogLevelTrace:
-            color = FURI_LOG_CLR_T;
-            log_letter = "T";
-            break;
-        default:
-            break;
-        }
+        const char* color;
+        const char* log_letter;
+        furi_log_get_level_style(level, &color, &log_letter);
 
         // Timestamp
         furi_string_printf(
@@ -66,10 +231,7 @@ void furi_log_print_format(FuriLogLevel level, const char* tag, const char* form
         furi_log.puts(furi_string_get_cstr(string));
         furi_string_reset(string);
 
-        va_list args;
-        va_start(args, format);
         furi_string_vprintf(string, format, args);
-        va_end(args);
 
         furi_log.puts(furi_string_get_cstr(string));
         furi_string_free(string);
@@ -80,6 +242,41 @@ void furi_log_print_format(FuriLogLevel level, const char* tag, const char* form
     }
 }
 
+void furi_log_print_format(FuriLogLevel level, const char* tag, const char* format, ...) {
+    if(level > furi_log_get_tag_level(tag)) return;
+
+    va_list args;
+    va_start(args, format);
+    if(furi_log.thread_id && xTaskGetSchedulerState() != taskSCHEDULER_NOT_STARTED) {
+        furi_log_print_deferred(level, tag, format, args);
+    } else {
+        furi_log_print_direct(level, tag, format, args);
+    }
+    va_end(args);
+}
+
+void furi_log_flush() {
+    furi_assert(!furi_is_irq_context());
+    if(!furi_log.thread_id) return;
+
+    while(furi_log.tail != furi_log.head) {
+        furi_thread_flags_set(furi_log.thread_id, FURI_LOG_THREAD_FLAG_RECORD);
+        furi_delay_tick(1);
+    }
+}
+
+void furi_log_flush_unsafe() {
+    // Called with interrupts disabled, writers can't be preempted anymore
+    furi_log_drain();
+}
+
+void furi_log_get_stats(FuriLogStats* stats) {
+    furi_assert(stats);
+    stats->pending = furi_log.head - furi_log.tail;
+    stats->dropped = furi_log.dropped;
+    stats->stalled = furi_log.stalled;
+}
+
 void furi_log_set_level(FuriLogLevel level) {
     if(level == FuriLogLevelDefault) {
         level = FURI_LOG_LEVEL_DEFAULT;
@@ -91,6 +288,37 @@ FuriLogLevel furi_log_get_level(void) {
     return furi_log.log_level;
 }
 
+bool furi_log_set_tag_level(const char* tag, FuriLogLevel level) {
+    furi_assert(tag);
+    bool result = true;
+
+    FURI_CRITICAL_ENTER();
+    size_t index = 0;
+    while(index < furi_log.tag_levels_count &&
+          strncmp(furi_log.tag_levels[index].tag, tag, FURI_LOG_TAG_SIZE - 1) != 0) {
+        index++;
+    }
+
+    if(level == FuriLogLevelDefault) {
+        // Remove override, keep table packed
+        if(index < furi_log.tag_levels_count) {
+            furi_log.tag_levels_count--;
+            furi_log.tag_levels[index] = furi_log.tag_levels[furi_log.tag_levels_count];
+        }
+    } else if(index < furi_log.tag_levels_count) {
+        furi_log.tag_levels[index].level = level;
+    } else if(index < FURI_LOG_TAG_LEVEL_COUNT) {
+        strlcpy(furi_log.tag_levels[index].tag, tag, FURI_LOG_TAG_SIZE);
+        furi_log.tag_levels[index].level = level;
+        furi_log.tag_levels_count++;
+    } else {
+        result = false;
+    }
+    FURI_CRITICAL_EXIT();
+
+    return result;
+}
+
 void furi_log_set_puts(FuriLogPuts puts) {
     furi_assert(puts);
     furi_log.puts = puts;
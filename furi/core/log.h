@@ -6,6 +6,7 @@
 
 #include <stdio.h>
 #include <stdint.h>
+#include <stdbool.h>
 #include <stdarg.h>
 
 #ifdef __cplusplus
@@ -41,9 +42,23 @@ typedef enum {
 typedef void (*FuriLogPuts)(const char* data);
 typedef uint32_t (*FuriLogTimestamp)(void);
 
+typedef struct {
+    uint32_t pending; /**< Records waiting for log thread */
+    uint32_t dropped; /**< Records lost: ring was full and caller was not able to wait */
+    uint32_t stalled; /**< Calls that waited for free space in ring */
+} FuriLogStats;
+
 /** Initialize logging */
 void furi_log_init();
 
+/** Start log thread
+ *
+ * Records are printed synchronously until log thread is started and kernel is
+ * running. After that they are formatted into a static ring by the caller and
+ * printed by low priority log thread, so callers are not stalled on output.
+ */
+void furi_log_start();
+
 /** Print log record
  * 
  * @param level 
@@ -54,6 +69,24 @@ void furi_log_init();
 void furi_log_print_format(FuriLogLevel level, const char* tag, const char* format, ...)
     _ATTRIBUTE((__format__(__printf__, 3, 4)));
 
+/** Wait until all pending records are printed
+ *
+ * Must not be called from ISR.
+ */
+void furi_log_flush();
+
+/** Print pending records from current context
+ *
+ * For crash handler only: must be called with interrupts disabled.
+ */
+void furi_log_flush_unsafe();
+
+/** Get log ring statistics
+ *
+ * @param[out] stats  The statistics
+ */
+void furi_log_get_stats(FuriLogStats* stats);
+
 /** Set log level
  *
  * @param[in]  level  The level
@@ -66,6 +99,15 @@ void furi_log_set_level(FuriLogLevel level);
  */
 FuriLogLevel furi_log_get_level();
 
+/** Set log level for tag, overrides global log level
+ *
+ * @param[in]  tag    The tag
+ * @param[in]  level  The level, FuriLogLevelDefault removes override
+ *
+ * @return     false if there is no space left for new override
+ */
+bool furi_log_set_tag_level(const char* tag, FuriLogLevel level);
+
 /** Set log output callback
  *
  * @param[in]  puts  The puts callback
@@ -90,6 +90,20 @@ static void prvInsertBlockIntoFreeList(BlockLink_t* pxBlockToInsert);
  */
 static void prvHeapInit(void);
 
+/*
+ * Takes a block of at least xWantedSize bytes from the list of free blocks.
+ * Must be called with the scheduler suspended. Returns NULL if there is no
+ * block of adequate size.
+ */
+static void* prvHeapAllocate(size_t xWantedSize);
+
+/*
+ * Same as prvHeapAllocate, but takes the block from the end of the free block
+ * with the highest address. xWantedSize must include the BlockLink_t structure
+ * and be aligned.
+ */
+static void* prvHeapAllocateFromTop(size_t xWantedSize);
+
 /*-----------------------------------------------------------*/
 
 /* The size of the structure placed at the beginning of each allocated memory
@@ -127,6 +141,263 @@ DICT_DEF2(
 static MemmgrHeapThreadDict_t memmgr_heap_thread_dict = {0};
 static volatile uint32_t memmgr_heap_thread_trace_depth = 0;
 
+/* Slab caches for small blocks
+ *
+ * Small allocations are served from fixed size pages taken from the heap, so
+ * that short-lived small blocks do not split large free blocks. Each page
+ * holds objects of one size class and a bitmap of used objects. Empty pages
+ * are returned to the heap, except the last page with free objects of a class,
+ * which is kept until the heap runs out of memory.
+ * Disabled with HEAP_PRINT_DEBUG to keep the trace block-exact.
+ */
+#ifdef HEAP_PRINT_DEBUG
+#define MEMMGR_HEAP_SLAB_ENABLED false
+#else
+#define MEMMGR_HEAP_SLAB_ENABLED true
+#endif
+
+#define MEMMGR_HEAP_SLAB_PAGE_SIZE (1024U)
+#define MEMMGR_HEAP_SLAB_PAGES_MAX (64U)
+#define MEMMGR_HEAP_SLAB_CLASS_COUNT (4U)
+#define MEMMGR_HEAP_SLAB_OBJECT_SIZE_MAX (128U)
+
+static const uint16_t memmgr_heap_slab_object_size[MEMMGR_HEAP_SLAB_CLASS_COUNT] = {
+    16,
+    32,
+    64,
+    128,
+};
+
+typedef struct MemmgrHeapSlabPage MemmgrHeapSlabPage;
+
+struct MemmgrHeapSlabPage {
+    MemmgrHeapSlabPage* next; /*<< The next page of the class with free objects. */
+    MemmgrHeapSlabPage* prev;
+    uint64_t used_mask;
+    uint16_t used;
+    uint8_t class_index;
+};
+
+#define MEMMGR_HEAP_SLAB_HEADER_SIZE \
+    ((sizeof(MemmgrHeapSlabPage) + portBYTE_ALIGNMENT_MASK) & ~((size_t)portBYTE_ALIGNMENT_MASK))
+
+#define MEMMGR_HEAP_SLAB_BLOCK_SIZE (MEMMGR_HEAP_SLAB_PAGE_SIZE + xHeapStructSize)
+
+#define MEMMGR_HEAP_SLAB_CAPACITY(class_index)                    \
+    ((MEMMGR_HEAP_SLAB_PAGE_SIZE - MEMMGR_HEAP_SLAB_HEADER_SIZE) / \
+     memmgr_heap_slab_object_size[class_index])
+
+typedef struct {
+    MemmgrHeapSlabPage* partial; /*<< Pages with free objects. */
+    size_t pages;
+    size_t used;
+    uint32_t hits;
+    uint32_t misses;
+} MemmgrHeapSlabClass;
+
+static MemmgrHeapSlabClass memmgr_heap_slab_classes[MEMMGR_HEAP_SLAB_CLASS_COUNT] = {0};
+
+/* All pages sorted by address, to find the page of an object on free */
+static MemmgrHeapSlabPage* memmgr_heap_slab_pages[MEMMGR_HEAP_SLAB_PAGES_MAX] = {0};
+static size_t memmgr_heap_slab_pages_count = 0;
+
+/* Bytes of slab pages not taken by objects, reported as free heap */
+static size_t memmgr_heap_slab_free_bytes = 0;
+
+static inline BlockLink_t* memmgr_heap_get_block_link(void* pv) {
+    return (void*)(((uint8_t*)pv) - xHeapStructSize);
+}
+
+static inline size_t memmgr_heap_get_block_size(void* pv) {
+    return memmgr_heap_get_block_link(pv)->xBlockSize & ~xBlockAllocatedBit;
+}
+
+/* Index of the first page with address above pv */
+static size_t memmgr_heap_slab_upper_bound(const void* pv) {
+    size_t low = 0;
+    size_t high = memmgr_heap_slab_pages_count;
+    while(low < high) {
+        size_t middle = low + (high - low) / 2;
+        if((const void*)memmgr_heap_slab_pages[middle] <= pv) {
+            low = middle + 1;
+        } else {
+            high = middle;
+        }
+    }
+    return low;
+}
+
+static MemmgrHeapSlabPage* memmgr_heap_slab_find_page(const void* pv) {
+    size_t index = memmgr_heap_slab_upper_bound(pv);
+    if(index == 0) return NULL;
+
+    MemmgrHeapSlabPage* page = memmgr_heap_slab_pages[index - 1];
+    if((const uint8_t*)pv >= (uint8_t*)page + MEMMGR_HEAP_SLAB_PAGE_SIZE) return NULL;
+
+    return page;
+}
+
+/* Object index in the page, or -1 if pv is not an object */
+static int32_t memmgr_heap_slab_object_index(MemmgrHeapSlabPage* page, const void* pv) {
+    const uint8_t* objects = (uint8_t*)page + MEMMGR_HEAP_SLAB_HEADER_SIZE;
+    const size_t object_size = memmgr_heap_slab_object_size[page->class_index];
+
+    if((const uint8_t*)pv < objects) return -1;
+    size_t offset = (const uint8_t*)pv - objects;
+    if(offset % object_size) return -1;
+    size_t index = offset / object_size;
+    if(index >= MEMMGR_HEAP_SLAB_CAPACITY(page->class_index)) return -1;
+
+    return index;
+}
+
+static void
+    memmgr_heap_slab_partial_push(MemmgrHeapSlabClass* slab_class, MemmgrHeapSlabPage* page) {
+    page->prev = NULL;
+    page->next = slab_class->partial;
+    if(page->next) page->next->prev = page;
+    slab_class->partial = page;
+}
+
+static void
+    memmgr_heap_slab_partial_remove(MemmgrHeapSlabClass* slab_class, MemmgrHeapSlabPage* page) {
+    if(page->prev) {
+        page->prev->next = page->next;
+    } else {
+        slab_class->partial = page->next;
+    }
+    if(page->next) page->next->prev = page->prev;
+    page->next = NULL;
+    page->prev = NULL;
+}
+
+static MemmgrHeapSlabPage* memmgr_heap_slab_page_alloc(uint8_t class_index) {
+    if(memmgr_heap_slab_pages_count == MEMMGR_HEAP_SLAB_PAGES_MAX) return NULL;
+
+    // Pages are kept at the top of the heap, away from blocks allocated first-fit
+    MemmgrHeapSlabPage* page = prvHeapAllocateFromTop(MEMMGR_HEAP_SLAB_BLOCK_SIZE);
+    if(page == NULL) return NULL;
+
+    memset(page, 0, MEMMGR_HEAP_SLAB_HEADER_SIZE);
+    page->class_index = class_index;
+
+    size_t index = memmgr_heap_slab_upper_bound(page);
+    memmove(
+        &memmgr_heap_slab_pages[index + 1],
+        &memmgr_heap_slab_pages[index],
+        (memmgr_heap_slab_pages_count - index) * sizeof(MemmgrHeapSlabPage*));
+    memmgr_heap_slab_pages[index] = page;
+    memmgr_heap_slab_pages_count++;
+
+    MemmgrHeapSlabClass* slab_class = &memmgr_heap_slab_classes[class_index];
+    slab_class->pages++;
+    memmgr_heap_slab_partial_push(slab_class, page);
+    memmgr_heap_slab_free_bytes += memmgr_heap_get_block_size(page);
+
+    return page;
+}
+
+static void memmgr_heap_slab_page_free(MemmgrHeapSlabPage* page) {
+    MemmgrHeapSlabClass* slab_class = &memmgr_heap_slab_classes[page->class_index];
+    memmgr_heap_slab_partial_remove(slab_class, page);
+    slab_class->pages--;
+
+    size_t index = memmgr_heap_slab_upper_bound(page) - 1;
+    furi_assert(memmgr_heap_slab_pages[index] == page);
+    memmove(
+        &memmgr_heap_slab_pages[index],
+        &memmgr_heap_slab_pages[index + 1],
+        (memmgr_heap_slab_pages_count - index - 1) * sizeof(MemmgrHeapSlabPage*));
+    memmgr_heap_slab_pages_count--;
+
+    BlockLink_t* pxLink = memmgr_heap_get_block_link(page);
+    pxLink->xBlockSize &= ~xBlockAllocatedBit;
+    memmgr_heap_slab_free_bytes -= pxLink->xBlockSize;
+    xFreeBytesRemaining += pxLink->xBlockSize;
+    memset(page, 0, pxLink->xBlockSize - xHeapStructSize);
+    prvInsertBlockIntoFreeList(pxLink);
+}
+
+/* Release pages kept empty, returns true if any page was released */
+static bool memmgr_heap_slab_release_empty_pages(void) {
+    bool released = false;
+    for(size_t i = 0; i < MEMMGR_HEAP_SLAB_CLASS_COUNT; i++) {
+        // At most one empty page per class
+        MemmgrHeapSlabPage* page = memmgr_heap_slab_classes[i].partial;
+        while(page && page->used != 0) {
+            page = page->next;
+        }
+        if(page) {
+            memmgr_heap_slab_page_free(page);
+            released = true;
+        }
+    }
+    return released;
+}
+
+/* Must be called with the scheduler suspended, returns NULL if size is not served by slabs */
+static void* memmgr_heap_slab_alloc(size_t size, size_t* object_size) {
+    if(size == 0 || size > MEMMGR_HEAP_SLAB_OBJECT_SIZE_MAX) return NULL;
+
+    uint8_t class_index = 0;
+    while(memmgr_heap_slab_object_size[class_index] < size) class_index++;
+    MemmgrHeapSlabClass* slab_class = &memmgr_heap_slab_classes[class_index];
+
+    MemmgrHeapSlabPage* page = slab_class->partial;
+    if(page == NULL) {
+        page = memmgr_heap_slab_page_alloc(class_index);
+        if(page == NULL) {
+            slab_class->misses++;
+            return NULL;
+        }
+    }
+
+    uint32_t index = __builtin_ctzll(~page->used_mask);
+    page->used_mask |= (1ULL << index);
+    page->used++;
+    if(page->used == MEMMGR_HEAP_SLAB_CAPACITY(class_index)) {
+        memmgr_heap_slab_partial_remove(slab_class, page);
+    }
+
+    *object_size = memmgr_heap_slab_object_size[class_index];
+    slab_class->used++;
+    slab_class->hits++;
+    memmgr_heap_slab_free_bytes -= *object_size;
+
+    return (uint8_t*)page + MEMMGR_HEAP_SLAB_HEADER_SIZE + index * (*object_size);
+}
+
+/* Must be called with the scheduler suspended, returns 0 if pv is not a slab object */
+static size_t memmgr_heap_slab_free(void* pv) {
+    MemmgrHeapSlabPage* page = memmgr_heap_slab_find_page(pv);
+    if(page == NULL) return 0;
+
+    int32_t index = memmgr_heap_slab_object_index(page, pv);
+    furi_check(index >= 0);
+    furi_check(page->used_mask & (1ULL << index));
+
+    const uint8_t class_index = page->class_index;
+    const size_t object_size = memmgr_heap_slab_object_size[class_index];
+    MemmgrHeapSlabClass* slab_class = &memmgr_heap_slab_classes[class_index];
+
+    memset(pv, 0, object_size);
+
+    if(page->used == MEMMGR_HEAP_SLAB_CAPACITY(class_index)) {
+        memmgr_heap_slab_partial_push(slab_class, page);
+    }
+    page->used_mask &= ~(1ULL << index);
+    page->used--;
+    slab_class->used--;
+    memmgr_heap_slab_free_bytes += object_size;
+
+    // Keep one page with free objects to avoid page allocation on every alloc/free pair
+    if(page->used == 0 && (slab_class->partial != page || page->next != NULL)) {
+        memmgr_heap_slab_page_free(page);
+    }
+
+    return object_size;
+}
+
 /* Initialize tracing storage on start */
 void memmgr_heap_init() {
     MemmgrHeapThreadDict_init(memmgr_heap_thread_dict);
@@ -172,6 +443,15 @@ size_t memmgr_heap_get_thread_memory(FuriThreadId thread_id) {
                 MemmgrHeapAllocDict_itref_t* data = MemmgrHeapAllocDict_ref(alloc_dict_it);
                 if(data->key != 0) {
                     uint8_t* puc = (uint8_t*)data->key;
+                    MemmgrHeapSlabPage* page = memmgr_heap_slab_find_page(puc);
+                    if(page) {
+                        int32_t index = memmgr_heap_slab_object_index(page, puc);
+                        if(index >= 0 && (page->used_mask & (1ULL << index))) {
+                            leftovers += data->value;
+                        }
+                        continue;
+                    }
+
                     puc -= xHeapStructSize;
                     BlockLink_t* pxLink = (void*)puc;
 
@@ -219,6 +499,42 @@ static inline void traceFREE(void* pointer, size_t size) {
     }
 }
 
+size_t memmgr_heap_get_slab_class_count() {
+    return MEMMGR_HEAP_SLAB_CLASS_COUNT;
+}
+
+void memmgr_heap_get_slab_stats(size_t class_index, MemmgrHeapSlabStats* stats) {
+    furi_check(class_index < MEMMGR_HEAP_SLAB_CLASS_COUNT);
+    furi_assert(stats);
+
+    vTaskSuspendAll();
+    {
+        const MemmgrHeapSlabClass* slab_class = &memmgr_heap_slab_classes[class_index];
+        stats->object_size = memmgr_heap_slab_object_size[class_index];
+        stats->pages = slab_class->pages;
+        stats->objects_used = slab_class->used;
+        stats->objects_total = slab_class->pages * MEMMGR_HEAP_SLAB_CAPACITY(class_index);
+        stats->hits = slab_class->hits;
+        stats->misses = slab_class->misses;
+    }
+    (void)xTaskResumeAll();
+}
+
+size_t memmgr_heap_get_free_block_count() {
+    size_t count = 0;
+    BlockLink_t* pxBlock;
+    vTaskSuspendAll();
+
+    pxBlock = xStart.pxNextFreeBlock;
+    while(pxBlock->pxNextFreeBlock != NULL) {
+        count++;
+        pxBlock = pxBlock->pxNextFreeBlock;
+    }
+
+    xTaskResumeAll();
+    return count;
+}
+
 size_t memmgr_heap_get_max_free_block() {
     size_t max_free_size = 0;
     BlockLink_t* pxBlock;
@@ -336,19 +652,156 @@ static void print_heap_free(void* ptr) {
 #endif
 /*-----------------------------------------------------------*/
 
-void* pvPortMalloc(size_t xWantedSize) {
+static void* prvHeapAllocate(size_t xWantedSize) {
     BlockLink_t *pxBlock, *pxPreviousBlock, *pxNewBlockLink;
     void* pvReturn = NULL;
+
+    /* Check the requested block size is not so large that the top bit is
+    set.  The top bit of the block size member of the BlockLink_t structure
+    is used to determine who owns the block - the application or the
+    kernel, so it must be free. */
+    if((xWantedSize & xBlockAllocatedBit) == 0) {
+        /* The wanted size is increased so it can contain a BlockLink_t
+        structure in addition to the requested amount of bytes. */
+        if(xWantedSize > 0) {
+            xWantedSize += xHeapStructSize;
+
+            /* Ensure that blocks are always aligned to the required number
+            of bytes. */
+            if((xWantedSize & portBYTE_ALIGNMENT_MASK) != 0x00) {
+                /* Byte alignment required. */
+                xWantedSize += (portBYTE_ALIGNMENT - (xWantedSize & portBYTE_ALIGNMENT_MASK));
+                configASSERT((xWantedSize & portBYTE_ALIGNMENT_MASK) == 0);
+            } else {
+                mtCOVERAGE_TEST_MARKER();
+            }
+        } else {
+            mtCOVERAGE_TEST_MARKER();
+        }
+
+        if((xWantedSize > 0) && (xWantedSize <= xFreeBytesRemaining)) {
+            /* Traverse the list from the start (lowest address) block until
+            one of adequate size is found. */
+            pxPreviousBlock = &xStart;
+            pxBlock = xStart.pxNextFreeBlock;
+            while((pxBlock->xBlockSize < xWantedSize) && (pxBlock->pxNextFreeBlock != NULL)) {
+                pxPreviousBlock = pxBlock;
+                pxBlock = pxBlock->pxNextFreeBlock;
+            }
+
+            /* If the end marker was reached then a block of adequate size
+            was not found. */
+            if(pxBlock != pxEnd) {
+                /* Return the memory space pointed to - jumping over the
+                BlockLink_t structure at its start. */
+                pvReturn =
+                    (void*)(((uint8_t*)pxPreviousBlock->pxNextFreeBlock) + xHeapStructSize);
+
+                /* This block is being returned for use so must be taken out
+                of the list of free blocks. */
+                pxPreviousBlock->pxNextFreeBlock = pxBlock->pxNextFreeBlock;
+
+                /* If the block is larger than required it can be split into
+                two. */
+                if((pxBlock->xBlockSize - xWantedSize) > heapMINIMUM_BLOCK_SIZE) {
+                    /* This block is to be split into two.  Create a new
+                    block following the number of bytes requested. The void
+                    cast is used to prevent byte alignment warnings from the
+                    compiler. */
+                    pxNewBlockLink = (void*)(((uint8_t*)pxBlock) + xWantedSize);
+                    configASSERT((((size_t)pxNewBlockLink) & portBYTE_ALIGNMENT_MASK) == 0);
+
+                    /* Calculate the sizes of two blocks split from the
+                    single block. */
+                    pxNewBlockLink->xBlockSize = pxBlock->xBlockSize - xWantedSize;
+                    pxBlock->xBlockSize = xWantedSize;
+
+                    /* Insert the new block into the list of free blocks. */
+                    prvInsertBlockIntoFreeList(pxNewBlockLink);
+                } else {
+                    mtCOVERAGE_TEST_MARKER();
+                }
+
+                xFreeBytesRemaining -= pxBlock->xBlockSize;
+
+                if(xFreeBytesRemaining < xMinimumEverFreeBytesRemaining) {
+                    xMinimumEverFreeBytesRemaining = xFreeBytesRemaining;
+                } else {
+                    mtCOVERAGE_TEST_MARKER();
+                }
+
+                /* The block is being returned - it is allocated and owned
+                by the application and has no "next" block. */
+                pxBlock->xBlockSize |= xBlockAllocatedBit;
+                pxBlock->pxNextFreeBlock = NULL;
+            } else {
+                mtCOVERAGE_TEST_MARKER();
+            }
+        } else {
+            mtCOVERAGE_TEST_MARKER();
+        }
+    } else {
+        mtCOVERAGE_TEST_MARKER();
+    }
+
+    return pvReturn;
+}
+/*-----------------------------------------------------------*/
+
+static void* prvHeapAllocateFromTop(size_t xWantedSize) {
+    BlockLink_t *pxBlock, *pxPreviousBlock;
+    BlockLink_t *pxFoundBlock = NULL, *pxFoundPreviousBlock = NULL;
+
+    configASSERT((xWantedSize & portBYTE_ALIGNMENT_MASK) == 0);
+
+    /* Free blocks are ordered by address, so the last one of adequate size
+    is the highest one. */
+    pxPreviousBlock = &xStart;
+    pxBlock = xStart.pxNextFreeBlock;
+    while(pxBlock != pxEnd) {
+        if(pxBlock->xBlockSize >= xWantedSize) {
+            pxFoundPreviousBlock = pxPreviousBlock;
+            pxFoundBlock = pxBlock;
+        }
+        pxPreviousBlock = pxBlock;
+        pxBlock = pxBlock->pxNextFreeBlock;
+    }
+
+    if(pxFoundBlock == NULL) {
+        return NULL;
+    }
+
+    if((pxFoundBlock->xBlockSize - xWantedSize) > heapMINIMUM_BLOCK_SIZE) {
+        /* Split the found block, its beginning stays in the list of free blocks. */
+        pxFoundBlock->xBlockSize -= xWantedSize;
+        pxBlock = (void*)(((uint8_t*)pxFoundBlock) + pxFoundBlock->xBlockSize);
+        pxBlock->xBlockSize = xWantedSize;
+    } else {
+        pxFoundPreviousBlock->pxNextFreeBlock = pxFoundBlock->pxNextFreeBlock;
+        pxBlock = pxFoundBlock;
+    }
+
+    xFreeBytesRemaining -= pxBlock->xBlockSize;
+
+    if(xFreeBytesRemaining < xMinimumEverFreeBytesRemaining) {
+        xMinimumEverFreeBytesRemaining = xFreeBytesRemaining;
+    }
+
+    pxBlock->xBlockSize |= xBlockAllocatedBit;
+    pxBlock->pxNextFreeBlock = NULL;
+
+    return (void*)(((uint8_t*)pxBlock) + xHeapStructSize);
+}
+/*-----------------------------------------------------------*/
+
+void* pvPortMalloc(size_t xWantedSize) {
+    void* pvReturn = NULL;
     size_t to_wipe = xWantedSize;
 
     if(FURI_IS_IRQ_MODE()) {
         furi_crash("memmgt in ISR");
     }
 
-#ifdef HEAP_PRINT_DEBUG
-    BlockLink_t* print_heap_block = NULL;
-#endif
-
     /* If this is the first call to malloc then the heap will require
         initialisation to setup the list of free blocks. */
     if(pxEnd == NULL) {
@@ -368,103 +821,29 @@ void* pvPortMalloc(size_t xWantedSize) {
 
     vTaskSuspendAll();
     {
-        /* Check the requested block size is not so large that the top bit is
-        set.  The top bit of the block size member of the BlockLink_t structure
-        is used to determine who owns the block - the application or the
-        kernel, so it must be free. */
-        if((xWantedSize & xBlockAllocatedBit) == 0) {
-            /* The wanted size is increased so it can contain a BlockLink_t
-            structure in addition to the requested amount of bytes. */
-            if(xWantedSize > 0) {
-                xWantedSize += xHeapStructSize;
-
-                /* Ensure that blocks are always aligned to the required number
-                of bytes. */
-                if((xWantedSize & portBYTE_ALIGNMENT_MASK) != 0x00) {
-                    /* Byte alignment required. */
-                    xWantedSize += (portBYTE_ALIGNMENT - (xWantedSize & portBYTE_ALIGNMENT_MASK));
-                    configASSERT((xWantedSize & portBYTE_ALIGNMENT_MASK) == 0);
-                } else {
-                    mtCOVERAGE_TEST_MARKER();
-                }
-            } else {
-                mtCOVERAGE_TEST_MARKER();
-            }
+        size_t xAllocatedSize = 0;
 
-            if((xWantedSize > 0) && (xWantedSize <= xFreeBytesRemaining)) {
-                /* Traverse the list from the start (lowest address) block until
-                one of adequate size is found. */
-                pxPreviousBlock = &xStart;
-                pxBlock = xStart.pxNextFreeBlock;
-                while((pxBlock->xBlockSize < xWantedSize) && (pxBlock->pxNextFreeBlock != NULL)) {
-                    pxPreviousBlock = pxBlock;
-                    pxBlock = pxBlock->pxNextFreeBlock;
-                }
-
-                /* If the end marker was reached then a block of adequate size
-                was not found. */
-                if(pxBlock != pxEnd) {
-                    /* Return the memory space pointed to - jumping over the
-                    BlockLink_t structure at its start. */
-                    pvReturn =
-                        (void*)(((uint8_t*)pxPreviousBlock->pxNextFreeBlock) + xHeapStructSize);
-
-                    /* This block is being returned for use so must be taken out
-                    of the list of free blocks. */
-                    pxPreviousBlock->pxNextFreeBlock = pxBlock->pxNextFreeBlock;
-
-                    /* If the block is larger than required it can be split into
-                    two. */
-                    if((pxBlock->xBlockSize - xWantedSize) > heapMINIMUM_BLOCK_SIZE) {
-                        /* This block is to be split into two.  Create a new
-                        block following the number of bytes requested. The void
-                        cast is used to prevent byte alignment warnings from the
-                        compiler. */
-                        pxNewBlockLink = (void*)(((uint8_t*)pxBlock) + xWantedSize);
-                        configASSERT((((size_t)pxNewBlockLink) & portBYTE_ALIGNMENT_MASK) == 0);
-
-                        /* Calculate the sizes of two blocks split from the
-                        single block. */
-                        pxNewBlockLink->xBlockSize = pxBlock->xBlockSize - xWantedSize;
-                        pxBlock->xBlockSize = xWantedSize;
-
-                        /* Insert the new block into the list of free blocks. */
-                        prvInsertBlockIntoFreeList(pxNewBlockLink);
-                    } else {
-                        mtCOVERAGE_TEST_MARKER();
-                    }
-
-                    xFreeBytesRemaining -= pxBlock->xBlockSize;
-
-                    if(xFreeBytesRemaining < xMinimumEverFreeBytesRemaining) {
-                        xMinimumEverFreeBytesRemaining = xFreeBytesRemaining;
-                    } else {
-                        mtCOVERAGE_TEST_MARKER();
-                    }
-
-                    /* The block is being returned - it is allocated and owned
-                    by the application and has no "next" block. */
-                    pxBlock->xBlockSize |= xBlockAllocatedBit;
-                    pxBlock->pxNextFreeBlock = NULL;
+        if(MEMMGR_HEAP_SLAB_ENABLED) {
+            pvReturn = memmgr_heap_slab_alloc(xWantedSize, &xAllocatedSize);
+        }
 
-#ifdef HEAP_PRINT_DEBUG
-                    print_heap_block = pxBlock;
-#endif
-                } else {
-                    mtCOVERAGE_TEST_MARKER();
-                }
-            } else {
-                mtCOVERAGE_TEST_MARKER();
+        if(pvReturn == NULL) {
+            pvReturn = prvHeapAllocate(xWantedSize);
+            if(pvReturn == NULL && MEMMGR_HEAP_SLAB_ENABLED &&
+               memmgr_heap_slab_release_empty_pages()) {
+                pvReturn = prvHeapAllocate(xWantedSize);
+            }
+            if(pvReturn) {
+                xAllocatedSize = memmgr_heap_get_block_size(pvReturn);
             }
-        } else {
-            mtCOVERAGE_TEST_MARKER();
         }
 
-        traceMALLOC(pvReturn, xWantedSize);
+        traceMALLOC(pvReturn, xAllocatedSize);
     }
     (void)xTaskResumeAll();
 
 #ifdef HEAP_PRINT_DEBUG
+    BlockLink_t* print_heap_block = memmgr_heap_get_block_link(pvReturn);
     print_heap_malloc(print_heap_block, print_heap_block->xBlockSize & ~xBlockAllocatedBit);
 #endif
 
@@ -496,6 +875,21 @@ void vPortFree(void* pv) {
     }
 
     if(pv != NULL) {
+        if(MEMMGR_HEAP_SLAB_ENABLED) {
+            size_t object_size = 0;
+            vTaskSuspendAll();
+            {
+                object_size = memmgr_heap_slab_free(pv);
+                if(object_size) {
+                    traceFREE(pv, object_size);
+                }
+            }
+            (void)xTaskResumeAll();
+            if(object_size) {
+                return;
+            }
+        }
+
         /* The memory being freed will have an BlockLink_t structure immediately
         before it. */
         puc -= xHeapStructSize;
@@ -550,8 +944,10 @@ size_t xPortGetTotalHeapSize(void) {
 }
 /*-----------------------------------------------------------*/
 
+/* Free space in slab pages is counted as free, so that the value only depends
+on allocated blocks and not on the number of pages held by slab caches. */
 size_t xPortGetFreeHeapSize(void) {
-    return xFreeBytesRemaining;
+    return xFreeBytesRemaining + memmgr_heap_slab_free_bytes;
 }
 /*-----------------------------------------------------------*/
 
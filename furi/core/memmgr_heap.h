@@ -14,6 +14,16 @@ extern "C" {
 
 #define MEMMGR_HEAP_UNKNOWN 0xFFFFFFFF
 
+/** Slab cache statistics of one size class */
+typedef struct {
+    size_t object_size; /**< Object size of the class, bytes */
+    size_t pages; /**< Pages held by the class */
+    size_t objects_used; /**< Objects allocated right now */
+    size_t objects_total; /**< Objects that fit in the held pages */
+    uint32_t hits; /**< Allocations served by the class */
+    uint32_t misses; /**< Allocations passed to the heap because no page was available */
+} MemmgrHeapSlabStats;
+
 /** Memmgr heap enable thread allocation tracking
  *
  * @param      thread_id  - thread id to track
@@ -40,6 +50,29 @@ size_t memmgr_heap_get_thread_memory(FuriThreadId taks_handle);
  */
 size_t memmgr_heap_get_max_free_block();
 
+/** Memmgr heap get the number of free blocks on the heap
+ *
+ * Together with the max free block size it shows the heap fragmentation.
+ *
+ * @return     size_t free blocks count
+ */
+size_t memmgr_heap_get_free_block_count();
+
+/** Memmgr heap get the number of slab cache size classes
+ *
+ * Allocations up to the largest class object size are served by slab caches.
+ *
+ * @return     size_t size classes count
+ */
+size_t memmgr_heap_get_slab_class_count();
+
+/** Memmgr heap get slab cache statistics
+ *
+ * @param      class_index  size class index, less than memmgr_heap_get_slab_class_count()
+ * @param      stats        statistics to fill
+ */
+void memmgr_heap_get_slab_stats(size_t class_index, MemmgrHeapSlabStats* stats);
+
 /** Print the address and size of all free blocks to stdout
  */
 void memmgr_heap_printf_free_blocks();
@@ -21,6 +21,8 @@ void furi_run() {
     NVIC_SetPriority(SVCall_IRQn, 0U);
 #endif
 
+    furi_log_start();
+
     /* Start the kernel scheduler */
     vTaskStartScheduler();
 }
@@ -7,11 +7,15 @@
 #include "flipper_format_i.h"
 #include "flipper_format_stream.h"
 #include "flipper_format_stream_i.h"
+#include "flipper_format_key_index.h"
 
 /********************************** Private **********************************/
 struct FlipperFormat {
     Stream* stream;
     bool strict_mode;
+    FlipperFormatKeyIndex* key_index;
+    bool array_pending;
+    FlipperStreamPacked array_packed;
 };
 
 static const char* const flipper_format_filetype_key = "Filetype";
@@ -21,12 +25,27 @@ Stream* flipper_format_get_raw_stream(FlipperFormat* flipper_format) {
     return flipper_format->stream;
 }
 
+static void flipper_format_index_invalidate(FlipperFormat* flipper_format) {
+    if(flipper_format->key_index) {
+        flipper_format_key_index_reset(flipper_format->key_index);
+    }
+}
+
+static void flipper_format_index_seek(FlipperFormat* flipper_format, const char* key) {
+    // Strict mode must not skip other keys
+    if(flipper_format->key_index && !flipper_format->strict_mode) {
+        flipper_format_key_index_seek(flipper_format->key_index, flipper_format->stream, key);
+    }
+}
+
 /********************************** Public **********************************/
 
 FlipperFormat* flipper_format_string_alloc() {
     FlipperFormat* flipper_format = malloc(sizeof(FlipperFormat));
     flipper_format->stream = string_stream_alloc();
     flipper_format->strict_mode = false;
+    flipper_format->key_index = NULL;
+    flipper_format->array_pending = false;
     return flipper_format;
 }
 
@@ -34,6 +53,8 @@ FlipperFormat* flipper_format_file_alloc(Storage* storage) {
     FlipperFormat* flipper_format = malloc(sizeof(FlipperFormat));
     flipper_format->stream = file_stream_alloc(storage);
     flipper_format->strict_mode = false;
+    flipper_format->key_index = NULL;
+    flipper_format->array_pending = false;
     return flipper_format;
 }
 
@@ -41,22 +62,27 @@ FlipperFormat* flipper_format_buffered_file_alloc(Storage* storage) {
     FlipperFormat* flipper_format = malloc(sizeof(FlipperFormat));
     flipper_format->stream = buffered_file_stream_alloc(storage);
     flipper_format->strict_mode = false;
+    flipper_format->key_index = NULL;
+    flipper_format->array_pending = false;
     return flipper_format;
 }
 
 bool flipper_format_file_open_existing(FlipperFormat* flipper_format, const char* path) {
     furi_assert(flipper_format);
+    flipper_format_index_invalidate(flipper_format);
     return file_stream_open(flipper_format->stream, path, FSAM_READ_WRITE, FSOM_OPEN_EXISTING);
 }
 
 bool flipper_format_buffered_file_open_existing(FlipperFormat* flipper_format, const char* path) {
     furi_assert(flipper_format);
+    flipper_format_index_invalidate(flipper_format);
     return buffered_file_stream_open(
         flipper_format->stream, path, FSAM_READ_WRITE, FSOM_OPEN_EXISTING);
 }
 
 bool flipper_format_file_open_append(FlipperFormat* flipper_format, const char* path) {
     furi_assert(flipper_format);
+    flipper_format_index_invalidate(flipper_format);
 
     bool result =
         file_stream_open(flipper_format->stream, path, FSAM_READ_WRITE, FSOM_OPEN_APPEND);
@@ -88,26 +114,33 @@ bool flipper_format_file_open_append(FlipperFormat* flipper_format, const char*
 
 bool flipper_format_file_open_always(FlipperFormat* flipper_format, const char* path) {
     furi_assert(flipper_format);
+    flipper_format_index_invalidate(flipper_format);
     return file_stream_open(flipper_format->stream, path, FSAM_READ_WRITE, FSOM_CREATE_ALWAYS);
 }
 
 bool flipper_format_file_open_new(FlipperFormat* flipper_format, const char* path) {
     furi_assert(flipper_format);
+    flipper_format_index_invalidate(flipper_format);
     return file_stream_open(flipper_format->stream, path, FSAM_READ_WRITE, FSOM_CREATE_NEW);
 }
 
 bool flipper_format_file_close(FlipperFormat* flipper_format) {
     furi_assert(flipper_format);
+    flipper_format_index_invalidate(flipper_format);
     return file_stream_close(flipper_format->stream);
 }
 
 bool flipper_format_buffered_file_close(FlipperFormat* flipper_format) {
     furi_assert(flipper_format);
+    flipper_format_index_invalidate(flipper_format);
     return buffered_file_stream_close(flipper_format->stream);
 }
 
 void flipper_format_free(FlipperFormat* flipper_format) {
     furi_assert(flipper_format);
+    if(flipper_format->key_index) {
+        flipper_format_key_index_free(flipper_format->key_index);
+    }
     stream_free(flipper_format->stream);
     free(flipper_format);
 }
@@ -116,6 +149,16 @@ void flipper_format_set_strict_mode(FlipperFormat* flipper_format, bool strict_m
     flipper_format->strict_mode = strict_mode;
 }
 
+void flipper_format_set_key_index(FlipperFormat* flipper_format, bool key_index) {
+    furi_assert(flipper_format);
+    if(key_index && !flipper_format->key_index) {
+        flipper_format->key_index = flipper_format_key_index_alloc();
+    } else if(!key_index && flipper_format->key_index) {
+        flipper_format_key_index_free(flipper_format->key_index);
+        flipper_format->key_index = NULL;
+    }
+}
+
 bool flipper_format_rewind(FlipperFormat* flipper_format) {
     furi_assert(flipper_format);
     return stream_rewind(flipper_format->stream);
@@ -129,6 +172,7 @@ bool flipper_format_seek_to_end(FlipperFormat* flipper_format) {
 bool flipper_format_key_exist(FlipperFormat* flipper_format, const char* key) {
     size_t pos = stream_tell(flipper_format->stream);
     stream_seek(flipper_format->stream, 0, StreamOffsetFromStart);
+    flipper_format_index_seek(flipper_format, key);
     bool result = flipper_format_stream_seek_to_key(flipper_format->stream, key, false);
     stream_seek(flipper_format->stream, pos, StreamOffsetFromStart);
 
@@ -168,12 +212,84 @@ bool flipper_format_get_value_count(
     const char* key,
     uint32_t* count) {
     furi_assert(flipper_format);
-    return flipper_format_stream_get_value_count(
+    // Value count must not move the stream, including the index seek
+    size_t position = stream_tell(flipper_format->stream);
+    flipper_format_index_seek(flipper_format, key);
+    bool result = flipper_format_stream_get_value_count(
         flipper_format->stream, key, count, flipper_format->strict_mode);
+    if(!stream_seek(flipper_format->stream, position, StreamOffsetFromStart)) result = false;
+    return result;
+}
+
+bool flipper_format_read_array_begin(FlipperFormat* flipper_format, const char* key) {
+    furi_assert(flipper_format);
+    flipper_format_index_seek(flipper_format, key);
+    flipper_format->array_packed.count = 0;
+    flipper_format->array_packed.position = 0;
+    flipper_format->array_pending = flipper_format_stream_seek_to_key(
+        flipper_format->stream, key, flipper_format->strict_mode);
+    return flipper_format->array_pending;
+}
+
+static bool flipper_format_read_array(
+    FlipperFormat* flipper_format,
+    FlipperStreamValue type,
+    void* data,
+    const uint16_t data_size,
+    uint16_t* data_read) {
+    furi_assert(flipper_format);
+    *data_read = 0;
+    if(!flipper_format->array_pending) return true;
+
+    size_t values_read = 0;
+    bool last = false;
+    bool result = flipper_format_stream_read_values(
+        flipper_format->stream,
+        type,
+        data,
+        data_size,
+        &values_read,
+        &last,
+        &flipper_format->array_packed);
+    *data_read = values_read;
+
+    if(!result || last) {
+        flipper_format->array_pending = false;
+    }
+
+    return result;
+}
+
+bool flipper_format_read_array_hex(
+    FlipperFormat* flipper_format,
+    uint8_t* data,
+    const uint16_t data_size,
+    uint16_t* data_read) {
+    return flipper_format_read_array(
+        flipper_format, FlipperStreamValueHex, data, data_size, data_read);
+}
+
+bool flipper_format_read_array_int32(
+    FlipperFormat* flipper_format,
+    int32_t* data,
+    const uint16_t data_size,
+    uint16_t* data_read) {
+    return flipper_format_read_array(
+        flipper_format, FlipperStreamValueInt32, data, data_size, data_read);
+}
+
+bool flipper_format_read_array_uint32(
+    FlipperFormat* flipper_format,
+    uint32_t* data,
+    const uint16_t data_size,
+    uint16_t* data_read) {
+    return flipper_format_read_array(
+        flipper_format, FlipperStreamValueUint32, data, data_size, data_read);
 }
 
 bool flipper_format_read_string(FlipperFormat* flipper_format, const char* key, FuriString* data) {
     furi_assert(flipper_format);
+    flipper_format_index_seek(flipper_format, key);
     return flipper_format_stream_read_value_line(
         flipper_format->stream, key, FlipperStreamValueStr, data, 1, flipper_format->strict_mode);
 }
@@ -186,6 +302,7 @@ bool flipper_format_write_string(FlipperFormat* flipper_format, const char* key,
         .data = furi_string_get_cstr(data),
         .data_size = 1,
     };
+    flipper_format_index_invalidate(flipper_format);
     bool result = flipper_format_stream_write_value_line(flipper_format->stream, &write_data);
     return result;
 }
@@ -201,6 +318,7 @@ bool flipper_format_write_string_cstr(
         .data = data,
         .data_size = 1,
     };
+    flipper_format_index_invalidate(flipper_format);
     bool result = flipper_format_stream_write_value_line(flipper_format->stream, &write_data);
     return result;
 }
@@ -211,6 +329,7 @@ bool flipper_format_read_hex_uint64(
     uint64_t* data,
     const uint16_t data_size) {
     furi_assert(flipper_format);
+    flipper_format_index_seek(flipper_format, key);
     return flipper_format_stream_read_value_line(
         flipper_format->stream,
         key,
@@ -232,6 +351,7 @@ bool flipper_format_write_hex_uint64(
         .data = data,
         .data_size = data_size,
     };
+    flipper_format_index_invalidate(flipper_format);
     bool result = flipper_format_stream_write_value_line(flipper_format->stream, &write_data);
     return result;
 }
@@ -242,6 +362,7 @@ bool flipper_format_read_uint32(
     uint32_t* data,
     const uint16_t data_size) {
     furi_assert(flipper_format);
+    flipper_format_index_seek(flipper_format, key);
     return flipper_format_stream_read_value_line(
         flipper_format->stream,
         key,
@@ -263,6 +384,7 @@ bool flipper_format_write_uint32(
         .data = data,
         .data_size = data_size,
     };
+    flipper_format_index_invalidate(flipper_format);
     bool result = flipper_format_stream_write_value_line(flipper_format->stream, &write_data);
     return result;
 }
@@ -272,6 +394,7 @@ bool flipper_format_read_int32(
     const char* key,
     int32_t* data,
     const uint16_t data_size) {
+    flipper_format_index_seek(flipper_format, key);
     return flipper_format_stream_read_value_line(
         flipper_format->stream,
         key,
@@ -293,6 +416,24 @@ bool flipper_format_write_int32(
         .data = data,
         .data_size = data_size,
     };
+    flipper_format_index_invalidate(flipper_format);
+    bool result = flipper_format_stream_write_value_line(flipper_format->stream, &write_data);
+    return result;
+}
+
+bool flipper_format_write_int32_packed(
+    FlipperFormat* flipper_format,
+    const char* key,
+    const int32_t* data,
+    const uint16_t data_size) {
+    furi_assert(flipper_format);
+    FlipperStreamWriteData write_data = {
+        .key = key,
+        .type = FlipperStreamValueInt32Packed,
+        .data = data,
+        .data_size = data_size,
+    };
+    flipper_format_index_invalidate(flipper_format);
     bool result = flipper_format_stream_write_value_line(flipper_format->stream, &write_data);
     return result;
 }
@@ -302,6 +443,7 @@ bool flipper_format_read_bool(
     const char* key,
     bool* data,
     const uint16_t data_size) {
+    flipper_format_index_seek(flipper_format, key);
     return flipper_format_stream_read_value_line(
         flipper_format->stream,
         key,
@@ -323,6 +465,7 @@ bool flipper_format_write_bool(
         .data = data,
         .data_size = data_size,
     };
+    flipper_format_index_invalidate(flipper_format);
     bool result = flipper_format_stream_write_value_line(flipper_format->stream, &write_data);
     return result;
 }
@@ -332,6 +475,7 @@ bool flipper_format_read_float(
     const char* key,
     float* data,
     const uint16_t data_size) {
+    flipper_format_index_seek(flipper_format, key);
     return flipper_format_stream_read_value_line(
         flipper_format->stream,
         key,
@@ -353,6 +497,7 @@ bool flipper_format_write_float(
         .data = data,
         .data_size = data_size,
     };
+    flipper_format_index_invalidate(flipper_format);
     bool result = flipper_format_stream_write_value_line(flipper_format->stream, &write_data);
     return result;
 }
@@ -362,6 +507,7 @@ bool flipper_format_read_hex(
     const char* key,
     uint8_t* data,
     const uint16_t data_size) {
+    flipper_format_index_seek(flipper_format, key);
     return flipper_format_stream_read_value_line(
         flipper_format->stream,
         key,
@@ -383,6 +529,7 @@ bool flipper_format_write_hex(
         .data = data,
         .data_size = data_size,
     };
+    flipper_format_index_invalidate(flipper_format);
     bool result = flipper_format_stream_write_value_line(flipper_format->stream, &write_data);
     return result;
 }
@@ -394,6 +541,7 @@ bool flipper_format_write_comment(FlipperFormat* flipper_format, FuriString* dat
 
 bool flipper_format_write_comment_cstr(FlipperFormat* flipper_format, const char* data) {
     furi_assert(flipper_format);
+    flipper_format_index_invalidate(flipper_format);
     return flipper_format_stream_write_comment_cstr(flipper_format->stream, data);
 }
 
@@ -405,6 +553,7 @@ bool flipper_format_delete_key(FlipperFormat* flipper_format, const char* key) {
         .data = NULL,
         .data_size = 0,
     };
+    flipper_format_index_invalidate(flipper_format);
     bool result = flipper_format_stream_delete_key_and_write(
         flipper_format->stream, &write_data, flipper_format->strict_mode);
     return result;
@@ -418,6 +567,7 @@ bool flipper_format_update_string(FlipperFormat* flipper_format, const char* key
         .data = furi_string_get_cstr(data),
         .data_size = 1,
     };
+    flipper_format_index_invalidate(flipper_format);
     bool result = flipper_format_stream_delete_key_and_write(
         flipper_format->stream, &write_data, flipper_format->strict_mode);
     return result;
@@ -434,6 +584,7 @@ bool flipper_format_update_string_cstr(
         .data = data,
         .data_size = 1,
     };
+    flipper_format_index_invalidate(flipper_format);
     bool result = flipper_format_stream_delete_key_and_write(
         flipper_format->stream, &write_data, flipper_format->strict_mode);
     return result;
@@ -451,6 +602,7 @@ bool flipper_format_update_uint32(
         .data = data,
         .data_size = data_size,
     };
+    flipper_format_index_invalidate(flipper_format);
     bool result = flipper_format_stream_delete_key_and_write(
         flipper_format->stream, &write_data, flipper_format->strict_mode);
     return result;
@@ -467,6 +619,7 @@ bool flipper_format_update_int32(
         .data = data,
         .data_size = data_size,
     };
+    flipper_format_index_invalidate(flipper_format);
     bool result = flipper_format_stream_delete_key_and_write(
         flipper_format->stream, &write_data, flipper_format->strict_mode);
     return result;
@@ -483,6 +636,7 @@ bool flipper_format_update_bool(
         .data = data,
         .data_size = data_size,
     };
+    flipper_format_index_invalidate(flipper_format);
     bool result = flipper_format_stream_delete_key_and_write(
         flipper_format->stream, &write_data, flipper_format->strict_mode);
     return result;
@@ -499,6 +653,7 @@ bool flipper_format_update_float(
         .data = data,
         .data_size = data_size,
     };
+    flipper_format_index_invalidate(flipper_format);
     bool result = flipper_format_stream_delete_key_and_write(
         flipper_format->stream, &write_data, flipper_format->strict_mode);
     return result;
@@ -515,6 +670,7 @@ bool flipper_format_update_hex(
         .data = data,
         .data_size = data_size,
     };
+    flipper_format_index_invalidate(flipper_format);
     bool result = flipper_format_stream_delete_key_and_write(
         flipper_format->stream, &write_data, flipper_format->strict_mode);
     return result;
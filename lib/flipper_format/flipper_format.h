@@ -23,6 +23,10 @@
  * Hex: A4 B3 C2 D1 12 FF
  * ~~~~~~~~~~~~~~~~~~~~~
  * 
+ * Int32 and Uint32 arrays can also be stored packed, as groups of zigzag varints in base64
+ * prefixed with "~", see flipper_format_write_int32_packed. Packed and plain values can be
+ * mixed on one line, they are unpacked transparently when reading int32 and uint32 values.
+ * 
  * End of line is LF when writing, but CR is supported when reading.
  * 
  * The library is designed in such a way that comments and field values are completely ignored when searching for keys, that is, they do not consume memory.
@@ -194,6 +198,17 @@ void flipper_format_free(FlipperFormat* flipper_format);
  */
 void flipper_format_set_strict_mode(FlipperFormat* flipper_format, bool strict_mode);
 
+/**
+ * Enable key offset index.
+ * Offsets of all keys are collected in one pass on the next read, so reads can seek
+ * directly to the key instead of parsing every line in between. Index is rebuilt after
+ * FlipperFormat writes and updates, and is not used in strict mode. Do not modify
+ * the raw stream while index is enabled.
+ * @param flipper_format Pointer to a FlipperFormat instance
+ * @param key_index True to enable index. False by default.
+ */
+void flipper_format_set_key_index(FlipperFormat* flipper_format, bool key_index);
+
 /**
  * Rewind the RW pointer.
  * @param flipper_format Pointer to a FlipperFormat instance
@@ -265,6 +280,58 @@ bool flipper_format_get_value_count(
     const char* key,
     uint32_t* count);
 
+/**
+ * Start reading values by key in chunks, for value lines that are too long
+ * to be read into one buffer. Values are read with flipper_format_read_array_*
+ * until data_read is 0. Do not use other functions until the array is read.
+ * @param flipper_format Pointer to a FlipperFormat instance
+ * @param key Key
+ * @return True if key is found
+ */
+bool flipper_format_read_array_begin(FlipperFormat* flipper_format, const char* key);
+
+/**
+ * Read next chunk of hex array, see flipper_format_read_array_begin
+ * @param flipper_format Pointer to a FlipperFormat instance
+ * @param data Values
+ * @param data_size Maximum values count
+ * @param data_read Values count, less than data_size only at the end of the array
+ * @return True on success
+ */
+bool flipper_format_read_array_hex(
+    FlipperFormat* flipper_format,
+    uint8_t* data,
+    const uint16_t data_size,
+    uint16_t* data_read);
+
+/**
+ * Read next chunk of int32 array, see flipper_format_read_array_begin
+ * @param flipper_format Pointer to a FlipperFormat instance
+ * @param data Values
+ * @param data_size Maximum values count
+ * @param data_read Values count, less than data_size only at the end of the array
+ * @return True on success
+ */
+bool flipper_format_read_array_int32(
+    FlipperFormat* flipper_format,
+    int32_t* data,
+    const uint16_t data_size,
+    uint16_t* data_read);
+
+/**
+ * Read next chunk of uint32 array, see flipper_format_read_array_begin
+ * @param flipper_format Pointer to a FlipperFormat instance
+ * @param data Values
+ * @param data_size Maximum values count
+ * @param data_read Values count, less than data_size only at the end of the array
+ * @return True on success
+ */
+bool flipper_format_read_array_uint32(
+    FlipperFormat* flipper_format,
+    uint32_t* data,
+    const uint16_t data_size,
+    uint16_t* data_read);
+
 /**
  * Read a string by key
  * @param flipper_format Pointer to a FlipperFormat instance
@@ -379,6 +446,21 @@ bool flipper_format_write_int32(
     const int32_t* data,
     const uint16_t data_size);
 
+/**
+ * Write key and array of int32 in packed form, for long arrays like raw timings.
+ * Values must be in varint_int32_pack range, non-negative ones can be read as uint32.
+ * @param flipper_format Pointer to a FlipperFormat instance
+ * @param key Key
+ * @param data Value
+ * @param data_size Values count
+ * @return True on success
+ */
+bool flipper_format_write_int32_packed(
+    FlipperFormat* flipper_format,
+    const char* key,
+    const int32_t* data,
+    const uint16_t data_size);
+
 /**
  * Read array of bool by key
  * @param flipper_format Pointer to a FlipperFormat instance
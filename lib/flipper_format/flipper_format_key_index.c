@@ -0,0 +1,183 @@
+#include <furi.h>
+#include <m-array.h>
+#include "flipper_format_key_index.h"
+#include "flipper_format_stream_i.h"
+
+#define TAG "FlipperFormatKeyIndex"
+
+// Files with more keys are read without index, 8 bytes per key
+#define FLIPPER_FORMAT_KEY_INDEX_MAX_SIZE (2048)
+#define FLIPPER_FORMAT_KEY_INDEX_BUFFER_SIZE (64)
+
+typedef struct {
+    uint32_t offset;
+    uint16_t hash;
+    uint16_t length;
+} FlipperFormatKeyIndexEntry;
+
+ARRAY_DEF(FlipperFormatKeyIndexArray, FlipperFormatKeyIndexEntry, M_POD_OPLIST)
+
+typedef enum {
+    FlipperFormatKeyIndexStateEmpty,
+    FlipperFormatKeyIndexStateReady,
+    FlipperFormatKeyIndexStateUnavailable,
+} FlipperFormatKeyIndexState;
+
+struct FlipperFormatKeyIndex {
+    FlipperFormatKeyIndexArray_t entries;
+    FlipperFormatKeyIndexState state;
+};
+
+typedef struct {
+    uint32_t hash;
+    uint16_t length;
+} FlipperFormatKeyHash;
+
+static inline void flipper_format_key_hash_reset(FlipperFormatKeyHash* key_hash) {
+    // FNV-1a
+    key_hash->hash = 2166136261UL;
+    key_hash->length = 0;
+}
+
+static inline void flipper_format_key_hash_push(FlipperFormatKeyHash* key_hash, uint8_t data) {
+    key_hash->hash = (key_hash->hash ^ data) * 16777619UL;
+    if(key_hash->length < UINT16_MAX) key_hash->length++;
+}
+
+static inline uint16_t flipper_format_key_hash_get(FlipperFormatKeyHash* key_hash) {
+    return (uint16_t)(key_hash->hash ^ (key_hash->hash >> 16));
+}
+
+FlipperFormatKeyIndex* flipper_format_key_index_alloc() {
+    FlipperFormatKeyIndex* key_index = malloc(sizeof(FlipperFormatKeyIndex));
+    FlipperFormatKeyIndexArray_init(key_index->entries);
+    key_index->state = FlipperFormatKeyIndexStateEmpty;
+    return key_index;
+}
+
+void flipper_format_key_index_free(FlipperFormatKeyIndex* key_index) {
+    furi_assert(key_index);
+    FlipperFormatKeyIndexArray_clear(key_index->entries);
+    free(key_index);
+}
+
+void flipper_format_key_index_reset(FlipperFormatKeyIndex* key_index) {
+    furi_assert(key_index);
+    FlipperFormatKeyIndexArray_reset(key_index->entries);
+    key_index->state = FlipperFormatKeyIndexStateEmpty;
+}
+
+// Same key rules as flipper_format_stream_read_valid_key
+static bool flipper_format_key_index_build(FlipperFormatKeyIndex* key_index, Stream* stream) {
+    uint8_t buffer[FLIPPER_FORMAT_KEY_INDEX_BUFFER_SIZE];
+    FlipperFormatKeyHash key_hash;
+    flipper_format_key_hash_reset(&key_hash);
+
+    bool accumulate = true;
+    bool new_line = true;
+    uint32_t line_offset = 0;
+    uint32_t offset = 0;
+    bool result = stream_rewind(stream);
+
+    while(result) {
+        size_t was_read = stream_read(stream, buffer, FLIPPER_FORMAT_KEY_INDEX_BUFFER_SIZE);
+        if(was_read == 0) {
+            result = stream_eof(stream);
+            break;
+        }
+
+        for(size_t i = 0; i < was_read; i++, offset++) {
+            uint8_t data = buffer[i];
+            if(data == flipper_format_eoln) {
+                flipper_format_key_hash_reset(&key_hash);
+                accumulate = true;
+                new_line = true;
+                line_offset = offset + 1;
+            } else if(data == flipper_format_eolr) {
+                // ignore
+            } else if(data == flipper_format_comment && new_line) {
+                accumulate = false;
+                new_line = false;
+            } else if(data == flipper_format_delimiter) {
+                if(!new_line && accumulate) {
+                    if(FlipperFormatKeyIndexArray_size(key_index->entries) >=
+                       FLIPPER_FORMAT_KEY_INDEX_MAX_SIZE) {
+                        FURI_LOG_W(TAG, "Too many keys, index disabled");
+                        result = false;
+                        break;
+                    }
+                    FlipperFormatKeyIndexEntry* entry =
+                        FlipperFormatKeyIndexArray_push_new(key_index->entries);
+                    entry->offset = line_offset;
+                    entry->hash = flipper_format_key_hash_get(&key_hash);
+                    entry->length = key_hash.length;
+                }
+                accumulate = false;
+                new_line = false;
+            } else {
+                new_line = false;
+                if(accumulate) {
+                    flipper_format_key_hash_push(&key_hash, data);
+                }
+            }
+        }
+    }
+
+    return result;
+}
+
+bool flipper_format_key_index_seek(
+    FlipperFormatKeyIndex* key_index,
+    Stream* stream,
+    const char* key) {
+    furi_assert(key_index);
+    furi_assert(key);
+
+    if(key_index->state == FlipperFormatKeyIndexStateEmpty) {
+        size_t position = stream_tell(stream);
+        bool built = flipper_format_key_index_build(key_index, stream);
+        if(!stream_seek(stream, position, StreamOffsetFromStart)) built = false;
+
+        if(built) {
+            // Release growth slack
+            FlipperFormatKeyIndexArray_reserve(key_index->entries, 0);
+            key_index->state = FlipperFormatKeyIndexStateReady;
+        } else {
+            FlipperFormatKeyIndexArray_reset(key_index->entries);
+            key_index->state = FlipperFormatKeyIndexStateUnavailable;
+        }
+    }
+
+    if(key_index->state != FlipperFormatKeyIndexStateReady) return false;
+
+    FlipperFormatKeyHash key_hash;
+    flipper_format_key_hash_reset(&key_hash);
+    for(const char* c = key; *c; c++) {
+        flipper_format_key_hash_push(&key_hash, *c);
+    }
+    const uint16_t hash = flipper_format_key_hash_get(&key_hash);
+
+    // Entries are sorted by offset, find the first line at or after current position
+    const size_t position = stream_tell(stream);
+    const size_t size = FlipperFormatKeyIndexArray_size(key_index->entries);
+    size_t low = 0;
+    size_t high = size;
+    while(low < high) {
+        size_t middle = low + (high - low) / 2;
+        if(FlipperFormatKeyIndexArray_cget(key_index->entries, middle)->offset < position) {
+            low = middle + 1;
+        } else {
+            high = middle;
+        }
+    }
+
+    for(size_t i = low; i < size; i++) {
+        const FlipperFormatKeyIndexEntry* entry =
+            FlipperFormatKeyIndexArray_cget(key_index->entries, i);
+        if(entry->hash == hash && entry->length == key_hash.length) {
+            return stream_seek(stream, entry->offset, StreamOffsetFromStart);
+        }
+    }
+
+    return stream_seek(stream, 0, StreamOffsetFromEnd);
+}
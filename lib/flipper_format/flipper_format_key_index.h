@@ -0,0 +1,47 @@
+#pragma once
+#include <toolbox/stream/stream.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+typedef struct FlipperFormatKeyIndex FlipperFormatKeyIndex;
+
+/**
+ * Allocate key index. Index is empty until the first seek.
+ * @return FlipperFormatKeyIndex*
+ */
+FlipperFormatKeyIndex* flipper_format_key_index_alloc();
+
+/**
+ * Free key index.
+ * @param key_index
+ */
+void flipper_format_key_index_free(FlipperFormatKeyIndex* key_index);
+
+/**
+ * Drop indexed offsets, must be called after every stream modification.
+ * Index will be rebuilt on the next seek.
+ * @param key_index
+ */
+void flipper_format_key_index_reset(FlipperFormatKeyIndex* key_index);
+
+/**
+ * Move stream to the beginning of the line with the next occurrence of the key.
+ * Index is built in one pass over the stream on the first call after reset.
+ * Position will be at the end of the stream if the key is not found.
+ * Hash collisions are possible, so the key must be checked by the stream parser afterwards.
+ * @param key_index
+ * @param stream
+ * @param key
+ * @return true stream position was updated
+ * @return false index is not available, stream position is unchanged
+ */
+bool flipper_format_key_index_seek(
+    FlipperFormatKeyIndex* key_index,
+    Stream* stream,
+    const char* key);
+
+#ifdef __cplusplus
+}
+#endif
@@ -1,9 +1,25 @@
 #include <inttypes.h>
+#include <ctype.h>
+#include <string.h>
 #include <toolbox/hex.h>
+#include <toolbox/varint.h>
 #include <core/check.h>
+#include <core/common_defines.h>
 #include "flipper_format_stream.h"
 #include "flipper_format_stream_i.h"
 
+#define FLIPPER_FORMAT_STREAM_BUFFER_SIZE (32U)
+// Longest number representation and then some
+#define FLIPPER_FORMAT_STREAM_VALUE_SIZE (32U)
+#define FLIPPER_FORMAT_STREAM_PACKED_MARKER '~'
+
+/*
+ * Packed value is a group of zigzag varints written in base64 after the marker:
+ * "~" + base64(varint(v0) varint(v1) ...), up to FLIPPER_STREAM_PACKED_BYTES_MAX bytes.
+ */
+static const char flipper_format_stream_packed_alphabet[] =
+    "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789+/";
+
 static inline bool flipper_format_stream_is_space(char c) {
     return c == ' ' || c == '\t' || c == flipper_format_eolr;
 }
@@ -30,233 +46,380 @@ bool flipper_format_stream_write_eol(Stream* stream) {
     return flipper_format_stream_write(stream, &flipper_format_eoln, 1);
 }
 
-static bool flipper_format_stream_read_valid_key(Stream* stream, FuriString* key) {
-    furi_string_reset(key);
-    const size_t buffer_size = 32;
-    uint8_t buffer[buffer_size];
+static size_t
+    flipper_format_stream_pack_bytes(const uint8_t* bytes, size_t bytes_size, char* output) {
+    size_t size = 0;
+    uint32_t bits = 0;
+    uint8_t bits_count = 0;
+
+    for(size_t i = 0; i < bytes_size; i++) {
+        bits = (bits << 8) | bytes[i];
+        bits_count += 8;
+        while(bits_count >= 6) {
+            bits_count -= 6;
+            output[size++] = flipper_format_stream_packed_alphabet[(bits >> bits_count) & 0x3F];
+        }
+    }
+
+    if(bits_count) {
+        output[size++] = flipper_format_stream_packed_alphabet[(bits << (6 - bits_count)) & 0x3F];
+    }
+
+    return size;
+}
+
+static bool
+    flipper_format_stream_write_packed(Stream* stream, const int32_t* data, size_t data_size) {
+    uint8_t bytes[FLIPPER_STREAM_PACKED_BYTES_MAX];
+    char value[FLIPPER_FORMAT_STREAM_VALUE_SIZE];
+
+    for(size_t i = 0; i < data_size;) {
+        size_t bytes_size = 0;
+        while(i < data_size &&
+              (bytes_size + varint_int32_length(data[i])) <= FLIPPER_STREAM_PACKED_BYTES_MAX) {
+            bytes_size += varint_int32_pack(data[i], &bytes[bytes_size]);
+            i++;
+        }
+
+        size_t size = 0;
+        value[size++] = FLIPPER_FORMAT_STREAM_PACKED_MARKER;
+        size += flipper_format_stream_pack_bytes(bytes, bytes_size, &value[size]);
+        if(i < data_size) {
+            value[size++] = ' ';
+        }
+
+        if(!flipper_format_stream_write(stream, value, size)) return false;
+    }
+
+    return true;
+}
+
+/*
+ * Reader over the stream data. Borrows the stream buffer if the stream has one,
+ * otherwise reads into its own small buffer. Stream position is updated on commit.
+ */
+typedef struct {
+    Stream* stream;
+    const uint8_t* data;
+    size_t size;
+    size_t position;
+    bool copied;
+    bool error;
+    uint8_t buffer[FLIPPER_FORMAT_STREAM_BUFFER_SIZE];
+} FlipperFormatReader;
+
+// Single value, long values are truncated but keep their full size
+typedef struct {
+    char data[FLIPPER_FORMAT_STREAM_VALUE_SIZE];
+    size_t size;
+} FlipperFormatValue;
+
+static void flipper_format_reader_init(FlipperFormatReader* reader, Stream* stream) {
+    reader->stream = stream;
+    reader->data = NULL;
+    reader->size = 0;
+    reader->position = 0;
+    reader->copied = false;
+    reader->error = false;
+}
+
+static bool flipper_format_reader_commit(FlipperFormatReader* reader) {
+    int32_t offset = reader->copied ? -(int32_t)(reader->size - reader->position) :
+                                      (int32_t)reader->position;
+    reader->data = NULL;
+    reader->size = 0;
+    reader->position = 0;
+
+    if(offset != 0 && !stream_seek(reader->stream, offset, StreamOffsetFromCurrent)) {
+        reader->error = true;
+    }
+    return !reader->error;
+}
+
+// Returns false at the end of the stream or on error
+static bool flipper_format_reader_fill(FlipperFormatReader* reader) {
+    if(reader->position < reader->size) return true;
+    if(!flipper_format_reader_commit(reader)) return false;
+
+    reader->size = stream_peek(reader->stream, &reader->data);
+    reader->copied = false;
+    if(reader->size == 0) {
+        reader->size = stream_read(reader->stream, reader->buffer, sizeof(reader->buffer));
+        reader->data = reader->buffer;
+        reader->copied = true;
+    }
+
+    return reader->size != 0;
+}
+
+bool flipper_format_stream_seek_to_key(Stream* stream, const char* key, bool strict_mode) {
+    FlipperFormatReader reader;
+    flipper_format_reader_init(&reader, stream);
 
     bool found = false;
-    bool error = false;
+    bool stop = false;
     bool accumulate = true;
     bool new_line = true;
+    // Key is compared while reading, so nothing is accumulated
+    bool match = true;
+    size_t matched = 0;
+
+    while(!stop && flipper_format_reader_fill(&reader)) {
+        const uint8_t* data = reader.data;
+
+        for(; reader.position < reader.size; reader.position++) {
+            if(!accumulate || (!match && !strict_mode)) {
+                // Rest of the line does not matter
+                const uint8_t* eol = memchr(
+                    data + reader.position, flipper_format_eoln, reader.size - reader.position);
+                if(!eol) {
+                    reader.position = reader.size;
+                    break;
+                }
+                reader.position = eol - data;
+            }
 
-    while(true) {
-        size_t was_read = stream_read(stream, buffer, buffer_size);
-        if(was_read == 0) break;
-
-        for(size_t i = 0; i < was_read; i++) {
-            uint8_t data = buffer[i];
-            if(data == flipper_format_eoln) {
-                // EOL found, clean data, start accumulating data and set the new_line flag
-                furi_string_reset(key);
+            const uint8_t c = data[reader.position];
+            if(c == flipper_format_eoln) {
                 accumulate = true;
                 new_line = true;
-            } else if(data == flipper_format_eolr) {
+                match = true;
+                matched = 0;
+            } else if(c == flipper_format_eolr) {
                 // ignore
-            } else if(data == flipper_format_comment && new_line) {
-                // if there is a comment character and we are at the beginning of a new line
-                // do not accumulate comment data and reset the new_line flag
+            } else if(c == flipper_format_comment && new_line) {
                 accumulate = false;
                 new_line = false;
-            } else if(data == flipper_format_delimiter) {
-                if(new_line) {
-                    // we are on a "new line" and found the delimiter
-                    // this can only be if we have previously found some kind of key, so
-                    // clear the data, set the flag that we no longer want to accumulate data
-                    // and reset the new_line flag
-                    furi_string_reset(key);
-                    accumulate = false;
-                    new_line = false;
-                } else {
-                    // parse the delimiter only if we are accumulating data
-                    if(accumulate) {
-                        // we found the delimiter, move the rw pointer to the delimiter location
-                        // and signal that we have found something
-                        if(!stream_seek(stream, i - was_read, StreamOffsetFromCurrent)) {
-                            error = true;
-                            break;
-                        }
-
-                        found = true;
+            } else if(c == flipper_format_delimiter) {
+                if(!new_line && accumulate) {
+                    // rw pointer stays at the delimiter location
+                    found = match && (key[matched] == '\0');
+                    if(found || strict_mode) {
+                        stop = true;
                         break;
                     }
                 }
+                accumulate = false;
+                new_line = false;
             } else {
-                // just new symbol, reset the new_line flag
                 new_line = false;
-                if(accumulate) {
-                    // and accumulate data if we want
-                    furi_string_push_back(key, data);
+                if(accumulate && match) {
+                    match = (key[matched] == (char)c);
+                    matched++;
                 }
             }
         }
-
-        if(found || error) break;
     }
 
-    return found;
-}
-
-bool flipper_format_stream_seek_to_key(Stream* stream, const char* key, bool strict_mode) {
-    bool found = false;
-    FuriString* read_key;
-
-    read_key = furi_string_alloc();
-
-    while(!stream_eof(stream)) {
-        if(flipper_format_stream_read_valid_key(stream, read_key)) {
-            if(furi_string_cmp_str(read_key, key) == 0) {
-                if(!stream_seek(stream, 2, StreamOffsetFromCurrent)) break;
-
-                found = true;
-                break;
-            } else if(strict_mode) {
-                found = false;
-                break;
-            }
-        }
-    }
-    furi_string_free(read_key);
+    if(!flipper_format_reader_commit(&reader)) found = false;
+    if(found && !stream_seek(stream, 2, StreamOffsetFromCurrent)) found = false;
 
     return found;
 }
 
-static bool flipper_format_stream_read_value(Stream* stream, FuriString* value, bool* last) {
+static bool flipper_format_stream_read_value(
+    FlipperFormatReader* reader,
+    FlipperFormatValue* value,
+    bool* last) {
     enum { LeadingSpace, ReadValue, TrailingSpace } state = LeadingSpace;
-    const size_t buffer_size = 32;
-    uint8_t buffer[buffer_size];
     bool result = false;
     bool error = false;
 
-    furi_string_reset(value);
+    value->size = 0;
 
-    while(true) {
-        size_t was_read = stream_read(stream, buffer, buffer_size);
-
-        if(was_read == 0) {
-            if(state != LeadingSpace && stream_eof(stream)) {
+    while(!result && !error) {
+        if(!flipper_format_reader_fill(reader)) {
+            if(state != LeadingSpace && !reader->error && stream_eof(reader->stream)) {
                 result = true;
                 *last = true;
             } else {
                 error = true;
             }
+            break;
         }
 
-        for(uint16_t i = 0; i < was_read; i++) {
-            const uint8_t data = buffer[i];
+        for(; reader->position < reader->size; reader->position++) {
+            const uint8_t data = reader->data[reader->position];
 
             if(state == LeadingSpace) {
                 if(flipper_format_stream_is_space(data)) {
                     continue;
                 } else if(data == flipper_format_eoln) {
-                    stream_seek(stream, i - was_read, StreamOffsetFromCurrent);
                     error = true;
                     break;
                 } else {
                     state = ReadValue;
-                    furi_string_push_back(value, data);
                 }
             } else if(state == ReadValue) {
                 if(flipper_format_stream_is_space(data)) {
                     state = TrailingSpace;
+                    continue;
                 } else if(data == flipper_format_eoln) {
-                    if(!stream_seek(stream, i - was_read, StreamOffsetFromCurrent)) {
-                        error = true;
-                    } else {
-                        result = true;
-                        *last = true;
-                    }
+                    result = true;
+                    *last = true;
                     break;
-                } else {
-                    furi_string_push_back(value, data);
                 }
             } else if(state == TrailingSpace) {
                 if(flipper_format_stream_is_space(data)) {
                     continue;
-                } else if(!stream_seek(stream, i - was_read, StreamOffsetFromCurrent)) {
-                    error = true;
-                } else {
-                    *last = (data == flipper_format_eoln);
-                    result = true;
                 }
+                *last = (data == flipper_format_eoln);
+                result = true;
                 break;
             }
-        }
 
-        if(error || result) break;
+            if(value->size < (FLIPPER_FORMAT_STREAM_VALUE_SIZE - 1)) {
+                value->data[value->size] = data;
+            }
+            value->size++;
+        }
     }
 
+    value->data[MIN(value->size, FLIPPER_FORMAT_STREAM_VALUE_SIZE - 1)] = '\0';
+
     return result;
 }
 
-static bool flipper_format_stream_read_line(Stream* stream, FuriString* str_result) {
-    furi_string_reset(str_result);
-    const size_t buffer_size = 32;
-    uint8_t buffer[buffer_size];
+static inline bool flipper_format_stream_value_is_complete(FlipperFormatValue* value) {
+    return value->size < FLIPPER_FORMAT_STREAM_VALUE_SIZE;
+}
 
-    do {
-        size_t was_read = stream_read(stream, buffer, buffer_size);
-        if(was_read == 0) break;
+static inline bool flipper_format_stream_value_is_packed(FlipperFormatValue* value) {
+    return value->size && value->data[0] == FLIPPER_FORMAT_STREAM_PACKED_MARKER;
+}
 
-        bool result = false;
-        bool error = false;
+static int8_t flipper_format_stream_packed_char_to_bits(char c) {
+    if(c >= 'A' && c <= 'Z') {
+        return c - 'A';
+    } else if(c >= 'a' && c <= 'z') {
+        return c - 'a' + 26;
+    } else if(c >= '0' && c <= '9') {
+        return c - '0' + 52;
+    } else if(c == '+') {
+        return 62;
+    } else if(c == '/') {
+        return 63;
+    } else {
+        return -1;
+    }
+}
 
-        for(size_t i = 0; i < was_read; i++) {
-            uint8_t data = buffer[i];
-            if(data == flipper_format_eoln) {
-                if(!stream_seek(stream, i - was_read, StreamOffsetFromCurrent)) {
-                    error = true;
-                    break;
-                }
+static bool
+    flipper_format_stream_unpack_value(FlipperFormatValue* value, FlipperStreamPacked* packed) {
+    // One more byte than written, so oversized values are detected
+    uint8_t bytes[FLIPPER_STREAM_PACKED_BYTES_MAX + 1];
+    size_t bytes_size = 0;
+    uint32_t bits = 0;
+    uint8_t bits_count = 0;
 
-                result = true;
-                break;
-            } else if(data == flipper_format_eolr) {
-                // Ignore
-            } else {
-                furi_string_push_back(str_result, data);
-            }
+    packed->count = 0;
+    packed->position = 0;
+
+    if(!flipper_format_stream_value_is_complete(value)) return false;
+
+    for(size_t i = 1; i < value->size; i++) {
+        const int8_t value_bits = flipper_format_stream_packed_char_to_bits(value->data[i]);
+        if(value_bits < 0) return false;
+
+        bits = (bits << 6) | value_bits;
+        bits_count += 6;
+        if(bits_count >= 8) {
+            bits_count -= 8;
+            bytes[bytes_size++] = bits >> bits_count;
         }
+    }
 
-        if(result || error) {
-            break;
+    size_t position = 0;
+    while(position < bytes_size) {
+        if(packed->count == FLIPPER_STREAM_PACKED_BYTES_MAX) return false;
+        position += varint_int32_unpack(
+            &packed->values[packed->count++], &bytes[position], bytes_size - position);
+    }
+
+    // Unterminated varint moves position past the end
+    return (position == bytes_size) && (packed->count != 0);
+}
+
+// Moves unpacked values to the caller buffer while there is space
+static bool flipper_format_stream_take_packed(
+    FlipperStreamPacked* packed,
+    FlipperStreamValue type,
+    void* _data,
+    size_t data_size,
+    size_t* data_read) {
+    for(; packed->position < packed->count && *data_read < data_size; packed->position++) {
+        const int32_t value = packed->values[packed->position];
+        if(type == FlipperStreamValueInt32) {
+            int32_t* data = _data;
+            data[*data_read] = value;
+        } else if(type == FlipperStreamValueUint32 && value >= 0) {
+            uint32_t* data = _data;
+            data[*data_read] = value;
+        } else {
+            return false;
         }
-    } while(true);
+        *data_read = *data_read + 1;
+    }
+
+    return true;
+}
+
+static inline bool flipper_format_stream_type_is_packable(FlipperStreamValue type) {
+    return type == FlipperStreamValueInt32 || type == FlipperStreamValueUint32;
+}
+
+static bool flipper_format_stream_value_is_true(FlipperFormatValue* value) {
+    const char* true_str = "true";
+    if(value->size != strlen(true_str)) return false;
+
+    for(size_t i = 0; i < value->size; i++) {
+        if(tolower((unsigned char)value->data[i]) != true_str[i]) return false;
+    }
+
+    return true;
+}
+
+static bool flipper_format_stream_read_line(FlipperFormatReader* reader, FuriString* str_result) {
+    furi_string_reset(str_result);
+
+    bool done = false;
+    while(!done && flipper_format_reader_fill(reader)) {
+        const uint8_t* data = reader->data + reader->position;
+        const size_t size = reader->size - reader->position;
+        const uint8_t* eol = memchr(data, flipper_format_eoln, size);
+        const size_t length = eol ? (size_t)(eol - data) : size;
+
+        stream_cat_line(str_result, data, length);
+        // rw pointer stays at EOL
+        reader->position += length;
+        done = (eol != NULL);
+    }
 
     return furi_string_size(str_result) != 0;
 }
 
 static bool flipper_format_stream_seek_to_next_line(Stream* stream) {
-    const size_t buffer_size = 32;
-    uint8_t buffer[buffer_size];
+    FlipperFormatReader reader;
+    flipper_format_reader_init(&reader, stream);
     bool result = false;
-    bool error = false;
 
-    do {
-        size_t was_read = stream_read(stream, buffer, buffer_size);
-        if(was_read == 0) {
-            if(stream_eof(stream)) {
-                result = true;
-                break;
-            }
-        }
-
-        for(size_t i = 0; i < was_read; i++) {
-            if(buffer[i] == flipper_format_eoln) {
-                if(!stream_seek(stream, i - was_read, StreamOffsetFromCurrent)) {
-                    error = true;
-                    break;
-                }
-
-                result = true;
-                break;
-            }
-        }
+    while(flipper_format_reader_fill(&reader)) {
+        const uint8_t* data = reader.data + reader.position;
+        const size_t size = reader.size - reader.position;
+        const uint8_t* eol = memchr(data, flipper_format_eoln, size);
 
-        if(result || error) {
+        if(eol) {
+            reader.position += eol - data;
+            result = true;
             break;
         }
-    } while(true);
+        reader.position = reader.size;
+    }
+
+    if(!result && !reader.error) {
+        result = stream_eof(stream);
+    }
+    if(!flipper_format_reader_commit(&reader)) result = false;
 
     return result;
 }
@@ -266,6 +429,11 @@ bool flipper_format_stream_write_value_line(Stream* stream, FlipperStreamWriteDa
 
     if(write_data->type == FlipperStreamValueIgnore) {
         result = true;
+    } else if(write_data->type == FlipperStreamValueInt32Packed) {
+        result = flipper_format_stream_write_key(stream, write_data->key) &&
+                 flipper_format_stream_write_packed(
+                     stream, write_data->data, write_data->data_size) &&
+                 flipper_format_stream_write_eol(stream);
     } else {
         FuriString* value;
         value = furi_string_alloc();
@@ -335,6 +503,62 @@ bool flipper_format_stream_write_value_line(Stream* stream, FlipperStreamWriteDa
     return result;
 }
 
+// Values are converted in place, without copying to a string
+static bool flipper_format_stream_convert_value(
+    FlipperFormatValue* value,
+    FlipperStreamValue type,
+    void* _data,
+    size_t index) {
+    bool converted = false;
+    char* end_char = NULL;
+
+    switch(type) {
+    case FlipperStreamValueHex: {
+        uint8_t* data = _data;
+        if(value->size >= 2) {
+            converted = hex_char_to_uint8(value->data[0], value->data[1], &data[index]);
+        }
+    }; break;
+#ifndef FLIPPER_STREAM_LITE
+    case FlipperStreamValueFloat: {
+        float* data = _data;
+        // newlib-nano does not have sscanf for floats
+        data[index] = strtof(value->data, &end_char);
+        converted = flipper_format_stream_value_is_complete(value) && (*end_char == 0);
+    }; break;
+#endif
+    case FlipperStreamValueInt32: {
+        int32_t* data = _data;
+        // Same as sscanf with "%" PRIi32
+        data[index] = strtol(value->data, &end_char, 0);
+        converted = flipper_format_stream_value_is_complete(value) &&
+                    (end_char != value->data);
+    }; break;
+    case FlipperStreamValueUint32: {
+        uint32_t* data = _data;
+        // Same as sscanf with "%" PRIu32
+        data[index] = strtoul(value->data, &end_char, 10);
+        converted = flipper_format_stream_value_is_complete(value) &&
+                    (end_char != value->data);
+    }; break;
+    case FlipperStreamValueHexUint64: {
+        uint64_t* data = _data;
+        if(value->size >= 16) {
+            converted = hex_chars_to_uint64(value->data, &data[index]);
+        }
+    }; break;
+    case FlipperStreamValueBool: {
+        bool* data = _data;
+        data[index] = flipper_format_stream_value_is_true(value);
+        converted = true;
+    }; break;
+    default:
+        furi_crash("Unknown FF type");
+    }
+
+    return converted;
+}
+
 bool flipper_format_stream_read_value_line(
     Stream* stream,
     const char* key,
@@ -344,94 +568,85 @@ bool flipper_format_stream_read_value_line(
     bool strict_mode) {
     bool result = false;
 
-    do {
-        if(!flipper_format_stream_seek_to_key(stream, key, strict_mode)) break;
+    if(!flipper_format_stream_seek_to_key(stream, key, strict_mode)) return result;
 
-        if(type == FlipperStreamValueStr) {
-            FuriString* data = (FuriString*)_data;
-            if(flipper_format_stream_read_line(stream, data)) {
-                result = true;
-                break;
+    FlipperFormatReader reader;
+    flipper_format_reader_init(&reader, stream);
+
+    if(type == FlipperStreamValueStr) {
+        FuriString* data = (FuriString*)_data;
+        result = flipper_format_stream_read_line(&reader, data);
+    } else {
+        result = true;
+        FlipperFormatValue value;
+        FlipperStreamPacked packed;
+        size_t data_read = 0;
+        bool last = false;
+
+        while(result && !last && data_read < data_size) {
+            result = flipper_format_stream_read_value(&reader, &value, &last);
+            if(!result) break;
+
+            if(flipper_format_stream_type_is_packable(type) &&
+               flipper_format_stream_value_is_packed(&value)) {
+                result = flipper_format_stream_unpack_value(&value, &packed) &&
+                         flipper_format_stream_take_packed(
+                             &packed, type, _data, data_size, &data_read);
+            } else {
+                result = flipper_format_stream_convert_value(&value, type, _data, data_read);
+                data_read++;
             }
-        } else {
-            result = true;
-            FuriString* value;
-            value = furi_string_alloc();
-
-            for(size_t i = 0; i < data_size; i++) {
-                bool last = false;
-                result = flipper_format_stream_read_value(stream, value, &last);
-                if(result) {
-                    int scan_values = 0;
-
-                    switch(type) {
-                    case FlipperStreamValueHex: {
-                        uint8_t* data = _data;
-                        if(furi_string_size(value) >= 2) {
-                            // sscanf "%02X" does not work here
-                            if(hex_char_to_uint8(
-                                   furi_string_get_char(value, 0),
-                                   furi_string_get_char(value, 1),
-                                   &data[i])) {
-                                scan_values = 1;
-                            }
-                        }
-                    }; break;
-#ifndef FLIPPER_STREAM_LITE
-                    case FlipperStreamValueFloat: {
-                        float* data = _data;
-                        // newlib-nano does not have sscanf for floats
-                        // scan_values = sscanf(furi_string_get_cstr(value), "%f", &data[i]);
-                        char* end_char;
-                        data[i] = strtof(furi_string_get_cstr(value), &end_char);
-                        if(*end_char == 0) {
-                            // most likely ok
-                            scan_values = 1;
-                        }
-                    }; break;
-#endif
-                    case FlipperStreamValueInt32: {
-                        int32_t* data = _data;
-                        scan_values = sscanf(furi_string_get_cstr(value), "%" PRIi32, &data[i]);
-                    }; break;
-                    case FlipperStreamValueUint32: {
-                        uint32_t* data = _data;
-                        scan_values = sscanf(furi_string_get_cstr(value), "%" PRIu32, &data[i]);
-                    }; break;
-                    case FlipperStreamValueHexUint64: {
-                        uint64_t* data = _data;
-                        if(furi_string_size(value) >= 16) {
-                            if(hex_chars_to_uint64(furi_string_get_cstr(value), &data[i])) {
-                                scan_values = 1;
-                            }
-                        }
-                    }; break;
-                    case FlipperStreamValueBool: {
-                        bool* data = _data;
-                        data[i] = !furi_string_cmpi(value, "true");
-                        scan_values = 1;
-                    }; break;
-                    default:
-                        furi_crash("Unknown FF type");
-                    }
+        }
 
-                    if(scan_values != 1) {
-                        result = false;
-                        break;
-                    }
-                } else {
-                    break;
-                }
+        if(data_read != data_size) result = false;
+    }
 
-                if(last && ((i + 1) != data_size)) {
-                    result = false;
-                    break;
-                }
-            }
+    if(!flipper_format_reader_commit(&reader)) result = false;
 
-            furi_string_free(value);
+    return result;
+}
+
+bool flipper_format_stream_read_values(
+    Stream* stream,
+    FlipperStreamValue type,
+    void* _data,
+    size_t data_size,
+    size_t* data_read,
+    bool* last,
+    FlipperStreamPacked* packed) {
+    furi_assert(type != FlipperStreamValueStr);
+    bool result = true;
+    *data_read = 0;
+    *last = false;
+
+    // Rest of the packed value from the previous chunk goes first
+    if(packed->position < packed->count) {
+        result = flipper_format_stream_take_packed(packed, type, _data, data_size, data_read);
+        if(packed->position < packed->count) return result;
+        *last = packed->last;
+    }
+
+    FlipperFormatReader reader;
+    flipper_format_reader_init(&reader, stream);
+
+    FlipperFormatValue value;
+    while(result && !*last && (*data_read < data_size)) {
+        if(!flipper_format_stream_read_value(&reader, &value, last)) {
+            result = false;
+        } else if(
+            flipper_format_stream_type_is_packable(type) &&
+            flipper_format_stream_value_is_packed(&value)) {
+            result = flipper_format_stream_unpack_value(&value, packed) &&
+                     flipper_format_stream_take_packed(packed, type, _data, data_size, data_read);
+            packed->last = *last;
+            if(packed->position < packed->count) *last = false;
+        } else {
+            result = flipper_format_stream_convert_value(&value, type, _data, *data_read);
+            if(result) *data_read = *data_read + 1;
         }
-    } while(false);
+    }
+
+    if(!flipper_format_reader_commit(&reader)) result = false;
 
     return result;
 }
@@ -444,32 +659,40 @@ bool flipper_format_stream_get_value_count(
     bool result = false;
     bool last = false;
 
-    FuriString* value;
-    value = furi_string_alloc();
+    FlipperFormatValue value;
 
     uint32_t position = stream_tell(stream);
     do {
         if(!flipper_format_stream_seek_to_key(stream, key, strict_mode)) break;
         *count = 0;
 
+        FlipperFormatReader reader;
+        flipper_format_reader_init(&reader, stream);
+
         result = true;
         while(true) {
-            if(!flipper_format_stream_read_value(stream, value, &last)) {
+            if(!flipper_format_stream_read_value(&reader, &value, &last)) {
                 result = false;
                 break;
             }
 
-            *count = *count + 1;
+            FlipperStreamPacked packed;
+            if(flipper_format_stream_value_is_packed(&value) &&
+               flipper_format_stream_unpack_value(&value, &packed)) {
+                *count = *count + packed.count;
+            } else {
+                *count = *count + 1;
+            }
             if(last) break;
         }
 
+        flipper_format_reader_commit(&reader);
     } while(false);
 
     if(!stream_seek(stream, position, StreamOffsetFromStart)) {
         result = false;
     }
 
-    furi_string_free(value);
     return result;
 }
 
@@ -3,6 +3,9 @@
 #include <stdbool.h>
 #include <toolbox/stream/stream.h>
 
+/* Longest packed value, stays under the FlipperFormat value size */
+#define FLIPPER_STREAM_PACKED_BYTES_MAX (21U)
+
 #ifdef __cplusplus
 extern "C" {
 #endif
@@ -16,8 +19,17 @@ typedef enum {
     FlipperStreamValueUint32,
     FlipperStreamValueHexUint64,
     FlipperStreamValueBool,
+    FlipperStreamValueInt32Packed,
 } FlipperStreamValue;
 
+/* Values of a packed group that did not fit into the caller buffer yet */
+typedef struct {
+    int32_t values[FLIPPER_STREAM_PACKED_BYTES_MAX];
+    size_t count;
+    size_t position;
+    bool last;
+} FlipperStreamPacked;
+
 typedef struct {
     const char* key;
     FlipperStreamValue type;
@@ -53,6 +65,30 @@ bool flipper_format_stream_read_value_line(
     size_t data_size,
     bool strict_mode);
 
+/**
+ * Reads up to data_size values from the current position of the stream.
+ * Stream must be positioned at a value, e.g. after flipper_format_stream_seek_to_key.
+ * Position is kept after the last read value, so the line can be read in chunks.
+ * Packed int32 and uint32 values are unpacked, the rest of a packed group is kept in packed.
+ * @param stream 
+ * @param type 
+ * @param _data 
+ * @param data_size 
+ * @param data_read number of values read
+ * @param last set if the last value of the line was read
+ * @param packed packed values state, zeroed before reading the line
+ * @return true 
+ * @return false 
+ */
+bool flipper_format_stream_read_values(
+    Stream* stream,
+    FlipperStreamValue type,
+    void* _data,
+    size_t data_size,
+    size_t* data_read,
+    bool* last,
+    FlipperStreamPacked* packed);
+
 /**
  * Get the count of values by key from a stream.
  * @param stream 
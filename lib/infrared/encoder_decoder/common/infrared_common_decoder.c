@@ -220,6 +220,20 @@ InfraredMessage* infrared_common_decoder_check_ready(InfraredCommonDecoder* deco
     return message;
 }
 
+/**
+ * Idle decoder waits for preamble, holds no timings and last timing was a space.
+ * Until it gets a mark matching preamble_mark, every mark/space pair is dropped by
+ * infrared_check_preamble() and decoder state stays the same, so such timings
+ * don't have to be passed to it.
+ */
+bool infrared_common_decoder_is_idle(const InfraredCommonDecoder* decoder) {
+    furi_assert(decoder);
+
+    return (decoder->protocol->timings.preamble_mark != 0) &&
+           (decoder->state == InfraredCommonDecoderStateWaitPreamble) &&
+           (decoder->timings_cnt == 0) && (decoder->databit_cnt == 0) && !decoder->level;
+}
+
 InfraredMessage*
     infrared_common_decode(InfraredCommonDecoder* decoder, bool level, uint32_t duration) {
     furi_assert(decoder);
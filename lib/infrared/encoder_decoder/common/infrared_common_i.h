@@ -75,6 +75,7 @@ void* infrared_common_decoder_alloc(const InfraredCommonProtocolSpec* protocol);
 void infrared_common_decoder_free(InfraredCommonDecoder* decoder);
 void infrared_common_decoder_reset(InfraredCommonDecoder* decoder);
 InfraredMessage* infrared_common_decoder_check_ready(InfraredCommonDecoder* decoder);
+bool infrared_common_decoder_is_idle(const InfraredCommonDecoder* decoder);
 
 InfraredStatus
     infrared_common_encode(InfraredCommonEncoder* encoder, uint32_t* duration, bool* polarity);
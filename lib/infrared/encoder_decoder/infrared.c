@@ -15,6 +15,9 @@ typedef struct {
     InfraredDecoderReset reset;
     InfraredFree free;
     InfraredDecoderCheckReady check_ready;
+    InfraredDecoderIsIdle is_idle;
+    /* Preamble and bit timing envelopes */
+    const InfraredTimings* timings;
 } InfraredDecoders;
 
 typedef struct {
@@ -26,6 +29,9 @@ typedef struct {
 
 struct InfraredDecoderHandler {
     void** ctx;
+    /* Decoders which get every timing, the rest are idle and wait for preamble */
+    uint32_t active;
+    bool level;
 };
 
 struct InfraredEncoderHandler {
@@ -46,6 +52,8 @@ static const InfraredEncoderDecoder infrared_encoder_decoder[] = {
              .decode = infrared_decoder_nec_decode,
              .reset = infrared_decoder_nec_reset,
              .check_ready = infrared_decoder_nec_check_ready,
+             .is_idle = infrared_decoder_nec_is_idle,
+             .timings = &protocol_nec.timings,
              .free = infrared_decoder_nec_free},
         .encoder =
             {.alloc = infrared_encoder_nec_alloc,
@@ -60,6 +68,8 @@ static const InfraredEncoderDecoder infrared_encoder_decoder[] = {
              .decode = infrared_decoder_samsung32_decode,
              .reset = infrared_decoder_samsung32_reset,
              .check_ready = infrared_decoder_samsung32_check_ready,
+             .is_idle = infrared_decoder_samsung32_is_idle,
+             .timings = &protocol_samsung32.timings,
              .free = infrared_decoder_samsung32_free},
         .encoder =
             {.alloc = infrared_encoder_samsung32_alloc,
@@ -74,6 +84,8 @@ static const InfraredEncoderDecoder infrared_encoder_decoder[] = {
              .decode = infrared_decoder_rc5_decode,
              .reset = infrared_decoder_rc5_reset,
              .check_ready = infrared_decoder_rc5_check_ready,
+             .is_idle = infrared_decoder_rc5_is_idle,
+             .timings = &protocol_rc5.timings,
              .free = infrared_decoder_rc5_free},
         .encoder =
             {.alloc = infrared_encoder_rc5_alloc,
@@ -88,6 +100,8 @@ static const InfraredEncoderDecoder infrared_encoder_decoder[] = {
              .decode = infrared_decoder_rc6_decode,
              .reset = infrared_decoder_rc6_reset,
              .check_ready = infrared_decoder_rc6_check_ready,
+             .is_idle = infrared_decoder_rc6_is_idle,
+             .timings = &protocol_rc6.timings,
              .free = infrared_decoder_rc6_free},
         .encoder =
             {.alloc = infrared_encoder_rc6_alloc,
@@ -102,6 +116,8 @@ static const InfraredEncoderDecoder infrared_encoder_decoder[] = {
              .decode = infrared_decoder_sirc_decode,
              .reset = infrared_decoder_sirc_reset,
              .check_ready = infrared_decoder_sirc_check_ready,
+             .is_idle = infrared_decoder_sirc_is_idle,
+             .timings = &protocol_sirc.timings,
              .free = infrared_decoder_sirc_free},
         .encoder =
             {.alloc = infrared_encoder_sirc_alloc,
@@ -116,6 +132,8 @@ static const InfraredEncoderDecoder infrared_encoder_decoder[] = {
              .decode = infrared_decoder_kaseikyo_decode,
              .reset = infrared_decoder_kaseikyo_reset,
              .check_ready = infrared_decoder_kaseikyo_check_ready,
+             .is_idle = infrared_decoder_kaseikyo_is_idle,
+             .timings = &protocol_kaseikyo.timings,
              .free = infrared_decoder_kaseikyo_free},
         .encoder =
             {.alloc = infrared_encoder_kaseikyo_alloc,
@@ -130,6 +148,25 @@ static int infrared_find_index_by_protocol(InfraredProtocol protocol);
 static const InfraredProtocolSpecification*
     infrared_get_spec_by_protocol(InfraredProtocol protocol);
 
+/* Can idle decoder leave preamble wait state with this timing */
+static inline bool infrared_decoder_preamble_starts(
+    const InfraredDecoders* decoder,
+    bool level,
+    uint32_t duration) {
+    const InfraredTimings* timings = decoder->timings;
+    return level && MATCH_TIMING(duration, timings->preamble_mark, timings->preamble_tolerance);
+}
+
+static inline void
+    infrared_decoder_update_active(InfraredDecoderHandler* handler, size_t index) {
+    const InfraredDecoders* decoder = &infrared_encoder_decoder[index].decoder;
+    if(decoder->is_idle && decoder->is_idle(handler->ctx[index])) {
+        handler->active &= ~(1UL << index);
+    } else {
+        handler->active |= (1UL << index);
+    }
+}
+
 const InfraredMessage*
     infrared_decode(InfraredDecoderHandler* handler, bool level, uint32_t duration) {
     furi_assert(handler);
@@ -137,13 +174,27 @@ const InfraredMessage*
     InfraredMessage* message = NULL;
     InfraredMessage* result = NULL;
 
+    /* Same level twice resets decoders, so idle ones have to see it too */
+    bool wake_all = (level == handler->level);
+    handler->level = level;
+
     for(size_t i = 0; i < COUNT_OF(infrared_encoder_decoder); ++i) {
-        if(infrared_encoder_decoder[i].decoder.decode) {
-            message = infrared_encoder_decoder[i].decoder.decode(handler->ctx[i], level, duration);
-            if(!result && message) {
-                result = message;
+        const InfraredDecoders* decoder = &infrared_encoder_decoder[i].decoder;
+        if(!decoder->decode) continue;
+
+        if(!(handler->active & (1UL << i))) {
+            if(wake_all) {
+                decoder->reset(handler->ctx[i]);
+            } else if(!infrared_decoder_preamble_starts(decoder, level, duration)) {
+                continue;
             }
         }
+
+        message = decoder->decode(handler->ctx[i], level, duration);
+        if(!result && message) {
+            result = message;
+        }
+        infrared_decoder_update_active(handler, i);
     }
 
     return result;
@@ -152,6 +203,7 @@ const InfraredMessage*
 InfraredDecoderHandler* infrared_alloc_decoder(void) {
     InfraredDecoderHandler* handler = malloc(sizeof(InfraredDecoderHandler));
     handler->ctx = malloc(sizeof(void*) * COUNT_OF(infrared_encoder_decoder));
+    furi_assert(COUNT_OF(infrared_encoder_decoder) <= 32);
 
     for(size_t i = 0; i < COUNT_OF(infrared_encoder_decoder); ++i) {
         handler->ctx[i] = 0;
@@ -181,6 +233,8 @@ void infrared_reset_decoder(InfraredDecoderHandler* handler) {
         if(infrared_encoder_decoder[i].decoder.reset)
             infrared_encoder_decoder[i].decoder.reset(handler->ctx[i]);
     }
+    handler->active = UINT32_MAX;
+    handler->level = true;
 }
 
 const InfraredMessage* infrared_check_decoder_ready(InfraredDecoderHandler* handler) {
@@ -190,11 +244,15 @@ const InfraredMessage* infrared_check_decoder_ready(InfraredDecoderHandler* hand
     InfraredMessage* result = NULL;
 
     for(size_t i = 0; i < COUNT_OF(infrared_encoder_decoder); ++i) {
+        /* Idle decoders have nothing to check */
+        if(!(handler->active & (1UL << i))) continue;
+
         if(infrared_encoder_decoder[i].decoder.check_ready) {
             message = infrared_encoder_decoder[i].decoder.check_ready(handler->ctx[i]);
             if(!result && message) {
                 result = message;
             }
+            infrared_decoder_update_active(handler, i);
         }
     }
 
@@ -40,6 +40,7 @@ void* infrared_decoder_nec_alloc(void);
 void infrared_decoder_nec_reset(void* decoder);
 void infrared_decoder_nec_free(void* decoder);
 InfraredMessage* infrared_decoder_nec_check_ready(void* decoder);
+bool infrared_decoder_nec_is_idle(void* decoder);
 InfraredMessage* infrared_decoder_nec_decode(void* decoder, bool level, uint32_t duration);
 void* infrared_encoder_nec_alloc(void);
 InfraredStatus infrared_encoder_nec_encode(void* encoder_ptr, uint32_t* duration, bool* level);
@@ -95,6 +96,7 @@ void* infrared_decoder_samsung32_alloc(void);
 void infrared_decoder_samsung32_reset(void* decoder);
 void infrared_decoder_samsung32_free(void* decoder);
 InfraredMessage* infrared_decoder_samsung32_check_ready(void* ctx);
+bool infrared_decoder_samsung32_is_idle(void* ctx);
 InfraredMessage* infrared_decoder_samsung32_decode(void* decoder, bool level, uint32_t duration);
 InfraredStatus
     infrared_encoder_samsung32_encode(void* encoder_ptr, uint32_t* duration, bool* level);
@@ -148,6 +150,7 @@ void* infrared_decoder_rc6_alloc(void);
 void infrared_decoder_rc6_reset(void* decoder);
 void infrared_decoder_rc6_free(void* decoder);
 InfraredMessage* infrared_decoder_rc6_check_ready(void* ctx);
+bool infrared_decoder_rc6_is_idle(void* ctx);
 InfraredMessage* infrared_decoder_rc6_decode(void* decoder, bool level, uint32_t duration);
 void* infrared_encoder_rc6_alloc(void);
 void infrared_encoder_rc6_reset(void* encoder_ptr, const InfraredMessage* message);
@@ -204,6 +207,7 @@ void* infrared_decoder_rc5_alloc(void);
 void infrared_decoder_rc5_reset(void* decoder);
 void infrared_decoder_rc5_free(void* decoder);
 InfraredMessage* infrared_decoder_rc5_check_ready(void* ctx);
+bool infrared_decoder_rc5_is_idle(void* ctx);
 InfraredMessage* infrared_decoder_rc5_decode(void* decoder, bool level, uint32_t duration);
 void* infrared_encoder_rc5_alloc(void);
 void infrared_encoder_rc5_reset(void* encoder_ptr, const InfraredMessage* message);
@@ -252,6 +256,7 @@ extern const InfraredCommonProtocolSpec protocol_rc5;
 void* infrared_decoder_sirc_alloc(void);
 void infrared_decoder_sirc_reset(void* decoder);
 InfraredMessage* infrared_decoder_sirc_check_ready(void* decoder);
+bool infrared_decoder_sirc_is_idle(void* decoder);
 uint32_t infrared_decoder_sirc_get_timeout(void* decoder);
 void infrared_decoder_sirc_free(void* decoder);
 InfraredMessage* infrared_decoder_sirc_decode(void* decoder, bool level, uint32_t duration);
@@ -303,6 +308,7 @@ void* infrared_decoder_kaseikyo_alloc(void);
 void infrared_decoder_kaseikyo_reset(void* decoder);
 void infrared_decoder_kaseikyo_free(void* decoder);
 InfraredMessage* infrared_decoder_kaseikyo_check_ready(void* decoder);
+bool infrared_decoder_kaseikyo_is_idle(void* decoder);
 InfraredMessage* infrared_decoder_kaseikyo_decode(void* decoder, bool level, uint32_t duration);
 void* infrared_encoder_kaseikyo_alloc(void);
 InfraredStatus
@@ -8,10 +8,16 @@
 #include <stdint.h>
 #include <furi.h>
 #include <float_tools.h>
+#include <toolbox/level_duration.h>
 
 #include <notification/notification_messages.h>
 
 #define INFRARED_WORKER_RX_TIMEOUT INFRARED_RAW_RX_TIMING_DELAY_US
+/* Edges accumulated in ISR before RX thread is woken up */
+#define INFRARED_WORKER_RX_BATCH_SIZE 32U
+/* Space longer than any inside a frame, flushes the batch so short frames (e.g. NEC repeats)
+ * are not held until the batch fills */
+#define INFRARED_WORKER_RX_FLUSH_GAP_US 10000U
 
 #define INFRARED_WORKER_RX_RECEIVED 0x01
 #define INFRARED_WORKER_RX_TIMEOUT_RECEIVED 0x02
@@ -76,6 +82,8 @@ struct InfraredWorker {
             InfraredWorkerReceivedSignalCallback received_signal_callback;
             void* received_signal_context;
             bool overrun;
+            LevelDuration batch[INFRARED_WORKER_RX_BATCH_SIZE];
+            size_t batch_cnt;
         } rx;
     };
 };
@@ -91,24 +99,42 @@ static FuriHalInfraredTxGetDataState
     infrared_worker_furi_hal_data_isr_callback(void* context, uint32_t* duration, bool* level);
 static void infrared_worker_furi_hal_message_sent_isr_callback(void* context);
 
+/* Pass accumulated edges to RX thread, whole batch or nothing */
+static uint32_t infrared_worker_rx_flush_batch(InfraredWorker* instance) {
+    if(instance->rx.batch_cnt == 0) return 0;
+
+    size_t size = sizeof(LevelDuration) * instance->rx.batch_cnt;
+    instance->rx.batch_cnt = 0;
+
+    if(furi_stream_buffer_spaces_available(instance->stream) < size) {
+        return INFRARED_WORKER_OVERRUN;
+    }
+    size_t ret = furi_stream_buffer_send(instance->stream, instance->rx.batch, size, 0);
+    furi_assert(ret == size);
+    (void)ret;
+
+    return INFRARED_WORKER_RX_RECEIVED;
+}
+
 static void infrared_worker_rx_timeout_callback(void* context) {
     InfraredWorker* instance = context;
-    uint32_t flags_set = furi_thread_flags_set(
-        furi_thread_get_id(instance->thread), INFRARED_WORKER_RX_TIMEOUT_RECEIVED);
-    furi_check(flags_set & INFRARED_WORKER_RX_TIMEOUT_RECEIVED);
+    uint32_t events = infrared_worker_rx_flush_batch(instance) |
+                      INFRARED_WORKER_RX_TIMEOUT_RECEIVED;
+
+    uint32_t flags_set = furi_thread_flags_set(furi_thread_get_id(instance->thread), events);
+    furi_check(flags_set & events);
 }
 
 static void infrared_worker_rx_callback(void* context, bool level, uint32_t duration) {
     InfraredWorker* instance = context;
 
     furi_assert(duration != 0);
-    LevelDuration level_duration = level_duration_make(level, duration);
-
-    size_t ret =
-        furi_stream_buffer_send(instance->stream, &level_duration, sizeof(LevelDuration), 0);
-    uint32_t events = (ret == sizeof(LevelDuration)) ? INFRARED_WORKER_RX_RECEIVED :
-                                                       INFRARED_WORKER_OVERRUN;
+    instance->rx.batch[instance->rx.batch_cnt++] = level_duration_make(level, duration);
+    if((instance->rx.batch_cnt < INFRARED_WORKER_RX_BATCH_SIZE) &&
+       (level || (duration < INFRARED_WORKER_RX_FLUSH_GAP_US)))
+        return;
 
+    uint32_t events = infrared_worker_rx_flush_batch(instance);
     uint32_t flags_set = furi_thread_flags_set(furi_thread_get_id(instance->thread), events);
     furi_check(flags_set & events);
 }
@@ -130,25 +156,28 @@ static void infrared_worker_process_timeout(InfraredWorker* instance) {
             instance->rx.received_signal_context, &instance->signal);
 }
 
-static void
-    infrared_worker_process_timings(InfraredWorker* instance, uint32_t duration, bool level) {
-    const InfraredMessage* message_decoded =
-        instance->decode_enable ? infrared_decode(instance->infrared_decoder, level, duration) :
-                                  NULL;
-    if(message_decoded) {
-        instance->signal.message = *message_decoded;
-        instance->signal.timings_cnt = 0;
-        instance->signal.decoded = true;
-        if(instance->rx.received_signal_callback)
-            instance->rx.received_signal_callback(
-                instance->rx.received_signal_context, &instance->signal);
-    } else {
-        /* Skip first timing if it starts from Space */
-        if((instance->signal.timings_cnt == 0) && !level) {
-            return;
-        }
-
-        if(instance->signal.timings_cnt < MAX_TIMINGS_AMOUNT) {
+static void infrared_worker_process_timings(
+    InfraredWorker* instance,
+    const LevelDuration* timings,
+    size_t timings_cnt) {
+    for(size_t i = 0; (i < timings_cnt) && !instance->rx.overrun; ++i) {
+        bool level = level_duration_get_level(timings[i]);
+        uint32_t duration = level_duration_get_duration(timings[i]);
+
+        const InfraredMessage* message_decoded =
+            instance->decode_enable ?
+                infrared_decode(instance->infrared_decoder, level, duration) :
+                NULL;
+        if(message_decoded) {
+            instance->signal.message = *message_decoded;
+            instance->signal.timings_cnt = 0;
+            instance->signal.decoded = true;
+            if(instance->rx.received_signal_callback)
+                instance->rx.received_signal_callback(
+                    instance->rx.received_signal_context, &instance->signal);
+        } else if((instance->signal.timings_cnt == 0) && !level) {
+            /* Skip first timing if it starts from Space */
+        } else if(instance->signal.timings_cnt < MAX_TIMINGS_AMOUNT) {
             instance->signal.timings[instance->signal.timings_cnt] = duration;
             ++instance->signal.timings_cnt;
         } else {
@@ -163,7 +192,8 @@ static void
 static int32_t infrared_worker_rx_thread(void* thread_context) {
     InfraredWorker* instance = thread_context;
     uint32_t events = 0;
-    LevelDuration level_duration;
+    LevelDuration timings[INFRARED_WORKER_RX_BATCH_SIZE];
+    size_t received;
     TickType_t last_blink_time = 0;
 
     while(1) {
@@ -178,14 +208,10 @@ static int32_t infrared_worker_rx_thread(void* thread_context) {
             }
             if(instance->signal.timings_cnt == 0)
                 notification_message(instance->notification, &sequence_display_backlight_on);
-            while(sizeof(LevelDuration) ==
-                  furi_stream_buffer_receive(
-                      instance->stream, &level_duration, sizeof(LevelDuration), 0)) {
-                if(!instance->rx.overrun) {
-                    bool level = level_duration_get_level(level_duration);
-                    uint32_t duration = level_duration_get_duration(level_duration);
-                    infrared_worker_process_timings(instance, duration, level);
-                }
+            while((received = furi_stream_buffer_receive(
+                       instance->stream, timings, sizeof(timings), 0)) > 0) {
+                infrared_worker_process_timings(
+                    instance, timings, received / sizeof(LevelDuration));
             }
         }
         if(events & INFRARED_WORKER_OVERRUN) {
@@ -262,6 +288,7 @@ void infrared_worker_rx_start(InfraredWorker* instance) {
     furi_thread_set_callback(instance->thread, infrared_worker_rx_thread);
     furi_thread_start(instance->thread);
 
+    instance->rx.batch_cnt = 0;
     furi_hal_infrared_async_rx_set_capture_isr_callback(infrared_worker_rx_callback, instance);
     furi_hal_infrared_async_rx_set_timeout_isr_callback(
         infrared_worker_rx_timeout_callback, instance);
@@ -2,20 +2,113 @@
 
 #include <lib/toolbox/args.h>
 #include <lib/flipper_format/flipper_format.h>
+#include <lib/nfc/protocols/nfc_util.h>
 
 #define MF_CLASSIC_DICT_FLIPPER_PATH EXT_PATH("nfc/assets/mf_classic_dict.nfc")
 #define MF_CLASSIC_DICT_USER_PATH EXT_PATH("nfc/assets/mf_classic_dict_user.nfc")
 #define MF_CLASSIC_DICT_UNIT_TEST_PATH EXT_PATH("unit_tests/mf_classic_dict.nfc")
 
+#define MF_CLASSIC_DICT_INDEX_FOLDER EXT_PATH("nfc/.cache")
+#define MF_CLASSIC_DICT_FLIPPER_INDEX_PATH MF_CLASSIC_DICT_INDEX_FOLDER "/mf_classic_dict.idx"
+#define MF_CLASSIC_DICT_USER_INDEX_PATH MF_CLASSIC_DICT_INDEX_FOLDER "/mf_classic_dict_user.idx"
+#define MF_CLASSIC_DICT_UNIT_TEST_INDEX_PATH EXT_PATH("unit_tests/mf_classic_dict.idx")
+
 #define TAG "MfClassicDict"
 
 #define NFC_MF_CLASSIC_KEY_LEN (13)
+// Dictionaries are read sequentially, larger cache means fewer SD card transactions
+#define MF_CLASSIC_DICT_STREAM_CACHE_SIZE (4096)
+
+#define MF_CLASSIC_DICT_INDEX_MAGIC (0x4443464DUL)
+#define MF_CLASSIC_DICT_INDEX_VERSION (2)
+// Bucket count is a power of two, aiming for this many keys per bucket
+#define MF_CLASSIC_DICT_INDEX_BUCKET_LOAD (8)
+#define MF_CLASSIC_DICT_INDEX_BUCKETS_MIN (16)
+#define MF_CLASSIC_DICT_INDEX_BUCKETS_MAX (1024)
+// Text offset of every Nth key, for get_key_at_index
+#define MF_CLASSIC_DICT_INDEX_CHECKPOINT (64)
+// Entries sorted in RAM per build pass over the text file
+#define MF_CLASSIC_DICT_INDEX_BUILD_CHUNK (512)
+// Entries read from SD card at once during lookup
+#define MF_CLASSIC_DICT_INDEX_READ_CHUNK (16)
+// Keys appended after the build, kept unsorted until the next rebuild
+#define MF_CLASSIC_DICT_INDEX_TAIL_MAX (64)
+// Keys read from SD card at once during iteration
+#define MF_CLASSIC_DICT_KEY_CACHE_SIZE (64)
+
+#define MF_CLASSIC_DICT_HASH_OFFSET (2166136261UL)
+#define MF_CLASSIC_DICT_HASH_PRIME (16777619UL)
+
+/* Index file layout:
+ * - MfClassicDictIndexHeader
+ * - uint32_t bucket offsets [bucket_count + 1], in entries
+ * - uint32_t text checkpoints [checkpoint_count], in bytes
+ * - uint64_t keys in text order [sorted_keys]
+ * - MfClassicDictIndexEntry sorted by bucket, key and position [sorted_keys]
+ * - MfClassicDictIndexEntry appended keys [total_keys - sorted_keys]
+ *
+ * The text dictionary stays the source of truth: the index is only used
+ * when its text_hash and total_keys match the text file.
+ */
+typedef struct {
+    uint32_t magic;
+    uint32_t version;
+    uint32_t text_hash;
+    uint32_t total_keys;
+    uint32_t sorted_keys;
+    uint32_t bucket_count;
+    uint32_t checkpoint_count;
+} MfClassicDictIndexHeader;
+
+typedef struct __attribute__((packed)) {
+    uint64_t key;
+    uint32_t index;
+} MfClassicDictIndexEntry;
 
 struct MfClassicDict {
     Stream* stream;
+    FuriString* next_line;
     uint32_t total_keys;
+    uint32_t text_hash;
+    // Position of the next key, text stream is moved there lazily
+    uint32_t key_position;
+    bool stream_synced;
+
+    Stream* index_stream;
+    MfClassicDictIndexHeader index_header;
+    MfClassicDictIndexEntry index_tail[MF_CLASSIC_DICT_INDEX_TAIL_MAX];
+    bool index_valid;
+    bool index_failed;
+
+    uint64_t key_cache[MF_CLASSIC_DICT_KEY_CACHE_SIZE];
+    uint32_t key_cache_start;
+    uint32_t key_cache_count;
 };
 
+static bool mf_classic_dict_read_key_line(MfClassicDict* dict, FuriString* line) {
+    while(stream_read_line(dict->stream, line)) {
+        if(furi_string_get_char(line, 0) == '#') continue;
+        if(furi_string_size(line) != NFC_MF_CLASSIC_KEY_LEN) continue;
+        return true;
+    }
+    return false;
+}
+
+static uint32_t mf_classic_dict_text_hash(uint32_t hash, FuriString* key) {
+    for(size_t i = 0; i < 12; i++) {
+        hash ^= (uint8_t)furi_string_get_char(key, i);
+        hash *= MF_CLASSIC_DICT_HASH_PRIME;
+    }
+    return hash;
+}
+
+static uint32_t mf_classic_dict_key_hash(uint64_t key) {
+    key ^= key >> 29;
+    key *= 0xBF58476D1CE4E5B9ULL;
+    key ^= key >> 32;
+    return (uint32_t)key;
+}
+
 bool mf_classic_dict_check_presence(MfClassicDictType dict_type) {
     Storage* storage = furi_record_open(RECORD_STORAGE);
 
@@ -34,10 +127,85 @@ bool mf_classic_dict_check_presence(MfClassicDictType dict_type) {
     return dict_present;
 }
 
+static size_t mf_classic_dict_index_keys_offset(const MfClassicDictIndexHeader* header) {
+    return sizeof(MfClassicDictIndexHeader) + (header->bucket_count + 1) * sizeof(uint32_t) +
+           header->checkpoint_count * sizeof(uint32_t);
+}
+
+static size_t mf_classic_dict_index_entries_offset(const MfClassicDictIndexHeader* header) {
+    return mf_classic_dict_index_keys_offset(header) + header->sorted_keys * sizeof(uint64_t);
+}
+
+static bool mf_classic_dict_index_load(MfClassicDict* dict) {
+    MfClassicDictIndexHeader* header = &dict->index_header;
+    bool index_loaded = false;
+
+    do {
+        if(!stream_rewind(dict->index_stream)) break;
+        if(stream_read(dict->index_stream, (uint8_t*)header, sizeof(MfClassicDictIndexHeader)) !=
+           sizeof(MfClassicDictIndexHeader))
+            break;
+        if(header->magic != MF_CLASSIC_DICT_INDEX_MAGIC) break;
+        if(header->version != MF_CLASSIC_DICT_INDEX_VERSION) break;
+        if(header->text_hash != dict->text_hash) break;
+        if(header->total_keys != dict->total_keys) break;
+        if(header->sorted_keys > header->total_keys) break;
+        if(header->total_keys - header->sorted_keys > MF_CLASSIC_DICT_INDEX_TAIL_MAX) break;
+        if(header->bucket_count < MF_CLASSIC_DICT_INDEX_BUCKETS_MIN) break;
+        if(header->bucket_count > MF_CLASSIC_DICT_INDEX_BUCKETS_MAX) break;
+        if(header->bucket_count & (header->bucket_count - 1)) break;
+
+        size_t tail_size =
+            (header->total_keys - header->sorted_keys) * sizeof(MfClassicDictIndexEntry);
+        size_t tail_offset = mf_classic_dict_index_entries_offset(header) +
+                             header->sorted_keys * sizeof(MfClassicDictIndexEntry);
+        if(!stream_seek(dict->index_stream, tail_offset, StreamOffsetFromStart)) break;
+        if(stream_read(dict->index_stream, (uint8_t*)dict->index_tail, tail_size) != tail_size)
+            break;
+
+        index_loaded = true;
+    } while(false);
+
+    return index_loaded;
+}
+
+static void mf_classic_dict_index_open(MfClassicDict* dict, MfClassicDictType dict_type) {
+    Storage* storage = furi_record_open(RECORD_STORAGE);
+
+    const char* index_path = NULL;
+    if(dict_type == MfClassicDictTypeSystem) {
+        index_path = MF_CLASSIC_DICT_FLIPPER_INDEX_PATH;
+    } else if(dict_type == MfClassicDictTypeUser) {
+        index_path = MF_CLASSIC_DICT_USER_INDEX_PATH;
+    } else if(dict_type == MfClassicDictTypeUnitTest) {
+        index_path = MF_CLASSIC_DICT_UNIT_TEST_INDEX_PATH;
+    }
+
+    if(dict_type != MfClassicDictTypeUnitTest) {
+        storage_simply_mkdir(storage, MF_CLASSIC_DICT_INDEX_FOLDER);
+    }
+
+    dict->index_stream = file_stream_alloc(storage);
+    if(!index_path ||
+       !file_stream_open(dict->index_stream, index_path, FSAM_READ_WRITE, FSOM_OPEN_ALWAYS)) {
+        FURI_LOG_W(TAG, "Failed to open index, falling back to text search");
+        file_stream_close(dict->index_stream);
+        stream_free(dict->index_stream);
+        dict->index_stream = NULL;
+    } else {
+        // Stale or missing index is rebuilt on the first lookup
+        dict->index_valid = mf_classic_dict_index_load(dict);
+        FURI_LOG_D(TAG, "Index %s", dict->index_valid ? "loaded" : "is stale");
+    }
+
+    furi_record_close(RECORD_STORAGE);
+}
+
 MfClassicDict* mf_classic_dict_alloc(MfClassicDictType dict_type) {
     MfClassicDict* dict = malloc(sizeof(MfClassicDict));
     Storage* storage = furi_record_open(RECORD_STORAGE);
-    dict->stream = buffered_file_stream_alloc(storage);
+    dict->stream = buffered_file_stream_alloc_ex(storage, MF_CLASSIC_DICT_STREAM_CACHE_SIZE);
+    dict->next_line = furi_string_alloc();
     furi_record_close(RECORD_STORAGE);
 
     bool dict_loaded = false;
@@ -83,6 +251,7 @@ MfClassicDict* mf_classic_dict_alloc(MfClassicDictType dict_type) {
         // Read total amount of keys
         FuriString* next_line;
         next_line = furi_string_alloc();
+        dict->text_hash = MF_CLASSIC_DICT_HASH_OFFSET;
         while(true) {
             if(!stream_read_line(dict->stream, next_line)) {
                 FURI_LOG_T(TAG, "No keys left in dict");
@@ -95,17 +264,22 @@ MfClassicDict* mf_classic_dict_alloc(MfClassicDictType dict_type) {
                 furi_string_size(next_line));
             if(furi_string_get_char(next_line, 0) == '#') continue;
             if(furi_string_size(next_line) != NFC_MF_CLASSIC_KEY_LEN) continue;
+            dict->text_hash = mf_classic_dict_text_hash(dict->text_hash, next_line);
             dict->total_keys++;
         }
         furi_string_free(next_line);
         stream_rewind(dict->stream);
+        dict->stream_synced = true;
 
         dict_loaded = true;
         FURI_LOG_I(TAG, "Loaded dictionary with %lu keys", dict->total_keys);
+
+        mf_classic_dict_index_open(dict, dict_type);
     } while(false);
 
     if(!dict_loaded) {
         buffered_file_stream_close(dict->stream);
+        furi_string_free(dict->next_line);
         free(dict);
         dict = NULL;
     }
@@ -117,8 +291,13 @@ void mf_classic_dict_free(MfClassicDict* dict) {
     furi_assert(dict);
     furi_assert(dict->stream);
 
+    if(dict->index_stream) {
+        file_stream_close(dict->index_stream);
+        stream_free(dict->index_stream);
+    }
     buffered_file_stream_close(dict->stream);
     stream_free(dict->stream);
+    furi_string_free(dict->next_line);
     free(dict);
 }
 
@@ -140,6 +319,355 @@ static void mf_classic_dict_str_to_int(FuriString* key_str, uint64_t* key_int) {
     }
 }
 
+static int mf_classic_dict_index_entry_cmp(const void* a, const void* b) {
+    const MfClassicDictIndexEntry* entry_a = a;
+    const MfClassicDictIndexEntry* entry_b = b;
+    if(entry_a->key != entry_b->key) return entry_a->key < entry_b->key ? -1 : 1;
+    if(entry_a->index != entry_b->index) return entry_a->index < entry_b->index ? -1 : 1;
+    return 0;
+}
+
+static bool mf_classic_dict_index_write_header(MfClassicDict* dict) {
+    if(!stream_rewind(dict->index_stream)) return false;
+    return stream_write(
+               dict->index_stream,
+               (uint8_t*)&dict->index_header,
+               sizeof(MfClassicDictIndexHeader)) == sizeof(MfClassicDictIndexHeader);
+}
+
+static bool mf_classic_dict_index_build(MfClassicDict* dict) {
+    MfClassicDictIndexHeader* header = &dict->index_header;
+    memset(header, 0, sizeof(MfClassicDictIndexHeader));
+    header->version = MF_CLASSIC_DICT_INDEX_VERSION;
+    header->bucket_count = MF_CLASSIC_DICT_INDEX_BUCKETS_MIN;
+    while(header->bucket_count < MF_CLASSIC_DICT_INDEX_BUCKETS_MAX &&
+          header->bucket_count * MF_CLASSIC_DICT_INDEX_BUCKET_LOAD < dict->total_keys) {
+        header->bucket_count <<= 1;
+    }
+    header->checkpoint_count = (dict->total_keys + MF_CLASSIC_DICT_INDEX_CHECKPOINT - 1) /
+                               MF_CLASSIC_DICT_INDEX_CHECKPOINT;
+    uint32_t bucket_mask = header->bucket_count - 1;
+
+    size_t buckets_size = (header->bucket_count + 1) * sizeof(uint32_t);
+    size_t checkpoints_size = header->checkpoint_count * sizeof(uint32_t);
+    uint32_t* buckets = malloc(buckets_size);
+    uint32_t* checkpoints = malloc(checkpoints_size + sizeof(uint32_t));
+    memset(buckets, 0, buckets_size);
+    memset(checkpoints, 0, checkpoints_size);
+    MfClassicDictIndexEntry* entries = NULL;
+    FuriString* next_line = dict->next_line;
+    uint32_t start_tick = furi_get_tick();
+    // Key cache is used as write buffer, iteration reloads it
+    dict->key_cache_count = 0;
+    dict->stream_synced = false;
+
+    bool index_built = false;
+    do {
+        // Header stays invalid until all entries are written
+        stream_clean(dict->index_stream);
+        if(!mf_classic_dict_index_write_header(dict)) break;
+        if(stream_write(dict->index_stream, (uint8_t*)buckets, buckets_size) != buckets_size)
+            break;
+        if(stream_write(dict->index_stream, (uint8_t*)checkpoints, checkpoints_size) !=
+           checkpoints_size)
+            break;
+
+        // First pass: text hash, bucket sizes, checkpoints and keys in text order
+        uint32_t text_hash = MF_CLASSIC_DICT_HASH_OFFSET;
+        uint32_t total_keys = 0;
+        size_t cached = 0;
+        bool keys_written = true;
+        if(!stream_rewind(dict->stream)) break;
+        while(keys_written) {
+            size_t line_offset = stream_tell(dict->stream);
+            bool key_read = mf_classic_dict_read_key_line(dict, next_line);
+            if(cached == MF_CLASSIC_DICT_KEY_CACHE_SIZE || (!key_read && cached)) {
+                size_t cache_size = cached * sizeof(uint64_t);
+                keys_written = stream_write(
+                                   dict->index_stream, (uint8_t*)dict->key_cache, cache_size) ==
+                               cache_size;
+                cached = 0;
+            }
+            if(!key_read) break;
+            if(total_keys % MF_CLASSIC_DICT_INDEX_CHECKPOINT == 0 &&
+               total_keys / MF_CLASSIC_DICT_INDEX_CHECKPOINT < header->checkpoint_count) {
+                checkpoints[total_keys / MF_CLASSIC_DICT_INDEX_CHECKPOINT] = line_offset;
+            }
+            uint64_t key = 0;
+            mf_classic_dict_str_to_int(next_line, &key);
+            dict->key_cache[cached++] = key;
+            buckets[(mf_classic_dict_key_hash(key) & bucket_mask) + 1]++;
+            text_hash = mf_classic_dict_text_hash(text_hash, next_line);
+            total_keys++;
+        }
+        if(!keys_written) break;
+        if(total_keys != dict->total_keys) {
+            FURI_LOG_E(TAG, "Key count mismatch: %lu, expected %lu", total_keys, dict->total_keys);
+            break;
+        }
+
+        uint32_t capacity = MF_CLASSIC_DICT_INDEX_BUILD_CHUNK;
+        for(size_t i = 0; i < header->bucket_count; i++) {
+            capacity = MAX(capacity, buckets[i + 1]);
+            buckets[i + 1] += buckets[i];
+        }
+
+        header->sorted_keys = total_keys;
+        size_t buckets_offset = sizeof(MfClassicDictIndexHeader);
+        if(!stream_seek(dict->index_stream, buckets_offset, StreamOffsetFromStart)) break;
+        if(stream_write(dict->index_stream, (uint8_t*)buckets, buckets_size) != buckets_size)
+            break;
+        if(stream_write(dict->index_stream, (uint8_t*)checkpoints, checkpoints_size) !=
+           checkpoints_size)
+            break;
+        size_t entries_offset = mf_classic_dict_index_entries_offset(header);
+        if(!stream_seek(dict->index_stream, entries_offset, StreamOffsetFromStart)) break;
+
+        // Following passes: sort as many whole buckets as fit into RAM at once
+        entries = malloc(capacity * sizeof(MfClassicDictIndexEntry));
+        uint32_t bucket_start = 0;
+        while(bucket_start < header->bucket_count) {
+            uint32_t bucket_end = bucket_start + 1;
+            while(bucket_end < header->bucket_count &&
+                  buckets[bucket_end + 1] - buckets[bucket_start] <= capacity) {
+                bucket_end++;
+            }
+            uint32_t base = buckets[bucket_start];
+            size_t count = buckets[bucket_end] - base;
+            if(count) {
+                // Bucket offsets are already on SD card, reuse them as fill cursors
+                size_t collected = 0;
+                uint32_t key_index = 0;
+                if(!stream_rewind(dict->stream)) break;
+                while(mf_classic_dict_read_key_line(dict, next_line)) {
+                    uint64_t key = 0;
+                    mf_classic_dict_str_to_int(next_line, &key);
+                    uint32_t bucket = mf_classic_dict_key_hash(key) & bucket_mask;
+                    if(bucket >= bucket_start && bucket < bucket_end) {
+                        if(buckets[bucket] - base >= count) break;
+                        MfClassicDictIndexEntry* entry = &entries[buckets[bucket]++ - base];
+                        entry->key = key;
+                        entry->index = key_index;
+                        collected++;
+                    }
+                    key_index++;
+                }
+                if(collected != count) break;
+                // Each cursor now points at the end of its bucket
+                uint32_t bucket_offset = base;
+                for(uint32_t bucket = bucket_start; bucket < bucket_end; bucket++) {
+                    qsort(
+                        &entries[bucket_offset - base],
+                        buckets[bucket] - bucket_offset,
+                        sizeof(MfClassicDictIndexEntry),
+                        mf_classic_dict_index_entry_cmp);
+                    bucket_offset = buckets[bucket];
+                }
+                size_t entries_size = count * sizeof(MfClassicDictIndexEntry);
+                if(stream_write(dict->index_stream, (uint8_t*)entries, entries_size) !=
+                   entries_size)
+                    break;
+            }
+            bucket_start = bucket_end;
+        }
+        if(bucket_start != header->bucket_count) break;
+
+        header->magic = MF_CLASSIC_DICT_INDEX_MAGIC;
+        header->text_hash = text_hash;
+        header->total_keys = total_keys;
+        if(!mf_classic_dict_index_write_header(dict)) break;
+
+        dict->text_hash = text_hash;
+        index_built = true;
+        FURI_LOG_I(
+            TAG,
+            "Index built for %lu keys in %lu ms",
+            total_keys,
+            furi_get_tick() - start_tick);
+    } while(false);
+
+    if(!index_built) {
+        FURI_LOG_E(TAG, "Failed to build index");
+        memset(header, 0, sizeof(MfClassicDictIndexHeader));
+    }
+
+    if(entries) free(entries);
+    free(checkpoints);
+    free(buckets);
+
+    return index_built;
+}
+
+static bool mf_classic_dict_index_prepare(MfClassicDict* dict) {
+    if(!dict->index_stream) return false;
+    if(!dict->index_valid && !dict->index_failed) {
+        dict->index_valid = mf_classic_dict_index_build(dict);
+        dict->index_failed = !dict->index_valid;
+    }
+    return dict->index_valid;
+}
+
+static bool mf_classic_dict_index_find(
+    MfClassicDict* dict,
+    uint64_t key,
+    bool* key_found,
+    uint32_t* target) {
+    const MfClassicDictIndexHeader* header = &dict->index_header;
+    uint32_t bucket = mf_classic_dict_key_hash(key) & (header->bucket_count - 1);
+    uint32_t range[2] = {};
+    MfClassicDictIndexEntry entries[MF_CLASSIC_DICT_INDEX_READ_CHUNK];
+
+    *key_found = false;
+    bool index_read = false;
+    do {
+        size_t range_offset = sizeof(MfClassicDictIndexHeader) + bucket * sizeof(uint32_t);
+        if(!stream_seek(dict->index_stream, range_offset, StreamOffsetFromStart)) break;
+        if(stream_read(dict->index_stream, (uint8_t*)range, sizeof(range)) != sizeof(range)) break;
+        if(range[0] > range[1] || range[1] > header->sorted_keys) break;
+
+        size_t entries_offset = mf_classic_dict_index_entries_offset(header) +
+                                range[0] * sizeof(MfClassicDictIndexEntry);
+        if(!stream_seek(dict->index_stream, entries_offset, StreamOffsetFromStart)) break;
+
+        // Bucket is sorted by key, then by position in the text file
+        bool bucket_done = false;
+        uint32_t position = range[0];
+        while(position < range[1] && !bucket_done) {
+            size_t count = MIN(range[1] - position, (uint32_t)MF_CLASSIC_DICT_INDEX_READ_CHUNK);
+            size_t entries_size = count * sizeof(MfClassicDictIndexEntry);
+            if(stream_read(dict->index_stream, (uint8_t*)entries, entries_size) != entries_size)
+                break;
+            for(size_t i = 0; i < count; i++) {
+                if(entries[i].key < key) continue;
+                if(entries[i].key == key) {
+                    *key_found = true;
+                    *target = entries[i].index;
+                }
+                bucket_done = true;
+                break;
+            }
+            position += count;
+        }
+        if(!bucket_done && position < range[1]) break;
+
+        // Appended keys come after all sorted ones in the text file
+        size_t tail_count = header->total_keys - header->sorted_keys;
+        for(size_t i = 0; i < tail_count && !*key_found; i++) {
+            if(dict->index_tail[i].key == key) {
+                *key_found = true;
+                *target = dict->index_tail[i].index;
+            }
+        }
+
+        index_read = true;
+    } while(false);
+
+    return index_read;
+}
+
+static bool mf_classic_dict_index_append(MfClassicDict* dict, FuriString* key) {
+    MfClassicDictIndexHeader* header = &dict->index_header;
+    size_t tail_count = header->total_keys - header->sorted_keys;
+    if(tail_count >= MF_CLASSIC_DICT_INDEX_TAIL_MAX) return false;
+
+    uint64_t key_int = 0;
+    mf_classic_dict_str_to_int(key, &key_int);
+    MfClassicDictIndexEntry* entry = &dict->index_tail[tail_count];
+    entry->key = key_int;
+    entry->index = header->total_keys;
+
+    size_t entry_offset = mf_classic_dict_index_entries_offset(header) +
+                          header->total_keys * sizeof(MfClassicDictIndexEntry);
+    if(!stream_seek(dict->index_stream, entry_offset, StreamOffsetFromStart)) return false;
+    if(stream_write(dict->index_stream, (uint8_t*)entry, sizeof(MfClassicDictIndexEntry)) !=
+       sizeof(MfClassicDictIndexEntry))
+        return false;
+
+    header->text_hash = dict->text_hash;
+    header->total_keys = dict->total_keys;
+    return mf_classic_dict_index_write_header(dict);
+}
+
+static bool mf_classic_dict_index_seek(MfClassicDict* dict, uint32_t target, uint32_t* skipped) {
+    const MfClassicDictIndexHeader* header = &dict->index_header;
+    uint32_t checkpoint = target / MF_CLASSIC_DICT_INDEX_CHECKPOINT;
+    if(checkpoint >= header->checkpoint_count) {
+        checkpoint = header->checkpoint_count;
+        if(checkpoint == 0) return false;
+        checkpoint--;
+    }
+
+    uint32_t line_offset = 0;
+    size_t checkpoint_offset = sizeof(MfClassicDictIndexHeader) +
+                               (header->bucket_count + 1 + checkpoint) * sizeof(uint32_t);
+    if(!stream_seek(dict->index_stream, checkpoint_offset, StreamOffsetFromStart)) return false;
+    if(stream_read(dict->index_stream, (uint8_t*)&line_offset, sizeof(uint32_t)) !=
+       sizeof(uint32_t))
+        return false;
+    if(!stream_seek(dict->stream, line_offset, StreamOffsetFromStart)) return false;
+
+    *skipped = checkpoint * MF_CLASSIC_DICT_INDEX_CHECKPOINT;
+    return true;
+}
+
+static bool mf_classic_dict_index_get_key(MfClassicDict* dict, uint64_t* key) {
+    const MfClassicDictIndexHeader* header = &dict->index_header;
+    uint32_t position = dict->key_position;
+    if(position >= header->total_keys) return false;
+
+    if(position >= header->sorted_keys) {
+        *key = dict->index_tail[position - header->sorted_keys].key;
+        return true;
+    }
+
+    if(position < dict->key_cache_start ||
+       position >= dict->key_cache_start + dict->key_cache_count) {
+        size_t count =
+            MIN(header->sorted_keys - position, (uint32_t)MF_CLASSIC_DICT_KEY_CACHE_SIZE);
+        size_t cache_size = count * sizeof(uint64_t);
+        size_t cache_offset =
+            mf_classic_dict_index_keys_offset(header) + position * sizeof(uint64_t);
+        dict->key_cache_count = 0;
+        if(!stream_seek(dict->index_stream, cache_offset, StreamOffsetFromStart)) return false;
+        if(stream_read(dict->index_stream, (uint8_t*)dict->key_cache, cache_size) != cache_size)
+            return false;
+        dict->key_cache_start = position;
+        dict->key_cache_count = count;
+    }
+
+    *key = dict->key_cache[position - dict->key_cache_start];
+    return true;
+}
+
+static bool mf_classic_dict_seek_key(MfClassicDict* dict, uint32_t position) {
+    uint32_t current = 0;
+    bool synced_before = dict->stream_synced && dict->key_position <= position;
+    dict->stream_synced = false;
+
+    if(synced_before && position - dict->key_position < MF_CLASSIC_DICT_INDEX_CHECKPOINT) {
+        current = dict->key_position;
+    } else if(dict->index_valid && mf_classic_dict_index_seek(dict, position, &current)) {
+        // Closest checkpoint
+    } else if(synced_before) {
+        current = dict->key_position;
+    } else if(!stream_rewind(dict->stream)) {
+        return false;
+    }
+
+    bool key_reached = true;
+    while(current < position) {
+        if(!mf_classic_dict_read_key_line(dict, dict->next_line)) {
+            key_reached = false;
+            break;
+        }
+        current++;
+    }
+
+    dict->key_position = current;
+    dict->stream_synced = true;
+    return key_reached;
+}
+
 uint32_t mf_classic_dict_get_total_keys(MfClassicDict* dict) {
     furi_assert(dict);
 
@@ -150,70 +678,54 @@ bool mf_classic_dict_rewind(MfClassicDict* dict) {
     furi_assert(dict);
     furi_assert(dict->stream);
 
-    return stream_rewind(dict->stream);
+    dict->key_position = 0;
+    dict->stream_synced = stream_rewind(dict->stream);
+    return dict->stream_synced;
 }
 
 bool mf_classic_dict_get_next_key_str(MfClassicDict* dict, FuriString* key) {
     furi_assert(dict);
     furi_assert(dict->stream);
 
-    bool key_read = false;
     furi_string_reset(key);
-    while(!key_read) {
-        if(!stream_read_line(dict->stream, key)) break;
-        if(furi_string_get_char(key, 0) == '#') continue;
-        if(furi_string_size(key) != NFC_MF_CLASSIC_KEY_LEN) continue;
-        furi_string_left(key, 12);
-        key_read = true;
-    }
+    if(!mf_classic_dict_seek_key(dict, dict->key_position)) return false;
+    if(!mf_classic_dict_read_key_line(dict, key)) return false;
 
-    return key_read;
+    furi_string_left(key, 12);
+    dict->key_position++;
+    return true;
 }
 
 bool mf_classic_dict_get_next_key(MfClassicDict* dict, uint64_t* key) {
     furi_assert(dict);
     furi_assert(dict->stream);
 
-    FuriString* temp_key;
-    temp_key = furi_string_alloc();
-    bool key_read = mf_classic_dict_get_next_key_str(dict, temp_key);
-    if(key_read) {
-        mf_classic_dict_str_to_int(temp_key, key);
+    if(dict->key_position >= dict->total_keys) return false;
+
+    // Pre-parsed keys from the index, text is parsed only if the index is not available
+    if(mf_classic_dict_index_prepare(dict) && mf_classic_dict_index_get_key(dict, key)) {
+        dict->stream_synced = false;
+    } else {
+        if(!mf_classic_dict_seek_key(dict, dict->key_position)) return false;
+        if(!mf_classic_dict_read_key_line(dict, dict->next_line)) return false;
+        mf_classic_dict_str_to_int(dict->next_line, key);
     }
-    furi_string_free(temp_key);
-    return key_read;
+
+    dict->key_position++;
+    return true;
 }
 
 bool mf_classic_dict_is_key_present_str(MfClassicDict* dict, FuriString* key) {
     furi_assert(dict);
     furi_assert(dict->stream);
 
-    FuriString* next_line;
-    next_line = furi_string_alloc();
-
-    bool key_found = false;
-    stream_rewind(dict->stream);
-    while(!key_found) { //-V654
-        if(!stream_read_line(dict->stream, next_line)) break;
-        if(furi_string_get_char(next_line, 0) == '#') continue;
-        if(furi_string_size(next_line) != NFC_MF_CLASSIC_KEY_LEN) continue;
-        furi_string_left(next_line, 12);
-        if(!furi_string_equal(key, next_line)) continue;
-        key_found = true;
-    }
-
-    furi_string_free(next_line);
-    return key_found;
+    uint32_t target = 0;
+    return mf_classic_dict_find_index_str(dict, key, &target);
 }
 
 bool mf_classic_dict_is_key_present(MfClassicDict* dict, uint8_t* key) {
-    FuriString* temp_key;
-
-    temp_key = furi_string_alloc();
-    mf_classic_dict_int_to_str(key, temp_key);
-    bool key_found = mf_classic_dict_is_key_present_str(dict, temp_key);
-    furi_string_free(temp_key);
-    return key_found;
+    uint32_t target = 0;
+    return mf_classic_dict_find_index(dict, key, &target);
 }
 
 bool mf_classic_dict_add_key_str(MfClassicDict* dict, FuriString* key) {
@@ -224,10 +736,22 @@ bool mf_classic_dict_add_key_str(MfClassicDict* dict, FuriString* key) {
 
     bool key_added = false;
     do {
+        // Iteration position is kept, text stream is moved back on the next read
+        dict->stream_synced = false;
         if(!stream_seek(dict->stream, 0, StreamOffsetFromEnd)) break;
         if(!stream_insert_string(dict->stream, key)) break;
         dict->total_keys++;
         key_added = true;
+
+        if(furi_string_size(key) == NFC_MF_CLASSIC_KEY_LEN) {
+            dict->text_hash = mf_classic_dict_text_hash(dict->text_hash, key);
+        } else {
+            dict->index_valid = false;
+        }
+        if(dict->index_valid && !mf_classic_dict_index_append(dict, key)) {
+            // Rebuilt on the next lookup
+            dict->index_valid = false;
+        }
     } while(false);
 
     furi_string_left(key, 12);
@@ -251,23 +775,13 @@ bool mf_classic_dict_get_key_at_index_str(MfClassicDict* dict, FuriString* key,
     furi_assert(dict);
     furi_assert(dict->stream);
 
-    FuriString* next_line;
-    uint32_t index = 0;
-    next_line = furi_string_alloc();
     furi_string_reset(key);
+    if(!mf_classic_dict_seek_key(dict, dict->key_position + target)) return false;
+    if(!mf_classic_dict_read_key_line(dict, dict->next_line)) return false;
 
-    bool key_found = false;
-    while(!key_found) {
-        if(!stream_read_line(dict->stream, next_line)) break;
-        if(furi_string_get_char(next_line, 0) == '#') continue;
-        if(furi_string_size(next_line) != NFC_MF_CLASSIC_KEY_LEN) continue;
-        if(index++ != target) continue;
-        furi_string_set_n(key, next_line, 0, 12);
-        key_found = true;
-    }
-
-    furi_string_free(next_line);
-    return key_found;
+    furi_string_set_n(key, dict->next_line, 0, 12);
+    dict->key_position++;
+    return true;
 }
 
 bool mf_classic_dict_get_key_at_index(MfClassicDict* dict, uint64_t* key, uint32_t target) {
@@ -284,63 +798,68 @@ bool mf_classic_dict_get_key_at_index(MfClassicDict* dict, uint64_t* key, uint32
     return key_found;
 }
 
-bool mf_classic_dict_find_index_str(MfClassicDict* dict, FuriString* key, uint32_t* target) {
-    furi_assert(dict);
-    furi_assert(dict->stream);
-
-    FuriString* next_line;
-    next_line = furi_string_alloc();
-
+static bool mf_classic_dict_find_index_int(MfClassicDict* dict, uint64_t key, uint32_t* target) {
     bool key_found = false;
+    if(mf_classic_dict_index_prepare(dict) &&
+       mf_classic_dict_index_find(dict, key, &key_found, target)) {
+        return key_found;
+    }
+
+    // Index is not available, fall back to the text search
     uint32_t index = 0;
+    dict->stream_synced = false;
     stream_rewind(dict->stream);
     while(!key_found) { //-V654
-        if(!stream_read_line(dict->stream, next_line)) break;
-        if(furi_string_get_char(next_line, 0) == '#') continue;
-        if(furi_string_size(next_line) != NFC_MF_CLASSIC_KEY_LEN) continue;
-        furi_string_left(next_line, 12);
-        if(!furi_string_equal(key, next_line)) continue;
-        key_found = true;
-        *target = index;
+        if(!mf_classic_dict_read_key_line(dict, dict->next_line)) break;
+        uint64_t next_key = 0;
+        mf_classic_dict_str_to_int(dict->next_line, &next_key);
+        if(next_key == key) {
+            key_found = true;
+            *target = index;
+        }
+        index++;
     }
 
-    furi_string_free(next_line);
     return key_found;
 }
 
-bool mf_classic_dict_find_index(MfClassicDict* dict, uint8_t* key, uint32_t* target) {
+bool mf_classic_dict_find_index_str(MfClassicDict* dict, FuriString* key, uint32_t* target) {
     furi_assert(dict);
     furi_assert(dict->stream);
 
-    FuriString* temp_key;
-    temp_key = furi_string_alloc();
-    mf_classic_dict_int_to_str(key, temp_key);
-    bool key_found = mf_classic_dict_find_index_str(dict, temp_key, target);
+    if(furi_string_size(key) != NFC_MF_CLASSIC_KEY_LEN - 1) return false;
 
-    furi_string_free(temp_key);
-    return key_found;
+    uint64_t key_int = 0;
+    mf_classic_dict_str_to_int(key, &key_int);
+    return mf_classic_dict_find_index_int(dict, key_int, target);
 }
 
-bool mf_classic_dict_delete_index(MfClassicDict* dict, uint32_t target) {
+bool mf_classic_dict_find_index(MfClassicDict* dict, uint8_t* key, uint32_t* target) {
     furi_assert(dict);
     furi_assert(dict->stream);
 
-    FuriString* next_line;
-    next_line = furi_string_alloc();
-    uint32_t index = 0;
+    return mf_classic_dict_find_index_int(dict, nfc_util_bytes2num(key, 6), target);
+}
+
+bool mf_classic_dict_delete_index(MfClassicDict* dict, uint32_t target) {
+    furi_assert(dict);
+    furi_assert(dict->stream);
 
     bool key_removed = false;
-    while(!key_removed) {
-        if(!stream_read_line(dict->stream, next_line)) break;
-        if(furi_string_get_char(next_line, 0) == '#') continue;
-        if(furi_string_size(next_line) != NFC_MF_CLASSIC_KEY_LEN) continue;
-        if(index++ != target) continue;
+    do {
+        uint32_t position = dict->key_position + target;
+        if(!mf_classic_dict_seek_key(dict, position)) break;
+        if(!mf_classic_dict_read_key_line(dict, dict->next_line)) break;
         stream_seek(dict->stream, -NFC_MF_CLASSIC_KEY_LEN, StreamOffsetFromCurrent);
-        if(!stream_delete(dict->stream, NFC_MF_CLASSIC_KEY_LEN)) break;
+        if(!stream_delete(dict->stream, NFC_MF_CLASSIC_KEY_LEN)) {
+            dict->stream_synced = false;
+            break;
+        }
         dict->total_keys--;
         key_removed = true;
-    }
+        // Positions of all following keys have changed
+        dict->index_valid = false;
+    } while(false);
 
-    furi_string_free(next_line);
     return key_removed;
 }
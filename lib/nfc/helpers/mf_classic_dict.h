@@ -50,6 +50,16 @@ bool mf_classic_dict_is_key_present(MfClassicDict* dict, uint8_t* key);
 
 bool mf_classic_dict_is_key_present_str(MfClassicDict* dict, FuriString* key);
 
+/** Get next key as uint64_t
+ *
+ * Keys are read pre-parsed from the dictionary index without allocations.
+ * The index is built on the first call if it is missing or outdated.
+ *
+ * @param      dict  MfClassicDict instance
+ * @param[out] key   Pointer to the uint64_t key
+ *
+ * @return     true on success, false if there are no keys left
+ */
 bool mf_classic_dict_get_next_key(MfClassicDict* dict, uint64_t* key);
 
 bool mf_classic_dict_get_next_key_str(MfClassicDict* dict, FuriString* key);
@@ -0,0 +1,155 @@
+#include "mf_classic_key_scheduler.h"
+
+#include <furi.h>
+#include <lib/nfc/protocols/nfc_util.h>
+
+#define TAG "MfClassicKeyScheduler"
+
+// Slot priorities for the current key, highest goes first
+#define MF_CLASSIC_KEY_SCHEDULER_PRIORITY_SIBLING (3)
+#define MF_CLASSIC_KEY_SCHEDULER_PRIORITY_NEIGHBOUR (2)
+#define MF_CLASSIC_KEY_SCHEDULER_PRIORITY_KEY_A (1)
+#define MF_CLASSIC_KEY_SCHEDULER_PRIORITY_KEY_B (0)
+
+struct MfClassicKeyScheduler {
+    MfClassicData* data;
+    uint8_t total_sectors;
+    uint64_t key;
+    // Slots the current key was tried on
+    uint64_t tried_a_mask;
+    uint64_t tried_b_mask;
+};
+
+MfClassicKeyScheduler* mf_classic_key_scheduler_alloc(MfClassicData* data) {
+    furi_assert(data);
+
+    MfClassicKeyScheduler* instance = malloc(sizeof(MfClassicKeyScheduler));
+    instance->data = data;
+    instance->total_sectors = mf_classic_get_total_sectors_num(data->type);
+
+    return instance;
+}
+
+void mf_classic_key_scheduler_free(MfClassicKeyScheduler* instance) {
+    furi_assert(instance);
+
+    free(instance);
+}
+
+void mf_classic_key_scheduler_set_key(MfClassicKeyScheduler* instance, uint64_t key) {
+    furi_assert(instance);
+
+    instance->key = key;
+    instance->tried_a_mask = 0;
+    instance->tried_b_mask = 0;
+}
+
+static bool mf_classic_key_scheduler_is_tried(
+    MfClassicKeyScheduler* instance,
+    uint8_t sector,
+    MfClassicKey key_type) {
+    uint64_t mask = (key_type == MfClassicKeyA) ? instance->tried_a_mask : instance->tried_b_mask;
+    return (mask >> sector) & 1;
+}
+
+static bool mf_classic_key_scheduler_is_current_key(
+    MfClassicKeyScheduler* instance,
+    uint8_t sector,
+    MfClassicKey key_type) {
+    if(!mf_classic_is_key_found(instance->data, sector, key_type)) return false;
+
+    MfClassicSectorTrailer* sec_tr =
+        mf_classic_get_sector_trailer_by_sector(instance->data, sector);
+    uint8_t* key = (key_type == MfClassicKeyA) ? sec_tr->key_a : sec_tr->key_b;
+    return nfc_util_bytes2num(key, MF_CLASSIC_KEY_SIZE) == instance->key;
+}
+
+static uint8_t mf_classic_key_scheduler_get_priority(
+    MfClassicKeyScheduler* instance,
+    uint8_t sector,
+    MfClassicKey key_type) {
+    MfClassicKey other_key_type = (key_type == MfClassicKeyA) ? MfClassicKeyB : MfClassicKeyA;
+
+    // Same key is often used for both A and B
+    if(mf_classic_key_scheduler_is_current_key(instance, sector, other_key_type)) {
+        return MF_CLASSIC_KEY_SCHEDULER_PRIORITY_SIBLING;
+    }
+    // Sectors of one application usually share keys
+    if(sector > 0 && mf_classic_key_scheduler_is_current_key(instance, sector - 1, key_type)) {
+        return MF_CLASSIC_KEY_SCHEDULER_PRIORITY_NEIGHBOUR;
+    }
+    if(sector + 1 < instance->total_sectors &&
+       mf_classic_key_scheduler_is_current_key(instance, sector + 1, key_type)) {
+        return MF_CLASSIC_KEY_SCHEDULER_PRIORITY_NEIGHBOUR;
+    }
+
+    return (key_type == MfClassicKeyA) ? MF_CLASSIC_KEY_SCHEDULER_PRIORITY_KEY_A :
+                                         MF_CLASSIC_KEY_SCHEDULER_PRIORITY_KEY_B;
+}
+
+bool mf_classic_key_scheduler_get_next_slot(
+    MfClassicKeyScheduler* instance,
+    MfClassicKeySlot* slot) {
+    furi_assert(instance);
+    furi_assert(slot);
+
+    bool slot_found = false;
+    uint8_t best_priority = 0;
+    for(uint8_t sector = 0; sector < instance->total_sectors; sector++) {
+        for(MfClassicKey key_type = MfClassicKeyA; key_type <= MfClassicKeyB; key_type++) {
+            if(mf_classic_is_key_found(instance->data, sector, key_type)) continue;
+            if(mf_classic_key_scheduler_is_tried(instance, sector, key_type)) continue;
+            uint8_t priority = mf_classic_key_scheduler_get_priority(instance, sector, key_type);
+            if(slot_found && priority <= best_priority) continue;
+            slot->sector = sector;
+            slot->key_type = key_type;
+            best_priority = priority;
+            slot_found = true;
+        }
+    }
+
+    return slot_found;
+}
+
+void mf_classic_key_scheduler_set_result(
+    MfClassicKeyScheduler* instance,
+    const MfClassicKeySlot* slot,
+    bool key_found) {
+    furi_assert(instance);
+    furi_assert(slot);
+    furi_assert(slot->sector < instance->total_sectors);
+
+    if(slot->key_type == MfClassicKeyA) {
+        instance->tried_a_mask |= 1ULL << slot->sector;
+    } else {
+        instance->tried_b_mask |= 1ULL << slot->sector;
+    }
+
+    if(key_found) {
+        FURI_LOG_D(
+            TAG,
+            "Key %c found for sector %d",
+            slot->key_type == MfClassicKeyA ? 'A' : 'B',
+            slot->sector);
+        mf_classic_set_key_found(instance->data, slot->sector, slot->key_type, instance->key);
+    }
+}
+
+uint8_t mf_classic_key_scheduler_get_first_unknown_sector(MfClassicKeyScheduler* instance) {
+    furi_assert(instance);
+
+    uint8_t sector = 0;
+    for(; sector < instance->total_sectors; sector++) {
+        if(!mf_classic_is_key_found(instance->data, sector, MfClassicKeyA)) break;
+        if(!mf_classic_is_key_found(instance->data, sector, MfClassicKeyB)) break;
+    }
+
+    return sector;
+}
+
+bool mf_classic_key_scheduler_is_done(MfClassicKeyScheduler* instance) {
+    furi_assert(instance);
+
+    return mf_classic_key_scheduler_get_first_unknown_sector(instance) ==
+           instance->total_sectors;
+}
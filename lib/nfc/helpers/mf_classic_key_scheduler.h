@@ -0,0 +1,84 @@
+#pragma once
+
+#include <lib/nfc/protocols/mifare_classic.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+typedef struct {
+    uint8_t sector;
+    MfClassicKey key_type;
+} MfClassicKeySlot;
+
+typedef struct MfClassicKeyScheduler MfClassicKeyScheduler;
+
+/** Allocate MfClassicKeyScheduler instance
+ *
+ * Scheduler decides in which order dictionary keys are tried on sector key slots.
+ * Every key is tried on all slots that are still unknown before the next key.
+ *
+ * @param      data  MfClassicData instance, found keys are stored there
+ *
+ * @return     MfClassicKeyScheduler instance
+ */
+MfClassicKeyScheduler* mf_classic_key_scheduler_alloc(MfClassicData* data);
+
+/** Free MfClassicKeyScheduler instance
+ *
+ * @param      instance  MfClassicKeyScheduler instance
+ */
+void mf_classic_key_scheduler_free(MfClassicKeyScheduler* instance);
+
+/** Start trying a new key
+ *
+ * @param      instance  MfClassicKeyScheduler instance
+ * @param[in]  key       Key to try
+ */
+void mf_classic_key_scheduler_set_key(MfClassicKeyScheduler* instance, uint64_t key);
+
+/** Get next slot to try the current key on
+ *
+ * Slots where the key is more likely to match go first: the other key of a
+ * sector that already uses it, then sectors next to the ones that use it.
+ * Slot stays pending until its result is set.
+ *
+ * @param      instance  MfClassicKeyScheduler instance
+ * @param[out] slot      Slot to try
+ *
+ * @return     true if there is a slot to try, false if the key was tried on all unknown slots
+ */
+bool mf_classic_key_scheduler_get_next_slot(
+    MfClassicKeyScheduler* instance,
+    MfClassicKeySlot* slot);
+
+/** Set result of trying the current key on the slot
+ *
+ * @param      instance   MfClassicKeyScheduler instance
+ * @param[in]  slot       Tried slot
+ * @param[in]  key_found  true if authentication succeeded
+ */
+void mf_classic_key_scheduler_set_result(
+    MfClassicKeyScheduler* instance,
+    const MfClassicKeySlot* slot,
+    bool key_found);
+
+/** Get the lowest sector with a key that is still unknown
+ *
+ * @param      instance  MfClassicKeyScheduler instance
+ *
+ * @return     sector number, total sectors count if all keys are found
+ */
+uint8_t mf_classic_key_scheduler_get_first_unknown_sector(MfClassicKeyScheduler* instance);
+
+/** Check if all keys are found
+ *
+ * @param      instance  MfClassicKeyScheduler instance
+ *
+ * @return     true if there is nothing left to try
+ */
+bool mf_classic_key_scheduler_is_done(MfClassicKeyScheduler* instance);
+
+#ifdef __cplusplus
+}
+#endif
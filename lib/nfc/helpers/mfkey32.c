@@ -20,18 +20,6 @@ typedef enum {
     Mfkey32StateAuthArNrReceived,
 } Mfkey32State;
 
-typedef struct {
-    uint32_t cuid;
-    uint8_t sector;
-    MfClassicKey key;
-    uint32_t nt0;
-    uint32_t nr0;
-    uint32_t ar0;
-    uint32_t nt1;
-    uint32_t nr1;
-    uint32_t ar1;
-} Mfkey32Params;
-
 ARRAY_DEF(Mfkey32Params, Mfkey32Params, M_POD_OPLIST);
 
 typedef struct {
@@ -107,6 +95,32 @@ static bool mfkey32_write_params(Mfkey32* instance, Mfkey32Params* params) {
     return write_success;
 }
 
+bool mfkey32_parse_params(FuriString* line, Mfkey32Params* params) {
+    furi_assert(line);
+    furi_assert(params);
+
+    int sector = 0;
+    char key = 0;
+    int parsed = sscanf(
+        furi_string_get_cstr(line),
+        "Sec %d key %c cuid %lx nt0 %lx nr0 %lx ar0 %lx nt1 %lx nr1 %lx ar1 %lx",
+        &sector,
+        &key,
+        &params->cuid,
+        &params->nt0,
+        &params->nr0,
+        &params->ar0,
+        &params->nt1,
+        &params->nr1,
+        &params->ar1);
+    if((parsed != 9) || (sector < 0) || (sector >= MF_CLASSIC_SECTORS_MAX)) return false;
+    if((key != 'A') && (key != 'B')) return false;
+    params->sector = sector;
+    params->key = (key == 'A') ? MfClassicKeyA : MfClassicKeyB;
+
+    return true;
+}
+
 static void mfkey32_add_params(Mfkey32* instance) {
     Mfkey32Nonce* nonce = &instance->nonce;
     bool nonce_added = false;
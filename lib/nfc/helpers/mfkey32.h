@@ -4,6 +4,18 @@
 
 typedef struct Mfkey32 Mfkey32;
 
+typedef struct {
+    uint32_t cuid;
+    uint8_t sector;
+    MfClassicKey key;
+    uint32_t nt0;
+    uint32_t nr0;
+    uint32_t ar0;
+    uint32_t nt1;
+    uint32_t nr1;
+    uint32_t ar1;
+} Mfkey32Params;
+
 typedef enum {
     Mfkey32EventParamCollected,
 } Mfkey32Event;
@@ -24,3 +36,12 @@ void mfkey32_process_data(
 void mfkey32_set_callback(Mfkey32* instance, Mfkey32ParseDataCallback callback, void* context);
 
 uint16_t mfkey32_get_auth_sectors(FuriString* string);
+
+/** Parse nonces from a line of mfkey32 log
+ *
+ * @param[in]  line    Log line
+ * @param[out] params  Parsed nonces
+ *
+ * @return     true on success
+ */
+bool mfkey32_parse_params(FuriString* line, Mfkey32Params* params);
@@ -0,0 +1,430 @@
+#include "mfkey_recovery.h"
+
+#include <furi.h>
+#include <lib/nfc/protocols/crypto1.h>
+#include <lib/nfc/protocols/nfc_util.h>
+
+// Algorithm from https://github.com/RfidResearchGroup/proxmark3.git
+
+#define TAG "MfkeyRecovery"
+
+#define BEBIT(x, n) FURI_BIT(x, (n) ^ 24)
+
+// Odd and even LFSR halves are recovered separately, starting from 20 bit filter inputs.
+// Initial half states are split into chunks and every pair of chunks is recovered on its own,
+// so both tables fit in heap next to the application. Half of the chunk inputs pass the filter
+// and the table has twice the chunk size for the growth. A pair that still overflows is split
+// into smaller chunks down to MFKEY_RECOVERY_CHUNK_SIZE_MIN.
+#define MFKEY_RECOVERY_CHUNK_BITS (8)
+#define MFKEY_RECOVERY_CHUNKS (1UL << MFKEY_RECOVERY_CHUNK_BITS)
+#define MFKEY_RECOVERY_CHUNK_SIZE ((1UL << 20) / MFKEY_RECOVERY_CHUNKS)
+#define MFKEY_RECOVERY_CHUNK_SIZE_MIN (64)
+#define MFKEY_RECOVERY_TABLE_SIZE (MFKEY_RECOVERY_CHUNK_SIZE * 2)
+#define MFKEY_RECOVERY_SIMPLE_EXTEND_BITS (4)
+#define MFKEY_RECOVERY_EXTEND_BITS (11)
+#define MFKEY_RECOVERY_EXTEND_STEP_BITS (4)
+
+typedef enum {
+    MfkeyRecoveryType32,
+    MfkeyRecoveryType64,
+} MfkeyRecoveryType;
+
+typedef struct {
+    MfkeyRecoveryType type;
+    uint32_t cuid;
+    uint32_t nt;
+    uint32_t nr;
+    // Second authentication for mfkey32
+    uint32_t nt1;
+    uint32_t nr1;
+    // Keystream to verify candidates with
+    uint32_t ks;
+
+    uint32_t* odd;
+    uint32_t* even;
+    bool overflow;
+
+    Crypto1 candidates[CRYPTO1_SLICED_LANES];
+    uint8_t candidates_num;
+    Crypto1Sliced sliced;
+
+    bool key_found;
+    uint64_t key;
+} MfkeyRecovery;
+
+static inline uint32_t
+    mfkey_recovery_update_contribution(uint32_t item, uint32_t mask1, uint32_t mask2) {
+    // Top byte keeps feedback contribution of the half, to match it with the other half
+    uint32_t contribution = item >> 25;
+    contribution = contribution << 1 | nfc_util_even_parity32(item & mask1);
+    contribution = contribution << 1 | nfc_util_even_parity32(item & mask2);
+    return contribution << 24 | (item & 0xffffff);
+}
+
+static bool mfkey_recovery_extend_table(
+    uint32_t* table,
+    size_t* size,
+    size_t capacity,
+    uint8_t bit,
+    bool contribution,
+    uint32_t mask1,
+    uint32_t mask2) {
+    size_t i = 0;
+    while(i < *size) {
+        uint32_t item = table[i] << 1;
+        uint8_t filter = crypto1_filter(item);
+        if(filter ^ crypto1_filter(item | 1)) {
+            // Only one next bit gives the keystream bit
+            item |= filter ^ bit;
+            table[i++] =
+                contribution ? mfkey_recovery_update_contribution(item, mask1, mask2) : item;
+        } else if(filter == bit) {
+            // Both next bits give the keystream bit, unprocessed item is moved to the end
+            if(*size == capacity) return false;
+            table[*size] = table[i + 1];
+            uint32_t item_next = item | 1;
+            if(contribution) {
+                item = mfkey_recovery_update_contribution(item, mask1, mask2);
+                item_next = mfkey_recovery_update_contribution(item_next, mask1, mask2);
+            }
+            table[i++] = item;
+            table[i++] = item_next;
+            (*size)++;
+        } else {
+            // None of the next bits fit
+            table[i] = table[--(*size)];
+        }
+    }
+
+    return true;
+}
+
+static int mfkey_recovery_compare(const void* a, const void* b) {
+    uint32_t item_a = *(const uint32_t*)a;
+    uint32_t item_b = *(const uint32_t*)b;
+    return (item_a > item_b) - (item_a < item_b);
+}
+
+static size_t mfkey_recovery_skip_group(uint32_t* table, size_t size, size_t start) {
+    uint32_t group = table[start] >> 24;
+    while(start < size && (table[start] >> 24) == group) {
+        start++;
+    }
+    return start;
+}
+
+// Leave only states with contribution present in both tables, grouped by contribution
+static void mfkey_recovery_intersect(
+    uint32_t* odd,
+    size_t* odd_size,
+    uint32_t* even,
+    size_t* even_size) {
+    qsort(odd, *odd_size, sizeof(uint32_t), mfkey_recovery_compare);
+    qsort(even, *even_size, sizeof(uint32_t), mfkey_recovery_compare);
+
+    size_t odd_pos = 0;
+    size_t even_pos = 0;
+    size_t odd_out = 0;
+    size_t even_out = 0;
+    while(odd_pos < *odd_size && even_pos < *even_size) {
+        uint32_t odd_group = odd[odd_pos] >> 24;
+        uint32_t even_group = even[even_pos] >> 24;
+        if(odd_group <= even_group) {
+            size_t odd_end = mfkey_recovery_skip_group(odd, *odd_size, odd_pos);
+            if(odd_group == even_group) {
+                memmove(&odd[odd_out], &odd[odd_pos], (odd_end - odd_pos) * sizeof(uint32_t));
+                odd_out += odd_end - odd_pos;
+            }
+            odd_pos = odd_end;
+        }
+        if(even_group <= odd_group) {
+            size_t even_end = mfkey_recovery_skip_group(even, *even_size, even_pos);
+            if(odd_group == even_group) {
+                memmove(
+                    &even[even_out], &even[even_pos], (even_end - even_pos) * sizeof(uint32_t));
+                even_out += even_end - even_pos;
+            }
+            even_pos = even_end;
+        }
+    }
+    *odd_size = odd_out;
+    *even_size = even_out;
+}
+
+static void mfkey_recovery_get_key(MfkeyRecovery* instance, Crypto1* crypto) {
+    // Roll back to the state right after the key was loaded
+    crypto1_rollback_word(crypto, 0, 0);
+    crypto1_rollback_word(crypto, instance->nr, 1);
+    crypto1_rollback_word(crypto, instance->cuid ^ instance->nt, 0);
+    instance->key = crypto1_get_key(crypto);
+    instance->key_found = true;
+}
+
+static void mfkey_recovery_check_candidates(MfkeyRecovery* instance) {
+    Crypto1Sliced* sliced = &instance->sliced;
+    uint32_t lanes = (instance->candidates_num == CRYPTO1_SLICED_LANES) ?
+                         UINT32_MAX :
+                         (1UL << instance->candidates_num) - 1;
+    for(uint8_t i = 0; i < instance->candidates_num; i++) {
+        crypto1_sliced_set_state(sliced, i, &instance->candidates[i]);
+    }
+
+    if(instance->type == MfkeyRecoveryType32) {
+        // Candidate key must produce reader answer of the second authentication
+        crypto1_sliced_rollback_word(sliced, 0, 0);
+        crypto1_sliced_rollback_word(sliced, instance->nr, 1);
+        crypto1_sliced_rollback_word(sliced, instance->cuid ^ instance->nt, 0);
+        crypto1_sliced_word(sliced, instance->cuid ^ instance->nt1, 0);
+        crypto1_sliced_word(sliced, instance->nr1, 1);
+    }
+    lanes = crypto1_sliced_word_match(sliced, 0, instance->ks, lanes);
+    if(lanes) {
+        mfkey_recovery_get_key(instance, &instance->candidates[__builtin_ctz(lanes)]);
+    }
+    instance->candidates_num = 0;
+}
+
+static void mfkey_recovery_add_candidates(
+    MfkeyRecovery* instance,
+    uint32_t* odd,
+    size_t odd_size,
+    uint32_t* even,
+    size_t even_size) {
+    for(size_t i = 0; i < even_size && !instance->key_found; i++) {
+        uint32_t even_item =
+            even[i] << 1 ^ nfc_util_even_parity32(even[i] & CRYPTO1_LF_POLY_EVEN);
+        for(size_t j = 0; j < odd_size && !instance->key_found; j++) {
+            Crypto1* candidate = &instance->candidates[instance->candidates_num++];
+            candidate->even = odd[j] & 0xffffff;
+            candidate->odd =
+                (even_item ^ nfc_util_even_parity32(odd[j] & CRYPTO1_LF_POLY_ODD)) & 0xffffff;
+            if(instance->candidates_num == CRYPTO1_SLICED_LANES) {
+                mfkey_recovery_check_candidates(instance);
+            }
+        }
+    }
+}
+
+static void mfkey_recovery_recover(
+    MfkeyRecovery* instance,
+    uint32_t* odd,
+    size_t odd_size,
+    uint32_t oks,
+    uint32_t* even,
+    size_t even_size,
+    uint32_t eks,
+    int8_t rem) {
+    if(rem == -1) {
+        mfkey_recovery_add_candidates(instance, odd, odd_size, even, even_size);
+        return;
+    }
+
+    // Tables grow into the space of groups that are already processed
+    size_t odd_capacity = instance->odd + MFKEY_RECOVERY_TABLE_SIZE - odd;
+    size_t even_capacity = instance->even + MFKEY_RECOVERY_TABLE_SIZE - even;
+    for(uint8_t i = 0; i < MFKEY_RECOVERY_EXTEND_STEP_BITS && rem--; i++) {
+        oks >>= 1;
+        eks >>= 1;
+        if(!mfkey_recovery_extend_table(
+               odd,
+               &odd_size,
+               odd_capacity,
+               oks & 1,
+               true,
+               CRYPTO1_LF_POLY_EVEN << 1 | 1,
+               CRYPTO1_LF_POLY_ODD << 1) ||
+           !mfkey_recovery_extend_table(
+               even,
+               &even_size,
+               even_capacity,
+               eks & 1,
+               true,
+               CRYPTO1_LF_POLY_ODD,
+               CRYPTO1_LF_POLY_EVEN << 1 | 1)) {
+            instance->overflow = true;
+            return;
+        }
+        if(!odd_size || !even_size) return;
+    }
+
+    mfkey_recovery_intersect(odd, &odd_size, even, &even_size);
+
+    // Groups are processed from the end, so the current group can grow over processed ones
+    while(odd_size && !instance->key_found && !instance->overflow) {
+        size_t odd_start = odd_size - 1;
+        while(odd_start && (odd[odd_start - 1] >> 24) == (odd[odd_size - 1] >> 24)) {
+            odd_start--;
+        }
+        size_t even_start = even_size - 1;
+        while(even_start && (even[even_start - 1] >> 24) == (even[even_size - 1] >> 24)) {
+            even_start--;
+        }
+        mfkey_recovery_recover(
+            instance,
+            &odd[odd_start],
+            odd_size - odd_start,
+            oks,
+            &even[even_start],
+            even_size - even_start,
+            eks,
+            rem);
+        odd_size = odd_start;
+        even_size = even_start;
+    }
+}
+
+static size_t
+    mfkey_recovery_init_table(uint32_t* table, uint32_t start, uint32_t count, uint8_t bit) {
+    size_t size = 0;
+    for(uint32_t i = start; i < start + count; i++) {
+        if(crypto1_filter(i) == bit) {
+            table[size++] = i;
+        }
+    }
+    return size;
+}
+
+static void mfkey_recovery_run_chunks(
+    MfkeyRecovery* instance,
+    uint32_t odd_start,
+    uint32_t even_start,
+    uint32_t count,
+    uint32_t oks,
+    uint32_t eks) {
+    uint32_t chunk_oks = oks;
+    uint32_t chunk_eks = eks;
+    size_t odd_size = mfkey_recovery_init_table(instance->odd, odd_start, count, oks & 1);
+    size_t even_size = mfkey_recovery_init_table(instance->even, even_start, count, eks & 1);
+    for(uint8_t i = 0; i < MFKEY_RECOVERY_SIMPLE_EXTEND_BITS && !instance->overflow; i++) {
+        chunk_oks >>= 1;
+        chunk_eks >>= 1;
+        instance->overflow = !mfkey_recovery_extend_table(
+                                 instance->odd,
+                                 &odd_size,
+                                 MFKEY_RECOVERY_TABLE_SIZE,
+                                 chunk_oks & 1,
+                                 false,
+                                 0,
+                                 0) ||
+                             !mfkey_recovery_extend_table(
+                                 instance->even,
+                                 &even_size,
+                                 MFKEY_RECOVERY_TABLE_SIZE,
+                                 chunk_eks & 1,
+                                 false,
+                                 0,
+                                 0);
+    }
+    if(!instance->overflow) {
+        mfkey_recovery_recover(
+            instance,
+            instance->odd,
+            odd_size,
+            chunk_oks,
+            instance->even,
+            even_size,
+            chunk_eks,
+            MFKEY_RECOVERY_EXTEND_BITS);
+    }
+
+    if(instance->overflow && !instance->key_found && count > MFKEY_RECOVERY_CHUNK_SIZE_MIN) {
+        // Candidates of the pair are generated again from the halves, pending ones stay valid
+        instance->overflow = false;
+        count /= 2;
+        for(uint8_t i = 0; i < 4 && !instance->key_found && !instance->overflow; i++) {
+            mfkey_recovery_run_chunks(
+                instance,
+                odd_start + (i & 1) * count,
+                even_start + (i >> 1) * count,
+                count,
+                oks,
+                eks);
+        }
+    }
+}
+
+static bool mfkey_recovery_run(MfkeyRecovery* instance, uint32_t ks2, uint64_t* key) {
+    // Split keystream into bits produced by odd and even halves
+    uint32_t oks = 0;
+    uint32_t eks = 0;
+    for(int8_t i = 31; i >= 0; i -= 2) {
+        oks = oks << 1 | BEBIT(ks2, i);
+    }
+    for(int8_t i = 30; i >= 0; i -= 2) {
+        eks = eks << 1 | BEBIT(ks2, i);
+    }
+
+    instance->odd = malloc(sizeof(uint32_t) * MFKEY_RECOVERY_TABLE_SIZE);
+    instance->even = malloc(sizeof(uint32_t) * MFKEY_RECOVERY_TABLE_SIZE);
+    crypto1_sliced_reset(&instance->sliced);
+
+    for(uint32_t odd_chunk = 0; odd_chunk < MFKEY_RECOVERY_CHUNKS; odd_chunk++) {
+        for(uint32_t even_chunk = 0; even_chunk < MFKEY_RECOVERY_CHUNKS; even_chunk++) {
+            mfkey_recovery_run_chunks(
+                instance,
+                odd_chunk * MFKEY_RECOVERY_CHUNK_SIZE,
+                even_chunk * MFKEY_RECOVERY_CHUNK_SIZE,
+                MFKEY_RECOVERY_CHUNK_SIZE,
+                oks,
+                eks);
+            if(instance->key_found || instance->overflow) break;
+        }
+        if(instance->key_found || instance->overflow) break;
+    }
+    if(!instance->key_found && !instance->overflow && instance->candidates_num) {
+        mfkey_recovery_check_candidates(instance);
+    }
+
+    free(instance->odd);
+    free(instance->even);
+
+    if(instance->overflow) {
+        FURI_LOG_E(TAG, "Candidate table overflow");
+    } else if(instance->key_found) {
+        *key = instance->key;
+    }
+
+    return instance->key_found && !instance->overflow;
+}
+
+bool mfkey32_recover_key(const Mfkey32Params* params, uint64_t* key) {
+    furi_assert(params);
+    furi_assert(key);
+
+    MfkeyRecovery* instance = malloc(sizeof(MfkeyRecovery));
+    instance->type = MfkeyRecoveryType32;
+    instance->cuid = params->cuid;
+    instance->nt = params->nt0;
+    instance->nr = params->nr0;
+    instance->nt1 = params->nt1;
+    instance->nr1 = params->nr1;
+    instance->ks = params->ar1 ^ prng_successor(params->nt1, 64);
+
+    bool key_found =
+        mfkey_recovery_run(instance, params->ar0 ^ prng_successor(params->nt0, 64), key);
+    free(instance);
+
+    return key_found;
+}
+
+bool mfkey64_recover_key(
+    uint32_t cuid,
+    uint32_t nt,
+    uint32_t nr,
+    uint32_t ar,
+    uint32_t at,
+    uint64_t* key) {
+    furi_assert(key);
+
+    MfkeyRecovery* instance = malloc(sizeof(MfkeyRecovery));
+    instance->type = MfkeyRecoveryType64;
+    instance->cuid = cuid;
+    instance->nt = nt;
+    instance->nr = nr;
+    instance->ks = at ^ prng_successor(nt, 96);
+
+    bool key_found = mfkey_recovery_run(instance, ar ^ prng_successor(nt, 64), key);
+    free(instance);
+
+    return key_found;
+}
@@ -0,0 +1,45 @@
+#pragma once
+
+#include "mfkey32.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/** Recover key from two authentication attempts of the reader
+ *
+ * Nonces are collected by Mfkey32 while emulating the card, see mfkey32_parse_params.
+ * Sized for the device heap: two tables of 2^13 words, the state space is searched in
+ * 65536 pairs of chunks one after another. A key takes from well under a second to over
+ * a minute of desktop CPU time depending on how far the search goes, and many times that
+ * on the device, so call it from a worker thread.
+ *
+ * @param[in]  params  Collected nonces
+ * @param[out] key     Recovered key
+ *
+ * @return     true if key was recovered
+ */
+bool mfkey32_recover_key(const Mfkey32Params* params, uint64_t* key);
+
+/** Recover key from one complete authentication
+ *
+ * @param[in]  cuid  Card UID
+ * @param[in]  nt    Card nonce
+ * @param[in]  nr    Encrypted reader nonce
+ * @param[in]  ar    Encrypted reader answer
+ * @param[in]  at    Encrypted card answer
+ * @param[out] key   Recovered key
+ *
+ * @return     true if key was recovered
+ */
+bool mfkey64_recover_key(
+    uint32_t cuid,
+    uint32_t nt,
+    uint32_t nr,
+    uint32_t ar,
+    uint32_t at,
+    uint64_t* key);
+
+#ifdef __cplusplus
+}
+#endif
@@ -3,6 +3,7 @@
 
 #include <platform.h>
 #include "parsers/nfc_supported_card.h"
+#include "helpers/mf_classic_key_scheduler.h"
 
 #define TAG "NfcWorker"
 
@@ -567,79 +568,23 @@ void nfc_worker_emulate_mf_ultralight(NfcWorker* nfc_worker) {
     }
 }
 
-static void nfc_worker_mf_classic_key_attack(
+static void nfc_worker_mf_classic_dict_attack_update_sector(
     NfcWorker* nfc_worker,
-    uint64_t key,
-    FuriHalNfcTxRxContext* tx_rx,
-    uint16_t start_sector) {
-    furi_assert(nfc_worker);
-    furi_assert(nfc_worker->callback);
-
-    bool card_found_notified = true;
-    bool card_removed_notified = false;
-
-    MfClassicData* data = &nfc_worker->dev_data->mf_classic_data;
+    MfClassicKeyScheduler* scheduler,
+    uint8_t* sectors_notified) {
     NfcMfClassicDictAttackData* dict_attack_data =
         &nfc_worker->dev_data->mf_classic_dict_attack_data;
-    uint32_t total_sectors = mf_classic_get_total_sectors_num(data->type);
-
-    furi_assert(start_sector < total_sectors);
-
-    nfc_worker->callback(NfcWorkerEventKeyAttackStart, nfc_worker->context);
-
-    // Check every sector's A and B keys with the given key
-    for(size_t i = start_sector; i < total_sectors; i++) {
-        nfc_worker->callback(NfcWorkerEventKeyAttackNextSector, nfc_worker->context);
-        dict_attack_data->current_sector = i;
-        furi_hal_nfc_sleep();
-        if(furi_hal_nfc_activate_nfca(200, NULL)) {
-            furi_hal_nfc_sleep();
-            if(!card_found_notified) {
-                nfc_worker->callback(NfcWorkerEventCardDetected, nfc_worker->context);
-                card_found_notified = true;
-                card_removed_notified = false;
-            }
-            uint8_t block_num = mf_classic_get_sector_trailer_block_num_by_sector(i);
-            if(mf_classic_is_sector_read(data, i)) continue;
-            if(!mf_classic_is_key_found(data, i, MfClassicKeyA)) {
-                FURI_LOG_D(
-                    TAG,
-                    "Trying A key for sector %d, key: %04lx%08lx",
-                    i,
-                    (uint32_t)(key >> 32),
-                    (uint32_t)key);
-                if(mf_classic_authenticate(tx_rx, block_num, key, MfClassicKeyA)) {
-                    mf_classic_set_key_found(data, i, MfClassicKeyA, key);
-                    FURI_LOG_D(TAG, "Key found");
-                    nfc_worker->callback(NfcWorkerEventFoundKeyA, nfc_worker->context);
-                }
-            }
-            if(!mf_classic_is_key_found(data, i, MfClassicKeyB)) {
-                FURI_LOG_D(
-                    TAG,
-                    "Trying B key for sector %d, key: %04lx%08lx",
-                    i,
-                    (uint32_t)(key >> 32),
-                    (uint32_t)key);
-                if(mf_classic_authenticate(tx_rx, block_num, key, MfClassicKeyB)) {
-                    mf_classic_set_key_found(data, i, MfClassicKeyB, key);
-                    FURI_LOG_D(TAG, "Key found");
-                    nfc_worker->callback(NfcWorkerEventFoundKeyB, nfc_worker->context);
-                }
-            }
-
-            if(mf_classic_is_sector_read(data, i)) continue;
-            mf_classic_read_sector(tx_rx, data, i);
-        } else {
-            if(!card_removed_notified) {
-                nfc_worker->callback(NfcWorkerEventNoCardDetected, nfc_worker->context);
-                card_removed_notified = true;
-                card_found_notified = false;
-            }
-        }
-        if(nfc_worker->state != NfcWorkerStateMfClassicDictAttack) break;
+    uint8_t total_sectors =
+        mf_classic_get_total_sectors_num(nfc_worker->dev_data->mf_classic_data.type);
+    uint8_t sector = mf_classic_key_scheduler_get_first_unknown_sector(scheduler);
+
+    dict_attack_data->current_sector = sector;
+    // View counts sectors from 1
+    while(*sectors_notified <= sector && *sectors_notified < total_sectors) {
+        FURI_LOG_I(TAG, "Sector %d", *sectors_notified);
+        nfc_worker->callback(NfcWorkerEventNewSector, nfc_worker->context);
+        (*sectors_notified)++;
     }
-    nfc_worker->callback(NfcWorkerEventKeyAttackStop, nfc_worker->context);
 }
 
 void nfc_worker_mf_classic_dict_attack(NfcWorker* nfc_worker) {
@@ -651,10 +596,13 @@ void nfc_worker_mf_classic_dict_attack(NfcWorker* nfc_worker) {
         &nfc_worker->dev_data->mf_classic_dict_attack_data;
     uint32_t total_sectors = mf_classic_get_total_sectors_num(data->type);
     uint64_t key = 0;
-    uint64_t prev_key = 0;
     FuriHalNfcTxRxContext tx_rx = {};
+    Crypto1 crypto = {};
+    uint32_t cuid = 0;
+    bool session_active = false;
     bool card_found_notified = true;
     bool card_removed_notified = false;
+    uint8_t sectors_notified = 0;
 
     // Load dictionary
     MfClassicDict* dict = dict_attack_data->dict;
@@ -666,75 +614,81 @@ void nfc_worker_mf_classic_dict_attack(NfcWorker* nfc_worker) {
 
     FURI_LOG_D(
         TAG, "Start Dictionary attack, Key Count %lu", mf_classic_dict_get_total_keys(dict));
-    for(size_t i = 0; i < total_sectors; i++) {
-        FURI_LOG_I(TAG, "Sector %d", i);
-        nfc_worker->callback(NfcWorkerEventNewSector, nfc_worker->context);
-        uint8_t block_num = mf_classic_get_sector_trailer_block_num_by_sector(i);
-        if(mf_classic_is_sector_read(data, i)) continue;
-        bool is_key_a_found = mf_classic_is_key_found(data, i, MfClassicKeyA);
-        bool is_key_b_found = mf_classic_is_key_found(data, i, MfClassicKeyB);
-        uint16_t key_index = 0;
-        while(mf_classic_dict_get_next_key(dict, &key)) {
-            FURI_LOG_T(TAG, "Key %d", key_index);
-            if(++key_index % NFC_DICT_KEY_BATCH_SIZE == 0) {
-                nfc_worker->callback(NfcWorkerEventNewDictKeyBatch, nfc_worker->context);
-            }
-            furi_hal_nfc_sleep();
-            uint32_t cuid;
-            if(furi_hal_nfc_activate_nfca(200, &cuid)) {
-                bool deactivated = false;
+    MfClassicKeyScheduler* scheduler = mf_classic_key_scheduler_alloc(data);
+    nfc_worker_mf_classic_dict_attack_update_sector(nfc_worker, scheduler, &sectors_notified);
+
+    // Every key is tried on all unknown slots before the next one.
+    // Failed authentication halts the card, successful one is followed by nested authentication.
+    uint16_t key_index = 0;
+    while(!mf_classic_key_scheduler_is_done(scheduler)) {
+        if(!mf_classic_dict_get_next_key(dict, &key)) break;
+        FURI_LOG_T(TAG, "Key %d", key_index);
+        if(++key_index % NFC_DICT_KEY_BATCH_SIZE == 0) {
+            nfc_worker->callback(NfcWorkerEventNewDictKeyBatch, nfc_worker->context);
+        }
+        mf_classic_key_scheduler_set_key(scheduler, key);
+        MfClassicKeySlot slot = {};
+        while(mf_classic_key_scheduler_get_next_slot(scheduler, &slot)) {
+            if(nfc_worker->state != NfcWorkerStateMfClassicDictAttack) break;
+            uint8_t block_num = mf_classic_get_sector_trailer_block_num_by_sector(slot.sector);
+            FURI_LOG_D(
+                TAG,
+                "Try to auth to sector %d with key %c %04lx%08lx",
+                slot.sector,
+                slot.key_type == MfClassicKeyA ? 'A' : 'B',
+                (uint32_t)(key >> 32),
+                (uint32_t)key);
+            bool key_found = false;
+            if(session_active) {
+                key_found = mf_classic_authenticate_nested(
+                    &tx_rx, block_num, key, slot.key_type, &crypto, cuid);
+            } else {
+                furi_hal_nfc_sleep();
+                if(!furi_hal_nfc_activate_nfca(200, &cuid)) {
+                    if(!card_removed_notified) {
+                        nfc_worker->callback(NfcWorkerEventNoCardDetected, nfc_worker->context);
+                        card_removed_notified = true;
+                        card_found_notified = false;
+                    }
+                    // Retry the same slot once the card is back
+                    continue;
+                }
                 if(!card_found_notified) {
                     nfc_worker->callback(NfcWorkerEventCardDetected, nfc_worker->context);
                     card_found_notified = true;
                     card_removed_notified = false;
-                    nfc_worker_mf_classic_key_attack(nfc_worker, prev_key, &tx_rx, i);
-                    deactivated = true;
-                }
-                FURI_LOG_D(
-                    TAG,
-                    "Try to auth to sector %d with key %04lx%08lx",
-                    i,
-                    (uint32_t)(key >> 32),
-                    (uint32_t)key);
-                if(!is_key_a_found) {
-                    is_key_a_found = mf_classic_is_key_found(data, i, MfClassicKeyA);
-                    if(mf_classic_authenticate_skip_activate(
-                           &tx_rx, block_num, key, MfClassicKeyA, !deactivated, cuid)) {
-                        mf_classic_set_key_found(data, i, MfClassicKeyA, key);
-                        FURI_LOG_D(TAG, "Key found");
-                        nfc_worker->callback(NfcWorkerEventFoundKeyA, nfc_worker->context);
-                        nfc_worker_mf_classic_key_attack(nfc_worker, key, &tx_rx, i + 1);
-                    }
-                    furi_hal_nfc_sleep();
-                    deactivated = true;
-                }
-                if(!is_key_b_found) {
-                    is_key_b_found = mf_classic_is_key_found(data, i, MfClassicKeyB);
-                    if(mf_classic_authenticate_skip_activate(
-                           &tx_rx, block_num, key, MfClassicKeyB, !deactivated, cuid)) {
-                        FURI_LOG_D(TAG, "Key found");
-                        mf_classic_set_key_found(data, i, MfClassicKeyB, key);
-                        nfc_worker->callback(NfcWorkerEventFoundKeyB, nfc_worker->context);
-                        nfc_worker_mf_classic_key_attack(nfc_worker, key, &tx_rx, i + 1);
-                    }
-                    deactivated = true;
                 }
-                if(is_key_a_found && is_key_b_found) break;
-                if(nfc_worker->state != NfcWorkerStateMfClassicDictAttack) break;
-            } else {
-                if(!card_removed_notified) {
-                    nfc_worker->callback(NfcWorkerEventNoCardDetected, nfc_worker->context);
-                    card_removed_notified = true;
-                    card_found_notified = false;
+                key_found = mf_classic_authenticate_session(
+                    &tx_rx, block_num, key, slot.key_type, &crypto, true, cuid);
+            }
+            session_active = key_found;
+            mf_classic_key_scheduler_set_result(scheduler, &slot, key_found);
+            if(key_found) {
+                if(slot.key_type == MfClassicKeyA) {
+                    nfc_worker->callback(NfcWorkerEventFoundKeyA, nfc_worker->context);
+                } else {
+                    nfc_worker->callback(NfcWorkerEventFoundKeyB, nfc_worker->context);
                 }
-                if(nfc_worker->state != NfcWorkerStateMfClassicDictAttack) break;
             }
-            memcpy(&prev_key, &key, sizeof(key));
         }
+        nfc_worker_mf_classic_dict_attack_update_sector(nfc_worker, scheduler, &sectors_notified);
         if(nfc_worker->state != NfcWorkerStateMfClassicDictAttack) break;
+    }
+    furi_hal_nfc_sleep();
+    mf_classic_key_scheduler_free(scheduler);
+
+    // Read sectors with the keys found so far
+    for(size_t i = 0; i < total_sectors; i++) {
+        if(mf_classic_is_sector_read(data, i)) continue;
+        if(!mf_classic_is_key_found(data, i, MfClassicKeyA) &&
+           !mf_classic_is_key_found(data, i, MfClassicKeyB)) {
+            continue;
+        }
+        furi_hal_nfc_sleep();
+        if(!furi_hal_nfc_activate_nfca(200, NULL)) break;
         mf_classic_read_sector(&tx_rx, data, i);
-        mf_classic_dict_rewind(dict);
     }
+
     if(nfc_worker->state == NfcWorkerStateMfClassicDictAttack) {
         nfc_worker->callback(NfcWorkerEventSuccess, nfc_worker->context);
     } else {
@@ -55,9 +55,6 @@ typedef enum {
     NfcWorkerEventNewDictKeyBatch,
     NfcWorkerEventFoundKeyA,
     NfcWorkerEventFoundKeyB,
-    NfcWorkerEventKeyAttackStart,
-    NfcWorkerEventKeyAttackStop,
-    NfcWorkerEventKeyAttackNextSector,
 
     // Write Mifare Classic events
     NfcWorkerEventWrongCard,
@@ -6,8 +6,6 @@
 
 #define SWAPENDIAN(x) \
     ((x) = ((x) >> 8 & 0xff00ff) | ((x)&0xff00ff) << 8, (x) = (x) >> 16 | (x) << 16)
-#define LF_POLY_ODD (0x29CE5C)
-#define LF_POLY_EVEN (0x870804)
 
 #define BEBIT(x, n) FURI_BIT(x, (n) ^ 24)
 
@@ -42,8 +40,8 @@ uint8_t crypto1_bit(Crypto1* crypto1, uint8_t in, int is_encrypted) {
     uint8_t out = crypto1_filter(crypto1->odd);
     uint32_t feed = out & (!!is_encrypted);
     feed ^= !!in;
-    feed ^= LF_POLY_ODD & crypto1->odd;
-    feed ^= LF_POLY_EVEN & crypto1->even;
+    feed ^= CRYPTO1_LF_POLY_ODD & crypto1->odd;
+    feed ^= CRYPTO1_LF_POLY_EVEN & crypto1->even;
     crypto1->even = crypto1->even << 1 | (nfc_util_even_parity32(feed));
 
     FURI_SWAP(crypto1->odd, crypto1->even);
@@ -68,6 +66,42 @@ uint32_t crypto1_word(Crypto1* crypto1, uint32_t in, int is_encrypted) {
     return out;
 }
 
+uint8_t crypto1_rollback_bit(Crypto1* crypto1, uint8_t in, int is_encrypted) {
+    furi_assert(crypto1);
+    crypto1->odd &= 0xffffff;
+    FURI_SWAP(crypto1->odd, crypto1->even);
+
+    uint32_t feed = crypto1->even & 1;
+    crypto1->even >>= 1;
+    feed ^= CRYPTO1_LF_POLY_EVEN & crypto1->even;
+    feed ^= CRYPTO1_LF_POLY_ODD & crypto1->odd;
+    feed ^= !!in;
+    uint8_t out = crypto1_filter(crypto1->odd);
+    feed ^= out & (!!is_encrypted);
+    crypto1->even |= nfc_util_even_parity32(feed) << 23;
+
+    return out;
+}
+
+uint32_t crypto1_rollback_word(Crypto1* crypto1, uint32_t in, int is_encrypted) {
+    furi_assert(crypto1);
+    uint32_t out = 0;
+    for(int8_t i = 31; i >= 0; i--) {
+        out |= (uint32_t)crypto1_rollback_bit(crypto1, BEBIT(in, i), is_encrypted) << (24 ^ i);
+    }
+    return out;
+}
+
+uint64_t crypto1_get_key(Crypto1* crypto1) {
+    furi_assert(crypto1);
+    uint64_t key = 0;
+    for(int8_t i = 23; i >= 0; i--) {
+        key = key << 1 | FURI_BIT(crypto1->odd, i ^ 3);
+        key = key << 1 | FURI_BIT(crypto1->even, i ^ 3);
+    }
+    return key;
+}
+
 uint32_t prng_successor(uint32_t x, uint32_t n) {
     SWAPENDIAN(x);
     while(n--) x = x >> 1 | (x >> 16 ^ x >> 18 ^ x >> 19 ^ x >> 21) << 31;
@@ -126,3 +160,141 @@ void crypto1_encrypt(
         }
     }
 }
+
+// Bit N of odd half is LFSR bit 2 * N steps back, bit N of even half is 2 * N + 1 steps back
+#define CRYPTO1_SLICED_BIT(sliced, delay) \
+    ((sliced)->lfsr[((sliced)->head - (delay)) & (CRYPTO1_SLICED_LFSR_SIZE - 1)])
+#define CRYPTO1_SLICED_FEEDBACK_OLDEST (47)
+#define CRYPTO1_SLICED_LANE_MASK(bit) ((bit) ? UINT32_MAX : 0)
+
+// LFSR taps from CRYPTO1_LF_POLY_ODD and CRYPTO1_LF_POLY_EVEN, without the oldest bit
+static const uint8_t crypto1_sliced_taps[] =
+    {4, 5, 6, 8, 12, 18, 20, 22, 23, 28, 30, 32, 33, 35, 37, 38, 42};
+
+static inline uint32_t crypto1_sliced_mux(uint32_t select, uint32_t a, uint32_t b) {
+    return a ^ ((a ^ b) & select);
+}
+
+// Bitsliced versions of the crypto1_filter lookup tables 0xF22C, 0xD938 and 0xEC57E80A
+static inline uint32_t crypto1_sliced_fa(uint32_t a, uint32_t b, uint32_t c, uint32_t d) {
+    return crypto1_sliced_mux(d, b ^ ((a | b) & c), c | (a & ~b));
+}
+
+static inline uint32_t crypto1_sliced_fb(uint32_t a, uint32_t b, uint32_t c, uint32_t d) {
+    return crypto1_sliced_mux(
+        d, crypto1_sliced_mux(c, a & b, ~b), crypto1_sliced_mux(c, ~(a ^ b), b | ~a));
+}
+
+static inline uint32_t
+    crypto1_sliced_fc(uint32_t a, uint32_t b, uint32_t c, uint32_t d, uint32_t e) {
+    uint32_t low = crypto1_sliced_mux(d, ~c & a, crypto1_sliced_mux(c, a & b, a | b));
+    uint32_t high = crypto1_sliced_mux(
+        d, crypto1_sliced_mux(c, ~(a & b), ~a), crypto1_sliced_mux(c, b, a | b));
+    return crypto1_sliced_mux(e, low, high);
+}
+
+static inline uint32_t crypto1_sliced_filter(Crypto1Sliced* sliced) {
+#define CRYPTO1_SLICED_NIBBLE(f, n)                    \
+    f(CRYPTO1_SLICED_BIT(sliced, (n)*8),               \
+      CRYPTO1_SLICED_BIT(sliced, (n)*8 + 2),           \
+      CRYPTO1_SLICED_BIT(sliced, (n)*8 + 4),           \
+      CRYPTO1_SLICED_BIT(sliced, (n)*8 + 6))
+    return crypto1_sliced_fc(
+        CRYPTO1_SLICED_NIBBLE(crypto1_sliced_fb, 4),
+        CRYPTO1_SLICED_NIBBLE(crypto1_sliced_fa, 3),
+        CRYPTO1_SLICED_NIBBLE(crypto1_sliced_fa, 2),
+        CRYPTO1_SLICED_NIBBLE(crypto1_sliced_fb, 1),
+        CRYPTO1_SLICED_NIBBLE(crypto1_sliced_fa, 0));
+#undef CRYPTO1_SLICED_NIBBLE
+}
+
+static inline uint32_t crypto1_sliced_taps_feedback(Crypto1Sliced* sliced) {
+    uint32_t feed = 0;
+    for(size_t i = 0; i < COUNT_OF(crypto1_sliced_taps); i++) {
+        feed ^= CRYPTO1_SLICED_BIT(sliced, crypto1_sliced_taps[i]);
+    }
+    return feed;
+}
+
+void crypto1_sliced_reset(Crypto1Sliced* sliced) {
+    furi_assert(sliced);
+    memset(sliced, 0, sizeof(Crypto1Sliced));
+}
+
+void crypto1_sliced_set_state(Crypto1Sliced* sliced, uint8_t lane, Crypto1* crypto1) {
+    furi_assert(sliced);
+    furi_assert(lane < CRYPTO1_SLICED_LANES);
+    furi_assert(crypto1);
+
+    uint32_t lane_mask = 1UL << lane;
+    for(uint8_t i = 0; i < 24; i++) {
+        uint32_t* odd_bit = &CRYPTO1_SLICED_BIT(sliced, 2 * i);
+        uint32_t* even_bit = &CRYPTO1_SLICED_BIT(sliced, 2 * i + 1);
+        *odd_bit = (*odd_bit & ~lane_mask) | (FURI_BIT(crypto1->odd, i) << lane);
+        *even_bit = (*even_bit & ~lane_mask) | (FURI_BIT(crypto1->even, i) << lane);
+    }
+}
+
+void crypto1_sliced_get_state(Crypto1Sliced* sliced, uint8_t lane, Crypto1* crypto1) {
+    furi_assert(sliced);
+    furi_assert(lane < CRYPTO1_SLICED_LANES);
+    furi_assert(crypto1);
+
+    crypto1->odd = 0;
+    crypto1->even = 0;
+    for(uint8_t i = 0; i < 24; i++) {
+        crypto1->odd |= FURI_BIT(CRYPTO1_SLICED_BIT(sliced, 2 * i), lane) << i;
+        crypto1->even |= FURI_BIT(CRYPTO1_SLICED_BIT(sliced, 2 * i + 1), lane) << i;
+    }
+}
+
+uint32_t crypto1_sliced_bit(Crypto1Sliced* sliced, uint32_t in, int is_encrypted) {
+    furi_assert(sliced);
+    uint32_t out = crypto1_sliced_filter(sliced);
+    uint32_t feed = in ^ (is_encrypted ? out : 0);
+    feed ^= crypto1_sliced_taps_feedback(sliced);
+    feed ^= CRYPTO1_SLICED_BIT(sliced, CRYPTO1_SLICED_FEEDBACK_OLDEST);
+    sliced->head = (sliced->head + 1) & (CRYPTO1_SLICED_LFSR_SIZE - 1);
+    CRYPTO1_SLICED_BIT(sliced, 0) = feed;
+
+    return out;
+}
+
+uint32_t crypto1_sliced_rollback_bit(Crypto1Sliced* sliced, uint32_t in, int is_encrypted) {
+    furi_assert(sliced);
+    uint32_t newest = CRYPTO1_SLICED_BIT(sliced, 0);
+    sliced->head = (sliced->head - 1) & (CRYPTO1_SLICED_LFSR_SIZE - 1);
+    uint32_t out = crypto1_sliced_filter(sliced);
+    uint32_t feed = newest ^ in ^ (is_encrypted ? out : 0);
+    feed ^= crypto1_sliced_taps_feedback(sliced);
+    CRYPTO1_SLICED_BIT(sliced, CRYPTO1_SLICED_FEEDBACK_OLDEST) = feed;
+
+    return out;
+}
+
+void crypto1_sliced_word(Crypto1Sliced* sliced, uint32_t in, int is_encrypted) {
+    furi_assert(sliced);
+    for(uint8_t i = 0; i < 32; i++) {
+        crypto1_sliced_bit(sliced, CRYPTO1_SLICED_LANE_MASK(BEBIT(in, i)), is_encrypted);
+    }
+}
+
+void crypto1_sliced_rollback_word(Crypto1Sliced* sliced, uint32_t in, int is_encrypted) {
+    furi_assert(sliced);
+    for(int8_t i = 31; i >= 0; i--) {
+        crypto1_sliced_rollback_bit(sliced, CRYPTO1_SLICED_LANE_MASK(BEBIT(in, i)), is_encrypted);
+    }
+}
+
+uint32_t crypto1_sliced_word_match(
+    Crypto1Sliced* sliced,
+    uint32_t in,
+    uint32_t keystream,
+    uint32_t lanes) {
+    furi_assert(sliced);
+    for(uint8_t i = 0; i < 32 && lanes; i++) {
+        uint32_t out = crypto1_sliced_bit(sliced, CRYPTO1_SLICED_LANE_MASK(BEBIT(in, i)), 0);
+        lanes &= ~(out ^ CRYPTO1_SLICED_LANE_MASK(BEBIT(keystream, i)));
+    }
+    return lanes;
+}
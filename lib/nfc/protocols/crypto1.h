@@ -3,11 +3,27 @@
 #include <stdint.h>
 #include <stdbool.h>
 
+#define CRYPTO1_LF_POLY_ODD (0x29CE5C)
+#define CRYPTO1_LF_POLY_EVEN (0x870804)
+
+#define CRYPTO1_SLICED_LANES (32)
+#define CRYPTO1_SLICED_LFSR_SIZE (64)
+
 typedef struct {
     uint32_t odd;
     uint32_t even;
 } Crypto1;
 
+/** Bitsliced Crypto1 states
+ *
+ * Every LFSR bit is stored in a separate word, bit N of every word belongs to state N.
+ * Bits are kept in a ring buffer, so shifting the LFSR is a single index update.
+ */
+typedef struct {
+    uint32_t lfsr[CRYPTO1_SLICED_LFSR_SIZE];
+    uint8_t head;
+} Crypto1Sliced;
+
 void crypto1_reset(Crypto1* crypto1);
 
 void crypto1_init(Crypto1* crypto1, uint64_t key);
@@ -18,6 +34,12 @@ uint8_t crypto1_byte(Crypto1* crypto1, uint8_t in, int is_encrypted);
 
 uint32_t crypto1_word(Crypto1* crypto1, uint32_t in, int is_encrypted);
 
+uint8_t crypto1_rollback_bit(Crypto1* crypto1, uint8_t in, int is_encrypted);
+
+uint32_t crypto1_rollback_word(Crypto1* crypto1, uint32_t in, int is_encrypted);
+
+uint64_t crypto1_get_key(Crypto1* crypto1);
+
 uint32_t crypto1_filter(uint32_t in);
 
 uint32_t prng_successor(uint32_t x, uint32_t n);
@@ -35,3 +57,42 @@ void crypto1_encrypt(
     uint16_t plain_data_bits,
     uint8_t* encrypted_data,
     uint8_t* encrypted_parity);
+
+void crypto1_sliced_reset(Crypto1Sliced* sliced);
+
+void crypto1_sliced_set_state(Crypto1Sliced* sliced, uint8_t lane, Crypto1* crypto1);
+
+void crypto1_sliced_get_state(Crypto1Sliced* sliced, uint8_t lane, Crypto1* crypto1);
+
+/** Clock all states by one bit
+ *
+ * @param      sliced        Crypto1Sliced instance
+ * @param[in]  in            Input bit for every state
+ * @param[in]  is_encrypted  Feed the keystream bit back, as with encrypted input
+ *
+ * @return     Keystream bit of every state
+ */
+uint32_t crypto1_sliced_bit(Crypto1Sliced* sliced, uint32_t in, int is_encrypted);
+
+uint32_t crypto1_sliced_rollback_bit(Crypto1Sliced* sliced, uint32_t in, int is_encrypted);
+
+void crypto1_sliced_word(Crypto1Sliced* sliced, uint32_t in, int is_encrypted);
+
+void crypto1_sliced_rollback_word(Crypto1Sliced* sliced, uint32_t in, int is_encrypted);
+
+/** Clock all states by one word and compare their keystream
+ *
+ * Stops as soon as no state matches, states are not valid after that.
+ *
+ * @param      sliced     Crypto1Sliced instance
+ * @param[in]  in         Input word, same for every state
+ * @param[in]  keystream  Expected keystream word
+ * @param[in]  lanes      States to compare
+ *
+ * @return     States from lanes that produced the keystream
+ */
+uint32_t crypto1_sliced_word_match(
+    Crypto1Sliced* sliced,
+    uint32_t in,
+    uint32_t keystream,
+    uint32_t lanes);
@@ -398,6 +398,34 @@ void mf_classic_auth_init_context(MfClassicAuthContext* auth_ctx, uint8_t sector
     auth_ctx->key_b = MF_CLASSIC_NO_KEY;
 }
 
+static bool mf_classic_auth_reader_response(
+    FuriHalNfcTxRxContext* tx_rx,
+    Crypto1* crypto,
+    uint32_t nt) {
+    uint8_t nr[4] = {};
+    nfc_util_num2bytes(prng_successor(DWT->CYCCNT, 32), 4, nr);
+    for(uint8_t i = 0; i < 4; i++) {
+        tx_rx->tx_data[i] = crypto1_byte(crypto, nr[i], 0) ^ nr[i];
+        tx_rx->tx_parity[0] |=
+            (((crypto1_filter(crypto->odd) ^ nfc_util_odd_parity8(nr[i])) & 0x01) << (7 - i));
+    }
+    nt = prng_successor(nt, 32);
+    for(uint8_t i = 4; i < 8; i++) {
+        nt = prng_successor(nt, 8);
+        tx_rx->tx_data[i] = crypto1_byte(crypto, 0x00, 0) ^ (nt & 0xff);
+        tx_rx->tx_parity[0] |=
+            (((crypto1_filter(crypto->odd) ^ nfc_util_odd_parity8(nt & 0xff)) & 0x01)
+             << (7 - i));
+    }
+    tx_rx->tx_rx_type = FuriHalNfcTxRxTypeRaw;
+    tx_rx->tx_bits = 8 * 8;
+    if(!furi_hal_nfc_tx_rx(tx_rx, 6)) return false;
+    if(tx_rx->rx_bits != 32) return false;
+    crypto1_word(crypto, 0, 0);
+
+    return true;
+}
+
 static bool mf_classic_auth(
     FuriHalNfcTxRxContext* tx_rx,
     uint32_t block,
@@ -426,28 +454,42 @@ static bool mf_classic_auth(
         uint32_t nt = (uint32_t)nfc_util_bytes2num(tx_rx->rx_data, 4);
         crypto1_init(crypto, key);
         crypto1_word(crypto, nt ^ cuid, 0);
-        uint8_t nr[4] = {};
-        nfc_util_num2bytes(prng_successor(DWT->CYCCNT, 32), 4, nr);
-        for(uint8_t i = 0; i < 4; i++) {
-            tx_rx->tx_data[i] = crypto1_byte(crypto, nr[i], 0) ^ nr[i];
-            tx_rx->tx_parity[0] |=
-                (((crypto1_filter(crypto->odd) ^ nfc_util_odd_parity8(nr[i])) & 0x01) << (7 - i));
-        }
-        nt = prng_successor(nt, 32);
-        for(uint8_t i = 4; i < 8; i++) {
-            nt = prng_successor(nt, 8);
-            tx_rx->tx_data[i] = crypto1_byte(crypto, 0x00, 0) ^ (nt & 0xff);
-            tx_rx->tx_parity[0] |=
-                (((crypto1_filter(crypto->odd) ^ nfc_util_odd_parity8(nt & 0xff)) & 0x01)
-                 << (7 - i));
-        }
+        auth_success = mf_classic_auth_reader_response(tx_rx, crypto, nt);
+    } while(false);
+
+    return auth_success;
+}
+
+static bool mf_classic_auth_nested(
+    FuriHalNfcTxRxContext* tx_rx,
+    uint32_t block,
+    uint64_t key,
+    MfClassicKey key_type,
+    Crypto1* crypto,
+    uint32_t cuid) {
+    bool auth_success = false;
+    uint8_t plain_cmd[4] = {};
+    if(key_type == MfClassicKeyA) {
+        plain_cmd[0] = MF_CLASSIC_AUTH_KEY_A_CMD;
+    } else {
+        plain_cmd[0] = MF_CLASSIC_AUTH_KEY_B_CMD;
+    }
+    plain_cmd[1] = block;
+    nfca_append_crc16(plain_cmd, 2);
+
+    do {
+        // Auth command is encrypted with the session of the previous authentication
+        crypto1_encrypt(crypto, NULL, plain_cmd, 4 * 8, tx_rx->tx_data, tx_rx->tx_parity);
+        tx_rx->tx_bits = 4 * 9;
         tx_rx->tx_rx_type = FuriHalNfcTxRxTypeRaw;
-        tx_rx->tx_bits = 8 * 8;
         if(!furi_hal_nfc_tx_rx(tx_rx, 6)) break;
-        if(tx_rx->rx_bits == 32) {
-            crypto1_word(crypto, 0, 0);
-            auth_success = true;
-        }
+        if(tx_rx->rx_bits != 32) break;
+
+        uint32_t nt_enc = (uint32_t)nfc_util_bytes2num(tx_rx->rx_data, 4);
+        crypto1_init(crypto, key);
+        uint32_t nt = crypto1_word(crypto, nt_enc ^ cuid, 1) ^ nt_enc;
+        memset(tx_rx->tx_parity, 0, sizeof(tx_rx->tx_parity));
+        auth_success = mf_classic_auth_reader_response(tx_rx, crypto, nt);
     } while(false);
 
     return auth_success;
@@ -482,6 +524,33 @@ bool mf_classic_authenticate_skip_activate(
     return key_found;
 }
 
+bool mf_classic_authenticate_session(
+    FuriHalNfcTxRxContext* tx_rx,
+    uint8_t block_num,
+    uint64_t key,
+    MfClassicKey key_type,
+    Crypto1* crypto,
+    bool skip_activate,
+    uint32_t cuid) {
+    furi_assert(tx_rx);
+    furi_assert(crypto);
+
+    return mf_classic_auth(tx_rx, block_num, key, key_type, crypto, skip_activate, cuid);
+}
+
+bool mf_classic_authenticate_nested(
+    FuriHalNfcTxRxContext* tx_rx,
+    uint8_t block_num,
+    uint64_t key,
+    MfClassicKey key_type,
+    Crypto1* crypto,
+    uint32_t cuid) {
+    furi_assert(tx_rx);
+    furi_assert(crypto);
+
+    return mf_classic_auth_nested(tx_rx, block_num, key, key_type, crypto, cuid);
+}
+
 bool mf_classic_auth_attempt(
     FuriHalNfcTxRxContext* tx_rx,
     MfClassicAuthContext* auth_ctx,
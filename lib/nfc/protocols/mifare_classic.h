@@ -164,6 +164,31 @@ bool mf_classic_authenticate_skip_activate(
     bool skip_activate,
     uint32_t cuid);
 
+/** Authenticate and keep the session
+ *
+ * Card is not halted, so the session can be used for nested authentication.
+ */
+bool mf_classic_authenticate_session(
+    FuriHalNfcTxRxContext* tx_rx,
+    uint8_t block_num,
+    uint64_t key,
+    MfClassicKey key_type,
+    Crypto1* crypto,
+    bool skip_activate,
+    uint32_t cuid);
+
+/** Authenticate within the session of the previous successful authentication
+ *
+ * Saves card reactivation. On failure card goes to idle state and the session is lost.
+ */
+bool mf_classic_authenticate_nested(
+    FuriHalNfcTxRxContext* tx_rx,
+    uint8_t block_num,
+    uint64_t key,
+    MfClassicKey key_type,
+    Crypto1* crypto,
+    uint32_t cuid);
+
 bool mf_classic_auth_attempt(
     FuriHalNfcTxRxContext* tx_rx,
     MfClassicAuthContext* auth_ctx,
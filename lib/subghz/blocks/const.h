@@ -15,6 +15,12 @@ typedef struct {
     const uint8_t min_count_bit_for_found;
 } SubGhzBlockConst;
 
+/** Range of pulse durations, in us */
+typedef struct {
+    uint32_t duration_min;
+    uint32_t duration_max;
+} SubGhzBlockEnvelope;
+
 #ifdef __cplusplus
 }
 #endif
\ No newline at end of file
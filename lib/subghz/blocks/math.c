@@ -1,5 +1,13 @@
 #include "math.h"
 
+SubGhzBlockEnvelope subghz_protocol_blocks_envelope(uint32_t center, uint32_t delta) {
+    SubGhzBlockEnvelope envelope = {
+        .duration_min = (center > delta) ? (center - delta) : 0,
+        .duration_max = center + delta,
+    };
+    return envelope;
+}
+
 uint64_t subghz_protocol_blocks_reverse_key(uint64_t key, uint8_t bit_count) {
     uint64_t reverse_key = 0;
     for(uint8_t i = 0; i < bit_count; i++) {
@@ -4,6 +4,8 @@
 #include <stdint.h>
 #include <stddef.h>
 
+#include "const.h"
+
 #define bit_read(value, bit) (((value) >> (bit)) & 0x01)
 #define bit_set(value, bit) ((value) |= (1UL << (bit)))
 #define bit_clear(value, bit) ((value) &= ~(1UL << (bit)))
@@ -14,6 +16,15 @@
 extern "C" {
 #endif
 
+/** Make envelope of pulses matching DURATION_DIFF(duration, center) < delta
+ *
+ * @param      center  center duration, us
+ * @param      delta   allowed deviation, us
+ *
+ * @return     SubGhzBlockEnvelope
+ */
+SubGhzBlockEnvelope subghz_protocol_blocks_envelope(uint32_t center, uint32_t delta);
+
 /** Flip the data bitwise
  *
  * @param      key        In data
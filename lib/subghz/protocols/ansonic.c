@@ -42,12 +42,18 @@ typedef enum {
     AnsonicDecoderStepCheckDuration,
 } AnsonicDecoderStep;
 
+static SubGhzBlockEnvelope subghz_protocol_decoder_ansonic_get_envelope() {
+    return subghz_protocol_blocks_envelope(
+        subghz_protocol_ansonic_const.te_short * 35, subghz_protocol_ansonic_const.te_delta * 35);
+}
+
 const SubGhzProtocolDecoder subghz_protocol_ansonic_decoder = {
     .alloc = subghz_protocol_decoder_ansonic_alloc,
     .free = subghz_protocol_decoder_ansonic_free,
 
     .feed = subghz_protocol_decoder_ansonic_feed,
     .reset = subghz_protocol_decoder_ansonic_reset,
+    .get_envelope = subghz_protocol_decoder_ansonic_get_envelope,
 
     .get_hash_data = subghz_protocol_decoder_ansonic_get_hash_data,
     .serialize = subghz_protocol_decoder_ansonic_serialize,
@@ -9,6 +9,24 @@ void subghz_protocol_decoder_base_set_decoder_callback(
     decoder_base->context = context;
 }
 
+void subghz_protocol_decoder_base_feed_batch(
+    SubGhzProtocolDecoderBase* decoder_base,
+    const LevelDuration* level_duration,
+    size_t count) {
+    const SubGhzProtocolDecoder* decoder = decoder_base->protocol->decoder;
+
+    if(decoder->feed_batch) {
+        decoder->feed_batch(decoder_base, level_duration, count);
+    } else {
+        for(size_t i = 0; i < count; i++) {
+            decoder->feed(
+                decoder_base,
+                level_duration_get_level(level_duration[i]),
+                level_duration_get_duration(level_duration[i]));
+        }
+    }
+}
+
 bool subghz_protocol_decoder_base_get_string(
     SubGhzProtocolDecoderBase* decoder_base,
     FuriString* output) {
@@ -35,6 +35,18 @@ void subghz_protocol_decoder_base_set_decoder_callback(
     SubGhzProtocolDecoderBaseRxCallback callback,
     void* context);
 
+/**
+ * Parse a block of levels and durations received from the air.
+ * Uses decoder feed_batch if provided, feed for every pulse otherwise.
+ * @param decoder_base Pointer to a SubGhzProtocolDecoderBase instance
+ * @param level_duration Pulses, in order of reception
+ * @param count Number of pulses
+ */
+void subghz_protocol_decoder_base_feed_batch(
+    SubGhzProtocolDecoderBase* decoder_base,
+    const LevelDuration* level_duration,
+    size_t count);
+
 /**
  * Getting a textual representation of the received data.
  * @param decoder_base Pointer to a SubGhzProtocolDecoderBase instance
@@ -52,12 +52,18 @@ typedef enum {
     BETTDecoderStepCheckDuration,
 } BETTDecoderStep;
 
+static SubGhzBlockEnvelope subghz_protocol_decoder_bett_get_envelope() {
+    return subghz_protocol_blocks_envelope(
+        subghz_protocol_bett_const.te_short * 44, subghz_protocol_bett_const.te_delta * 15);
+}
+
 const SubGhzProtocolDecoder subghz_protocol_bett_decoder = {
     .alloc = subghz_protocol_decoder_bett_alloc,
     .free = subghz_protocol_decoder_bett_free,
 
     .feed = subghz_protocol_decoder_bett_feed,
     .reset = subghz_protocol_decoder_bett_reset,
+    .get_envelope = subghz_protocol_decoder_bett_get_envelope,
 
     .get_hash_data = subghz_protocol_decoder_bett_get_hash_data,
     .serialize = subghz_protocol_decoder_bett_serialize,
@@ -47,12 +47,19 @@ typedef enum {
     CameDecoderStepCheckDuration,
 } CameDecoderStep;
 
+static SubGhzBlockEnvelope subghz_protocol_decoder_came_get_envelope() {
+    return subghz_protocol_blocks_envelope(
+        subghz_protocol_came_const.te_short * 56, subghz_protocol_came_const.te_delta * 47);
+}
+
 const SubGhzProtocolDecoder subghz_protocol_came_decoder = {
     .alloc = subghz_protocol_decoder_came_alloc,
     .free = subghz_protocol_decoder_came_free,
 
     .feed = subghz_protocol_decoder_came_feed,
+    .feed_batch = subghz_protocol_decoder_came_feed_batch,
     .reset = subghz_protocol_decoder_came_reset,
+    .get_envelope = subghz_protocol_decoder_came_get_envelope,
 
     .get_hash_data = subghz_protocol_decoder_came_get_hash_data,
     .serialize = subghz_protocol_decoder_came_serialize,
@@ -215,13 +222,17 @@ void subghz_protocol_decoder_came_reset(void* context) {
     instance->decoder.parser_step = CameDecoderStepReset;
 }
 
+static inline bool subghz_protocol_decoder_came_is_header(bool level, uint32_t duration) {
+    return (!level) && (DURATION_DIFF(duration, subghz_protocol_came_const.te_short * 56) <
+                        subghz_protocol_came_const.te_delta * 47);
+}
+
 void subghz_protocol_decoder_came_feed(void* context, bool level, uint32_t duration) {
     furi_assert(context);
     SubGhzProtocolDecoderCame* instance = context;
     switch(instance->decoder.parser_step) {
     case CameDecoderStepReset:
-        if((!level) && (DURATION_DIFF(duration, subghz_protocol_came_const.te_short * 56) <
-                        subghz_protocol_came_const.te_delta * 47)) {
+        if(subghz_protocol_decoder_came_is_header(level, duration)) {
             //Found header CAME
             instance->decoder.parser_step = CameDecoderStepFoundStartBit;
         }
@@ -287,6 +298,25 @@ void subghz_protocol_decoder_came_feed(void* context, bool level, uint32_t durat
     }
 }
 
+void subghz_protocol_decoder_came_feed_batch(
+    void* context,
+    const LevelDuration* level_duration,
+    size_t count) {
+    furi_assert(context);
+    SubGhzProtocolDecoderCame* instance = context;
+
+    for(size_t i = 0; i < count; i++) {
+        bool level = level_duration_get_level(level_duration[i]);
+        uint32_t duration = level_duration_get_duration(level_duration[i]);
+        // Idle until the long CAME header, skip everything else in a tight loop
+        if((instance->decoder.parser_step == CameDecoderStepReset) &&
+           !subghz_protocol_decoder_came_is_header(level, duration)) {
+            continue;
+        }
+        subghz_protocol_decoder_came_feed(instance, level, duration);
+    }
+}
+
 uint8_t subghz_protocol_decoder_came_get_hash_data(void* context) {
     furi_assert(context);
     SubGhzProtocolDecoderCame* instance = context;
@@ -39,12 +39,19 @@ typedef enum {
     CameAtomoDecoderStepDecoderData,
 } CameAtomoDecoderStep;
 
+static SubGhzBlockEnvelope subghz_protocol_decoder_came_atomo_get_envelope() {
+    return subghz_protocol_blocks_envelope(
+        subghz_protocol_came_atomo_const.te_long * 60,
+        subghz_protocol_came_atomo_const.te_delta * 40);
+}
+
 const SubGhzProtocolDecoder subghz_protocol_came_atomo_decoder = {
     .alloc = subghz_protocol_decoder_came_atomo_alloc,
     .free = subghz_protocol_decoder_came_atomo_free,
 
     .feed = subghz_protocol_decoder_came_atomo_feed,
     .reset = subghz_protocol_decoder_came_atomo_reset,
+    .get_envelope = subghz_protocol_decoder_came_atomo_get_envelope,
 
     .get_hash_data = subghz_protocol_decoder_came_atomo_get_hash_data,
     .serialize = subghz_protocol_decoder_came_atomo_serialize,
@@ -70,12 +70,19 @@ typedef enum {
     CameTweeDecoderStepDecoderData,
 } CameTweeDecoderStep;
 
+static SubGhzBlockEnvelope subghz_protocol_decoder_came_twee_get_envelope() {
+    return subghz_protocol_blocks_envelope(
+        subghz_protocol_came_twee_const.te_long * 51,
+        subghz_protocol_came_twee_const.te_delta * 20);
+}
+
 const SubGhzProtocolDecoder subghz_protocol_came_twee_decoder = {
     .alloc = subghz_protocol_decoder_came_twee_alloc,
     .free = subghz_protocol_decoder_came_twee_free,
 
     .feed = subghz_protocol_decoder_came_twee_feed,
     .reset = subghz_protocol_decoder_came_twee_reset,
+    .get_envelope = subghz_protocol_decoder_came_twee_get_envelope,
 
     .get_hash_data = subghz_protocol_decoder_came_twee_get_hash_data,
     .serialize = subghz_protocol_decoder_came_twee_serialize,
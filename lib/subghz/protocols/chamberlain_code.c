@@ -66,12 +66,19 @@ typedef enum {
     Chamb_CodeDecoderStepCheckDuration,
 } Chamb_CodeDecoderStep;
 
+static SubGhzBlockEnvelope subghz_protocol_decoder_chamb_code_get_envelope() {
+    return subghz_protocol_blocks_envelope(
+        subghz_protocol_chamb_code_const.te_short * 39,
+        subghz_protocol_chamb_code_const.te_delta * 20);
+}
+
 const SubGhzProtocolDecoder subghz_protocol_chamb_code_decoder = {
     .alloc = subghz_protocol_decoder_chamb_code_alloc,
     .free = subghz_protocol_decoder_chamb_code_free,
 
     .feed = subghz_protocol_decoder_chamb_code_feed,
     .reset = subghz_protocol_decoder_chamb_code_reset,
+    .get_envelope = subghz_protocol_decoder_chamb_code_get_envelope,
 
     .get_hash_data = subghz_protocol_decoder_chamb_code_get_hash_data,
     .serialize = subghz_protocol_decoder_chamb_code_serialize,
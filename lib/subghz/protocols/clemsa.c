@@ -51,12 +51,18 @@ typedef enum {
     ClemsaDecoderStepCheckDuration,
 } ClemsaDecoderStep;
 
+static SubGhzBlockEnvelope subghz_protocol_decoder_clemsa_get_envelope() {
+    return subghz_protocol_blocks_envelope(
+        subghz_protocol_clemsa_const.te_short * 51, subghz_protocol_clemsa_const.te_delta * 25);
+}
+
 const SubGhzProtocolDecoder subghz_protocol_clemsa_decoder = {
     .alloc = subghz_protocol_decoder_clemsa_alloc,
     .free = subghz_protocol_decoder_clemsa_free,
 
     .feed = subghz_protocol_decoder_clemsa_feed,
     .reset = subghz_protocol_decoder_clemsa_reset,
+    .get_envelope = subghz_protocol_decoder_clemsa_get_envelope,
 
     .get_hash_data = subghz_protocol_decoder_clemsa_get_hash_data,
     .serialize = subghz_protocol_decoder_clemsa_serialize,
@@ -43,12 +43,19 @@ typedef enum {
     DoitrandDecoderStepCheckDuration,
 } DoitrandDecoderStep;
 
+static SubGhzBlockEnvelope subghz_protocol_decoder_doitrand_get_envelope() {
+    return subghz_protocol_blocks_envelope(
+        subghz_protocol_doitrand_const.te_short * 62,
+        subghz_protocol_doitrand_const.te_delta * 30);
+}
+
 const SubGhzProtocolDecoder subghz_protocol_doitrand_decoder = {
     .alloc = subghz_protocol_decoder_doitrand_alloc,
     .free = subghz_protocol_decoder_doitrand_free,
 
     .feed = subghz_protocol_decoder_doitrand_feed,
     .reset = subghz_protocol_decoder_doitrand_reset,
+    .get_envelope = subghz_protocol_decoder_doitrand_get_envelope,
 
     .get_hash_data = subghz_protocol_decoder_doitrand_get_hash_data,
     .serialize = subghz_protocol_decoder_doitrand_serialize,
@@ -36,12 +36,18 @@ typedef enum {
     FaacSLHDecoderStepCheckDuration,
 } FaacSLHDecoderStep;
 
+static SubGhzBlockEnvelope subghz_protocol_decoder_faac_slh_get_envelope() {
+    return subghz_protocol_blocks_envelope(
+        subghz_protocol_faac_slh_const.te_long * 2, subghz_protocol_faac_slh_const.te_delta * 3);
+}
+
 const SubGhzProtocolDecoder subghz_protocol_faac_slh_decoder = {
     .alloc = subghz_protocol_decoder_faac_slh_alloc,
     .free = subghz_protocol_decoder_faac_slh_free,
 
     .feed = subghz_protocol_decoder_faac_slh_feed,
     .reset = subghz_protocol_decoder_faac_slh_reset,
+    .get_envelope = subghz_protocol_decoder_faac_slh_get_envelope,
 
     .get_hash_data = subghz_protocol_decoder_faac_slh_get_hash_data,
     .serialize = subghz_protocol_decoder_faac_slh_serialize,
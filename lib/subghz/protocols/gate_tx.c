@@ -36,12 +36,18 @@ typedef enum {
     GateTXDecoderStepCheckDuration,
 } GateTXDecoderStep;
 
+static SubGhzBlockEnvelope subghz_protocol_decoder_gate_tx_get_envelope() {
+    return subghz_protocol_blocks_envelope(
+        subghz_protocol_gate_tx_const.te_short * 47, subghz_protocol_gate_tx_const.te_delta * 47);
+}
+
 const SubGhzProtocolDecoder subghz_protocol_gate_tx_decoder = {
     .alloc = subghz_protocol_decoder_gate_tx_alloc,
     .free = subghz_protocol_decoder_gate_tx_free,
 
     .feed = subghz_protocol_decoder_gate_tx_feed,
     .reset = subghz_protocol_decoder_gate_tx_reset,
+    .get_envelope = subghz_protocol_decoder_gate_tx_get_envelope,
 
     .get_hash_data = subghz_protocol_decoder_gate_tx_get_hash_data,
     .serialize = subghz_protocol_decoder_gate_tx_serialize,
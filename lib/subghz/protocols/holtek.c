@@ -46,12 +46,18 @@ typedef enum {
     HoltekDecoderStepCheckDuration,
 } HoltekDecoderStep;
 
+static SubGhzBlockEnvelope subghz_protocol_decoder_holtek_get_envelope() {
+    return subghz_protocol_blocks_envelope(
+        subghz_protocol_holtek_const.te_short * 36, subghz_protocol_holtek_const.te_delta * 36);
+}
+
 const SubGhzProtocolDecoder subghz_protocol_holtek_decoder = {
     .alloc = subghz_protocol_decoder_holtek_alloc,
     .free = subghz_protocol_decoder_holtek_free,
 
     .feed = subghz_protocol_decoder_holtek_feed,
     .reset = subghz_protocol_decoder_holtek_reset,
+    .get_envelope = subghz_protocol_decoder_holtek_get_envelope,
 
     .get_hash_data = subghz_protocol_decoder_holtek_get_hash_data,
     .serialize = subghz_protocol_decoder_holtek_serialize,
@@ -53,12 +53,19 @@ typedef enum {
     Holtek_HT12XDecoderStepCheckDuration,
 } Holtek_HT12XDecoderStep;
 
+static SubGhzBlockEnvelope subghz_protocol_decoder_holtek_th12x_get_envelope() {
+    return subghz_protocol_blocks_envelope(
+        subghz_protocol_holtek_th12x_const.te_short * 36,
+        subghz_protocol_holtek_th12x_const.te_delta * 36);
+}
+
 const SubGhzProtocolDecoder subghz_protocol_holtek_th12x_decoder = {
     .alloc = subghz_protocol_decoder_holtek_th12x_alloc,
     .free = subghz_protocol_decoder_holtek_th12x_free,
 
     .feed = subghz_protocol_decoder_holtek_th12x_feed,
     .reset = subghz_protocol_decoder_holtek_th12x_reset,
+    .get_envelope = subghz_protocol_decoder_holtek_th12x_get_envelope,
 
     .get_hash_data = subghz_protocol_decoder_holtek_th12x_get_hash_data,
     .serialize = subghz_protocol_decoder_holtek_th12x_serialize,
@@ -47,12 +47,19 @@ typedef enum {
     Honeywell_WDBDecoderStepCheckDuration,
 } Honeywell_WDBDecoderStep;
 
+static SubGhzBlockEnvelope subghz_protocol_decoder_honeywell_wdb_get_envelope() {
+    return subghz_protocol_blocks_envelope(
+        subghz_protocol_honeywell_wdb_const.te_short * 3,
+        subghz_protocol_honeywell_wdb_const.te_delta);
+}
+
 const SubGhzProtocolDecoder subghz_protocol_honeywell_wdb_decoder = {
     .alloc = subghz_protocol_decoder_honeywell_wdb_alloc,
     .free = subghz_protocol_decoder_honeywell_wdb_free,
 
     .feed = subghz_protocol_decoder_honeywell_wdb_feed,
     .reset = subghz_protocol_decoder_honeywell_wdb_reset,
+    .get_envelope = subghz_protocol_decoder_honeywell_wdb_get_envelope,
 
     .get_hash_data = subghz_protocol_decoder_honeywell_wdb_get_hash_data,
     .serialize = subghz_protocol_decoder_honeywell_wdb_serialize,
@@ -40,12 +40,18 @@ typedef enum {
     HormannDecoderStepCheckDuration,
 } HormannDecoderStep;
 
+static SubGhzBlockEnvelope subghz_protocol_decoder_hormann_get_envelope() {
+    return subghz_protocol_blocks_envelope(
+        subghz_protocol_hormann_const.te_short * 24, subghz_protocol_hormann_const.te_delta * 24);
+}
+
 const SubGhzProtocolDecoder subghz_protocol_hormann_decoder = {
     .alloc = subghz_protocol_decoder_hormann_alloc,
     .free = subghz_protocol_decoder_hormann_free,
 
     .feed = subghz_protocol_decoder_hormann_feed,
     .reset = subghz_protocol_decoder_hormann_reset,
+    .get_envelope = subghz_protocol_decoder_hormann_get_envelope,
 
     .get_hash_data = subghz_protocol_decoder_hormann_get_hash_data,
     .serialize = subghz_protocol_decoder_hormann_serialize,
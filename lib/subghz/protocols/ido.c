@@ -36,12 +36,18 @@ typedef enum {
     IDoDecoderStepCheckDuration,
 } IDoDecoderStep;
 
+static SubGhzBlockEnvelope subghz_protocol_decoder_ido_get_envelope() {
+    return subghz_protocol_blocks_envelope(
+        subghz_protocol_ido_const.te_short * 10, subghz_protocol_ido_const.te_delta * 5);
+}
+
 const SubGhzProtocolDecoder subghz_protocol_ido_decoder = {
     .alloc = subghz_protocol_decoder_ido_alloc,
     .free = subghz_protocol_decoder_ido_free,
 
     .feed = subghz_protocol_decoder_ido_feed,
     .reset = subghz_protocol_decoder_ido_reset,
+    .get_envelope = subghz_protocol_decoder_ido_get_envelope,
 
     .get_hash_data = subghz_protocol_decoder_ido_get_hash_data,
     .deserialize = subghz_protocol_decoder_ido_deserialize,
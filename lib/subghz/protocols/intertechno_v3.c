@@ -45,12 +45,19 @@ typedef enum {
     IntertechnoV3DecoderStepEndDuration,
 } IntertechnoV3DecoderStep;
 
+static SubGhzBlockEnvelope subghz_protocol_decoder_intertechno_v3_get_envelope() {
+    return subghz_protocol_blocks_envelope(
+        subghz_protocol_intertechno_v3_const.te_short * 37,
+        subghz_protocol_intertechno_v3_const.te_delta * 15);
+}
+
 const SubGhzProtocolDecoder subghz_protocol_intertechno_v3_decoder = {
     .alloc = subghz_protocol_decoder_intertechno_v3_alloc,
     .free = subghz_protocol_decoder_intertechno_v3_free,
 
     .feed = subghz_protocol_decoder_intertechno_v3_feed,
     .reset = subghz_protocol_decoder_intertechno_v3_reset,
+    .get_envelope = subghz_protocol_decoder_intertechno_v3_get_envelope,
 
     .get_hash_data = subghz_protocol_decoder_intertechno_v3_get_hash_data,
     .serialize = subghz_protocol_decoder_intertechno_v3_serialize,
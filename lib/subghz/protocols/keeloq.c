@@ -19,6 +19,35 @@ static const SubGhzBlockConst subghz_protocol_keeloq_const = {
     .min_count_bit_for_found = 64,
 };
 
+/** Keystore entry expanded into a single learning type to try */
+typedef struct {
+    uint64_t key;
+    const char* name;
+    uint8_t learning;
+} SubGhzProtocolKeeloqCandidate;
+
+/** Search index over keystore, built on first lookup */
+typedef struct {
+    const SubGhzKeystore* keystore;
+    size_t keystore_size;
+
+    SubGhzProtocolKeeloqCandidate* candidates;
+    size_t candidates_count;
+
+    // Manufacture keys derived for man_fix, valid for the first man_count candidates
+    uint64_t* man;
+    size_t man_count;
+    uint32_t man_fix;
+    uint32_t decrypt[KEELOQ_MULTI_KEY_COUNT];
+
+    // Result of the last search
+    bool last_valid;
+    uint32_t last_fix;
+    uint32_t last_hop;
+    const char* last_name;
+    uint32_t last_cnt;
+} SubGhzProtocolKeeloqIndex;
+
 struct SubGhzProtocolDecoderKeeloq {
     SubGhzProtocolDecoderBase base;
 
@@ -27,6 +56,7 @@ struct SubGhzProtocolDecoderKeeloq {
 
     uint16_t header_count;
     SubGhzKeystore* keystore;
+    SubGhzProtocolKeeloqIndex index;
     const char* manufacture_name;
 };
 
@@ -37,6 +67,7 @@ struct SubGhzProtocolEncoderKeeloq {
     SubGhzBlockGeneric generic;
 
     SubGhzKeystore* keystore;
+    SubGhzProtocolKeeloqIndex index;
     const char* manufacture_name;
 };
 
@@ -47,12 +78,19 @@ typedef enum {
     KeeloqDecoderStepCheckDuration,
 } KeeloqDecoderStep;
 
+static SubGhzBlockEnvelope subghz_protocol_decoder_keeloq_get_envelope() {
+    return subghz_protocol_blocks_envelope(
+        subghz_protocol_keeloq_const.te_short, subghz_protocol_keeloq_const.te_delta);
+}
+
 const SubGhzProtocolDecoder subghz_protocol_keeloq_decoder = {
     .alloc = subghz_protocol_decoder_keeloq_alloc,
     .free = subghz_protocol_decoder_keeloq_free,
 
     .feed = subghz_protocol_decoder_keeloq_feed,
+    .feed_batch = subghz_protocol_decoder_keeloq_feed_batch,
     .reset = subghz_protocol_decoder_keeloq_reset,
+    .get_envelope = subghz_protocol_decoder_keeloq_get_envelope,
 
     .get_hash_data = subghz_protocol_decoder_keeloq_get_hash_data,
     .serialize = subghz_protocol_decoder_keeloq_serialize,
@@ -89,6 +127,7 @@ const SubGhzProtocol subghz_protocol_keeloq = {
 static void subghz_protocol_keeloq_check_remote_controller(
     SubGhzBlockGeneric* instance,
     SubGhzKeystore* keystore,
+    SubGhzProtocolKeeloqIndex* index,
     const char** manufacture_name);
 
 void* subghz_protocol_encoder_keeloq_alloc(SubGhzEnvironment* environment) {
@@ -108,6 +147,8 @@ void* subghz_protocol_encoder_keeloq_alloc(SubGhzEnvironment* environment) {
 void subghz_protocol_encoder_keeloq_free(void* context) {
     furi_assert(context);
     SubGhzProtocolEncoderKeeloq* instance = context;
+    free(instance->index.candidates);
+    free(instance->index.man);
     free(instance->encoder.upload);
     free(instance);
 }
@@ -130,7 +171,7 @@ static bool subghz_protocol_keeloq_gen_data(SubGhzProtocolEncoderKeeloq* instanc
 
     for
         M_EACH(manufacture_code, *subghz_keystore_get_data(instance->keystore), SubGhzKeyArray_t) {
-            res = strcmp(furi_string_get_cstr(manufacture_code->name), instance->manufacture_name);
+            res = strcmp(manufacture_code->name, instance->manufacture_name);
             if(res == 0) {
                 switch(manufacture_code->type) {
                 case KEELOQ_LEARNING_SIMPLE:
@@ -269,7 +310,10 @@ bool subghz_protocol_encoder_keeloq_deserialize(void* context, FlipperFormat* fl
             break;
         }
         subghz_protocol_keeloq_check_remote_controller(
-            &instance->generic, instance->keystore, &instance->manufacture_name);
+            &instance->generic,
+            instance->keystore,
+            &instance->index,
+            &instance->manufacture_name);
 
         if(strcmp(instance->manufacture_name, "DoorHan") != 0) {
             FURI_LOG_E(TAG, "Wrong manufacturer name");
@@ -339,6 +383,8 @@ void subghz_protocol_decoder_keeloq_free(void* context) {
     furi_assert(context);
     SubGhzProtocolDecoderKeeloq* instance = context;
 
+    free(instance->index.candidates);
+    free(instance->index.man);
     free(instance);
 }
 
@@ -348,14 +394,18 @@ void subghz_protocol_decoder_keeloq_reset(void* context) {
     instance->decoder.parser_step = KeeloqDecoderStepReset;
 }
 
+static inline bool subghz_protocol_decoder_keeloq_is_header(bool level, uint32_t duration) {
+    return (level) && (DURATION_DIFF(duration, subghz_protocol_keeloq_const.te_short) <
+                       subghz_protocol_keeloq_const.te_delta);
+}
+
 void subghz_protocol_decoder_keeloq_feed(void* context, bool level, uint32_t duration) {
     furi_assert(context);
     SubGhzProtocolDecoderKeeloq* instance = context;
 
     switch(instance->decoder.parser_step) {
     case KeeloqDecoderStepReset:
-        if((level) && DURATION_DIFF(duration, subghz_protocol_keeloq_const.te_short) <
-                          subghz_protocol_keeloq_const.te_delta) {
+        if(subghz_protocol_decoder_keeloq_is_header(level, duration)) {
             instance->decoder.parser_step = KeeloqDecoderStepCheckPreambula;
             instance->header_count++;
         }
@@ -435,6 +485,25 @@ void subghz_protocol_decoder_keeloq_feed(void* context, bool level, uint32_t dur
     }
 }
 
+void subghz_protocol_decoder_keeloq_feed_batch(
+    void* context,
+    const LevelDuration* level_duration,
+    size_t count) {
+    furi_assert(context);
+    SubGhzProtocolDecoderKeeloq* instance = context;
+
+    for(size_t i = 0; i < count; i++) {
+        bool level = level_duration_get_level(level_duration[i]);
+        uint32_t duration = level_duration_get_duration(level_duration[i]);
+        // Only a te_short high pulse can start the preamble, skip the rest while idle
+        if((instance->decoder.parser_step == KeeloqDecoderStepReset) &&
+           !subghz_protocol_decoder_keeloq_is_header(level, duration)) {
+            continue;
+        }
+        subghz_protocol_decoder_keeloq_feed(instance, level, duration);
+    }
+}
+
 /**
  * Validation of decrypt data.
  * @param instance Pointer to a SubGhzBlockGeneric instance
@@ -457,173 +526,211 @@ static inline bool subghz_protocol_keeloq_check_decrypt(
     return false;
 }
 
+static uint64_t subghz_protocol_keeloq_mirror_key(uint64_t key) {
+    uint64_t man_rev = 0;
+    uint64_t man_rev_byte = 0;
+    for(uint8_t i = 0; i < 64; i += 8) {
+        man_rev_byte = (uint8_t)(key >> i);
+        man_rev = man_rev | man_rev_byte << (56 - i);
+    }
+    return man_rev;
+}
+
 /** 
- * Checking the accepted code against the database manafacture key
- * @param instance Pointer to a SubGhzBlockGeneric* instance
- * @param fix Fix part of the parcel
- * @param hop Hop encrypted part of the parcel
+ * Expand keystore into the list of (key, learning type) pairs to try, in search order.
+ * Learning types that keystore doesn't use never show up in the list.
+ * @param index Pointer to a SubGhzProtocolKeeloqIndex instance
  * @param keystore Pointer to a SubGhzKeystore* instance
- * @param manufacture_name 
- * @return true on successful search
+ * @return candidates count
  */
-static uint8_t subghz_protocol_keeloq_check_remote_controller_selector(
-    SubGhzBlockGeneric* instance,
-    uint32_t fix,
-    uint32_t hop,
-    SubGhzKeystore* keystore,
-    const char** manufacture_name) {
-    // protocol HCS300 uses 10 bits in discriminator, HCS200 uses 8 bits, for backward compatibility, we are looking for the 8-bit pattern
-    // HCS300 -> uint16_t end_serial = (uint16_t)(fix & 0x3FF);
-    // HCS200 -> uint16_t end_serial = (uint16_t)(fix & 0xFF);
-
-    uint16_t end_serial = (uint16_t)(fix & 0xFF);
-    uint8_t btn = (uint8_t)(fix >> 28);
-    uint32_t decrypt = 0;
-    uint64_t man;
-    uint32_t seed = 0;
+static size_t subghz_protocol_keeloq_index_fill(
+    SubGhzProtocolKeeloqIndex* index,
+    SubGhzKeystore* keystore) {
+    // Unknown learning type is tried as each known one, with both key byte orders
+    static const uint8_t unknown_learning[] = {
+        KEELOQ_LEARNING_SIMPLE,
+        KEELOQ_LEARNING_NORMAL,
+        KEELOQ_LEARNING_SECURE,
+        KEELOQ_LEARNING_MAGIC_XOR_TYPE_1,
+    };
+    size_t count = 0;
 
     for
         M_EACH(manufacture_code, *subghz_keystore_get_data(keystore), SubGhzKeyArray_t) {
+            const char* name = manufacture_code->name;
             switch(manufacture_code->type) {
             case KEELOQ_LEARNING_SIMPLE:
-                // Simple Learning
-                decrypt = subghz_protocol_keeloq_common_decrypt(hop, manufacture_code->key);
-                if(subghz_protocol_keeloq_check_decrypt(instance, decrypt, btn, end_serial)) {
-                    *manufacture_name = furi_string_get_cstr(manufacture_code->name);
-                    return 1;
-                }
-                break;
             case KEELOQ_LEARNING_NORMAL:
-                // Normal Learning
-                // https://phreakerclub.com/forum/showpost.php?p=43557&postcount=37
-                man = subghz_protocol_keeloq_common_normal_learning(fix, manufacture_code->key);
-                decrypt = subghz_protocol_keeloq_common_decrypt(hop, man);
-                if(subghz_protocol_keeloq_check_decrypt(instance, decrypt, btn, end_serial)) {
-                    *manufacture_name = furi_string_get_cstr(manufacture_code->name);
-                    return 1;
-                }
-                break;
             case KEELOQ_LEARNING_SECURE:
-                man = subghz_protocol_keeloq_common_secure_learning(
-                    fix, seed, manufacture_code->key);
-                decrypt = subghz_protocol_keeloq_common_decrypt(hop, man);
-                if(subghz_protocol_keeloq_check_decrypt(instance, decrypt, btn, end_serial)) {
-                    *manufacture_name = furi_string_get_cstr(manufacture_code->name);
-                    return 1;
-                }
-                break;
             case KEELOQ_LEARNING_MAGIC_XOR_TYPE_1:
-                man = subghz_protocol_keeloq_common_magic_xor_type1_learning(
-                    fix, manufacture_code->key);
-                decrypt = subghz_protocol_keeloq_common_decrypt(hop, man);
-                if(subghz_protocol_keeloq_check_decrypt(instance, decrypt, btn, end_serial)) {
-                    *manufacture_name = furi_string_get_cstr(manufacture_code->name);
-                    return 1;
-                }
-                break;
             case KEELOQ_LEARNING_MAGIC_SERIAL_TYPE_1:
-                man = subghz_protocol_keeloq_common_magic_serial_type1_learning(
-                    fix, manufacture_code->key);
-                decrypt = subghz_protocol_keeloq_common_decrypt(hop, man);
-                if(subghz_protocol_keeloq_check_decrypt(instance, decrypt, btn, end_serial)) {
-                    *manufacture_name = furi_string_get_cstr(manufacture_code->name);
-                    return 1;
-                }
-                break;
             case KEELOQ_LEARNING_MAGIC_SERIAL_TYPE_2:
-                man = subghz_protocol_keeloq_common_magic_serial_type2_learning(
-                    fix, manufacture_code->key);
-                decrypt = subghz_protocol_keeloq_common_decrypt(hop, man);
-                if(subghz_protocol_keeloq_check_decrypt(instance, decrypt, btn, end_serial)) {
-                    *manufacture_name = furi_string_get_cstr(manufacture_code->name);
-                    return 1;
-                }
-                break;
             case KEELOQ_LEARNING_MAGIC_SERIAL_TYPE_3:
-                man = subghz_protocol_keeloq_common_magic_serial_type3_learning(
-                    fix, manufacture_code->key);
-                decrypt = subghz_protocol_keeloq_common_decrypt(hop, man);
-                if(subghz_protocol_keeloq_check_decrypt(instance, decrypt, btn, end_serial)) {
-                    *manufacture_name = furi_string_get_cstr(manufacture_code->name);
-                    return 1;
+                if(index->candidates) {
+                    index->candidates[count] = (SubGhzProtocolKeeloqCandidate){
+                        .key = manufacture_code->key,
+                        .name = name,
+                        .learning = manufacture_code->type};
                 }
+                count++;
                 break;
             case KEELOQ_LEARNING_UNKNOWN:
-                // Simple Learning
-                decrypt = subghz_protocol_keeloq_common_decrypt(hop, manufacture_code->key);
-                if(subghz_protocol_keeloq_check_decrypt(instance, decrypt, btn, end_serial)) {
-                    *manufacture_name = furi_string_get_cstr(manufacture_code->name);
-                    return 1;
+                for(size_t i = 0; i < COUNT_OF(unknown_learning); i++) {
+                    if(index->candidates) {
+                        index->candidates[count] = (SubGhzProtocolKeeloqCandidate){
+                            .key = manufacture_code->key,
+                            .name = name,
+                            .learning = unknown_learning[i]};
+                        index->candidates[count + 1] = (SubGhzProtocolKeeloqCandidate){
+                            .key = subghz_protocol_keeloq_mirror_key(manufacture_code->key),
+                            .name = name,
+                            .learning = unknown_learning[i]};
+                    }
+                    count += 2;
                 }
+                break;
+            }
+        }
 
-                // Check for mirrored man
-                uint64_t man_rev = 0;
-                uint64_t man_rev_byte = 0;
-                for(uint8_t i = 0; i < 64; i += 8) {
-                    man_rev_byte = (uint8_t)(manufacture_code->key >> i);
-                    man_rev = man_rev | man_rev_byte << (56 - i);
-                }
+    return count;
+}
 
-                decrypt = subghz_protocol_keeloq_common_decrypt(hop, man_rev);
-                if(subghz_protocol_keeloq_check_decrypt(instance, decrypt, btn, end_serial)) {
-                    *manufacture_name = furi_string_get_cstr(manufacture_code->name);
-                    return 1;
-                }
+/** 
+ * Rebuild index if keystore has changed since the last search
+ * @param index Pointer to a SubGhzProtocolKeeloqIndex instance
+ * @param keystore Pointer to a SubGhzKeystore* instance
+ */
+static void subghz_protocol_keeloq_index_update(
+    SubGhzProtocolKeeloqIndex* index,
+    SubGhzKeystore* keystore) {
+    size_t keystore_size = SubGhzKeyArray_size(*subghz_keystore_get_data(keystore));
+    if(index->candidates && index->keystore == keystore &&
+       index->keystore_size == keystore_size) {
+        return;
+    }
 
-                //###########################
-                // Normal Learning
-                // https://phreakerclub.com/forum/showpost.php?p=43557&postcount=37
-                man = subghz_protocol_keeloq_common_normal_learning(fix, manufacture_code->key);
-                decrypt = subghz_protocol_keeloq_common_decrypt(hop, man);
-                if(subghz_protocol_keeloq_check_decrypt(instance, decrypt, btn, end_serial)) {
-                    *manufacture_name = furi_string_get_cstr(manufacture_code->name);
-                    return 1;
-                }
+    free(index->candidates);
+    free(index->man);
+    index->candidates = NULL;
+
+    index->keystore = keystore;
+    index->keystore_size = keystore_size;
+    index->candidates_count = subghz_protocol_keeloq_index_fill(index, keystore);
+    // Always allocate, non-NULL candidates marks index as built
+    index->candidates =
+        malloc(sizeof(SubGhzProtocolKeeloqCandidate) * (index->candidates_count + 1));
+    subghz_protocol_keeloq_index_fill(index, keystore);
+    index->man = malloc(sizeof(uint64_t) * (index->candidates_count + 1));
+    index->man_count = 0;
+    index->last_valid = false;
+}
 
-                // Check for mirrored man
-                man = subghz_protocol_keeloq_common_normal_learning(fix, man_rev);
-                decrypt = subghz_protocol_keeloq_common_decrypt(hop, man);
-                if(subghz_protocol_keeloq_check_decrypt(instance, decrypt, btn, end_serial)) {
-                    *manufacture_name = furi_string_get_cstr(manufacture_code->name);
-                    return 1;
-                }
+/** 
+ * Manufacture key for the candidate and the given fix, derived at most once per fix
+ * @param index Pointer to a SubGhzProtocolKeeloqIndex instance
+ * @param candidate_index Candidate position, candidates are derived in order
+ * @param fix Fix part of the parcel
+ * @return manufacture key
+ */
+static uint64_t subghz_protocol_keeloq_index_get_man(
+    SubGhzProtocolKeeloqIndex* index,
+    size_t candidate_index,
+    uint32_t fix) {
+    if(index->man_fix != fix) {
+        index->man_fix = fix;
+        index->man_count = 0;
+    }
 
-                // Secure Learning
-                man = subghz_protocol_keeloq_common_secure_learning(
-                    fix, seed, manufacture_code->key);
-                decrypt = subghz_protocol_keeloq_common_decrypt(hop, man);
-                if(subghz_protocol_keeloq_check_decrypt(instance, decrypt, btn, end_serial)) {
-                    *manufacture_name = furi_string_get_cstr(manufacture_code->name);
-                    return 1;
-                }
+    while(index->man_count <= candidate_index) {
+        const SubGhzProtocolKeeloqCandidate* candidate = &index->candidates[index->man_count];
+        uint64_t man = candidate->key;
+        switch(candidate->learning) {
+        case KEELOQ_LEARNING_NORMAL:
+            // https://phreakerclub.com/forum/showpost.php?p=43557&postcount=37
+            man = subghz_protocol_keeloq_common_normal_learning(fix, candidate->key);
+            break;
+        case KEELOQ_LEARNING_SECURE:
+            man = subghz_protocol_keeloq_common_secure_learning(fix, 0, candidate->key);
+            break;
+        case KEELOQ_LEARNING_MAGIC_XOR_TYPE_1:
+            man = subghz_protocol_keeloq_common_magic_xor_type1_learning(fix, candidate->key);
+            break;
+        case KEELOQ_LEARNING_MAGIC_SERIAL_TYPE_1:
+            man = subghz_protocol_keeloq_common_magic_serial_type1_learning(fix, candidate->key);
+            break;
+        case KEELOQ_LEARNING_MAGIC_SERIAL_TYPE_2:
+            man = subghz_protocol_keeloq_common_magic_serial_type2_learning(fix, candidate->key);
+            break;
+        case KEELOQ_LEARNING_MAGIC_SERIAL_TYPE_3:
+            man = subghz_protocol_keeloq_common_magic_serial_type3_learning(fix, candidate->key);
+            break;
+        }
+        index->man[index->man_count++] = man;
+    }
 
-                // Check for mirrored man
-                man = subghz_protocol_keeloq_common_secure_learning(fix, seed, man_rev);
-                decrypt = subghz_protocol_keeloq_common_decrypt(hop, man);
-                if(subghz_protocol_keeloq_check_decrypt(instance, decrypt, btn, end_serial)) {
-                    *manufacture_name = furi_string_get_cstr(manufacture_code->name);
-                    return 1;
-                }
+    return index->man[candidate_index];
+}
 
-                // Magic xor type1 learning
-                man = subghz_protocol_keeloq_common_magic_xor_type1_learning(
-                    fix, manufacture_code->key);
-                decrypt = subghz_protocol_keeloq_common_decrypt(hop, man);
-                if(subghz_protocol_keeloq_check_decrypt(instance, decrypt, btn, end_serial)) {
-                    *manufacture_name = furi_string_get_cstr(manufacture_code->name);
-                    return 1;
-                }
+/** 
+ * Checking the accepted code against the database manafacture key
+ * @param instance Pointer to a SubGhzBlockGeneric* instance
+ * @param fix Fix part of the parcel
+ * @param hop Hop encrypted part of the parcel
+ * @param keystore Pointer to a SubGhzKeystore* instance
+ * @param index Pointer to a SubGhzProtocolKeeloqIndex instance
+ * @param manufacture_name 
+ * @return true on successful search
+ */
+static uint8_t subghz_protocol_keeloq_check_remote_controller_selector(
+    SubGhzBlockGeneric* instance,
+    uint32_t fix,
+    uint32_t hop,
+    SubGhzKeystore* keystore,
+    SubGhzProtocolKeeloqIndex* index,
+    const char** manufacture_name) {
+    // protocol HCS300 uses 10 bits in discriminator, HCS200 uses 8 bits, for backward compatibility, we are looking for the 8-bit pattern
+    // HCS300 -> uint16_t end_serial = (uint16_t)(fix & 0x3FF);
+    // HCS200 -> uint16_t end_serial = (uint16_t)(fix & 0xFF);
+
+    uint16_t end_serial = (uint16_t)(fix & 0xFF);
+    uint8_t btn = (uint8_t)(fix >> 28);
 
-                // Check for mirrored man
-                man = subghz_protocol_keeloq_common_magic_xor_type1_learning(fix, man_rev);
-                decrypt = subghz_protocol_keeloq_common_decrypt(hop, man);
-                if(subghz_protocol_keeloq_check_decrypt(instance, decrypt, btn, end_serial)) {
-                    *manufacture_name = furi_string_get_cstr(manufacture_code->name);
-                    return 1;
+    subghz_protocol_keeloq_index_update(index, keystore);
+
+    // Same parcel is checked again on every serialize and get_string
+    if(!index->last_valid || index->last_fix != fix || index->last_hop != hop) {
+        index->last_valid = true;
+        index->last_fix = fix;
+        index->last_hop = hop;
+        index->last_name = NULL;
+        index->last_cnt = 0;
+
+        // Decrypt candidates KEELOQ_MULTI_KEY_COUNT at a time, check them in order.
+        // Runs in SubGhzWorker thread on rx: keys and results are kept in the index,
+        // decrypt_multi itself takes 384 bytes of stack for the sliced key and state
+        for(size_t i = 0; i < index->candidates_count && !index->last_name;
+            i += KEELOQ_MULTI_KEY_COUNT) {
+            size_t count = MIN((size_t)KEELOQ_MULTI_KEY_COUNT, index->candidates_count - i);
+            subghz_protocol_keeloq_index_get_man(index, i + count - 1, fix);
+            subghz_protocol_keeloq_common_decrypt_multi(
+                hop, &index->man[i], count, index->decrypt);
+
+            for(size_t j = 0; j < count; j++) {
+                if(subghz_protocol_keeloq_check_decrypt(
+                       instance, index->decrypt[j], btn, end_serial)) {
+                    index->last_name = index->candidates[i + j].name;
+                    index->last_cnt = instance->cnt;
+                    break;
                 }
-                break;
             }
         }
+    }
+
+    if(index->last_name) {
+        *manufacture_name = index->last_name;
+        instance->cnt = index->last_cnt;
+        return 1;
+    }
 
     *manufacture_name = "Unknown";
     instance->cnt = 0;
@@ -634,6 +741,7 @@ static uint8_t subghz_protocol_keeloq_check_remote_controller_selector(
 static void subghz_protocol_keeloq_check_remote_controller(
     SubGhzBlockGeneric* instance,
     SubGhzKeystore* keystore,
+    SubGhzProtocolKeeloqIndex* index,
     const char** manufacture_name) {
     uint64_t key = subghz_protocol_blocks_reverse_key(instance->data, instance->data_count_bit);
     uint32_t key_fix = key >> 32;
@@ -648,7 +756,7 @@ static void subghz_protocol_keeloq_check_remote_controller(
         instance->cnt = key_hop >> 16;
     } else {
         subghz_protocol_keeloq_check_remote_controller_selector(
-            instance, key_fix, key_hop, keystore, manufacture_name);
+            instance, key_fix, key_hop, keystore, index, manufacture_name);
     }
 
     instance->serial = key_fix & 0x0FFFFFFF;
@@ -669,7 +777,7 @@ bool subghz_protocol_decoder_keeloq_serialize(
     furi_assert(context);
     SubGhzProtocolDecoderKeeloq* instance = context;
     subghz_protocol_keeloq_check_remote_controller(
-        &instance->generic, instance->keystore, &instance->manufacture_name);
+        &instance->generic, instance->keystore, &instance->index, &instance->manufacture_name);
 
     bool res = subghz_block_generic_serialize(&instance->generic, flipper_format, preset);
 
@@ -705,7 +813,7 @@ void subghz_protocol_decoder_keeloq_get_string(void* context, FuriString* output
     furi_assert(context);
     SubGhzProtocolDecoderKeeloq* instance = context;
     subghz_protocol_keeloq_check_remote_controller(
-        &instance->generic, instance->keystore, &instance->manufacture_name);
+        &instance->generic, instance->keystore, &instance->index, &instance->manufacture_name);
 
     uint32_t code_found_hi = instance->generic.data >> 32;
     uint32_t code_found_lo = instance->generic.data & 0x00000000ffffffff;
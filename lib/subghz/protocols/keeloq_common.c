@@ -4,9 +4,12 @@
 
 #include <m-array.h>
 
-#define bit(x, n) (((x) >> (n)) & 1)
-#define g5(x, a, b, c, d, e) \
-    (bit(x, a) + bit(x, b) * 2 + bit(x, c) * 4 + bit(x, d) * 8 + bit(x, e) * 16)
+/* NLF input taps, gathered into a 5 bit index of the KEELOQ_NLF truth table */
+#define KEELOQ_NLF_INDEX(x, a, b, c, d, e)                                  \
+    ((((x) >> (a)) & 1) | (((x) >> ((b)-1)) & 2) | (((x) >> ((c)-2)) & 4) | \
+     (((x) >> ((d)-3)) & 8) | (((x) >> ((e)-4)) & 16))
+#define KEELOQ_NLF_LOOKUP(x, a, b, c, d, e) \
+    ((KEELOQ_NLF >> KEELOQ_NLF_INDEX(x, a, b, c, d, e)) & 1)
 
 /** Simple Learning Encrypt
  * @param data - 0xBSSSCCCC, B(4bit) key, S(10bit) serial&0x3FF, C(16bit) counter
@@ -15,10 +18,14 @@
  */
 inline uint32_t subghz_protocol_keeloq_common_encrypt(const uint32_t data, const uint64_t key) {
     uint32_t x = data, r;
-    for(r = 0; r < 528; r++)
-        x = (x >> 1) ^ ((bit(x, 0) ^ bit(x, 16) ^ (uint32_t)bit(key, r & 63) ^
-                         bit(KEELOQ_NLF, g5(x, 1, 9, 20, 26, 31)))
-                        << 31);
+    // Round r uses key bit r & 63: rotate key right instead of shifting by r
+    uint64_t k = key;
+    for(r = 0; r < 528; r++) {
+        uint32_t key_bit = k & 1;
+        k = (k >> 1) | ((uint64_t)key_bit << 63);
+        uint32_t nlf = KEELOQ_NLF_LOOKUP(x, 1, 9, 20, 26, 31);
+        x = (x >> 1) ^ (((x ^ (x >> 16) ^ key_bit ^ nlf) & 1) << 31);
+    }
     return x;
 }
 
@@ -29,12 +36,73 @@ inline uint32_t subghz_protocol_keeloq_common_encrypt(const uint32_t data, const
  */
 inline uint32_t subghz_protocol_keeloq_common_decrypt(const uint32_t data, const uint64_t key) {
     uint32_t x = data, r;
-    for(r = 0; r < 528; r++)
-        x = (x << 1) ^ bit(x, 31) ^ bit(x, 15) ^ (uint32_t)bit(key, (15 - r) & 63) ^
-            bit(KEELOQ_NLF, g5(x, 0, 8, 19, 25, 30));
+    // Round r uses key bit (15 - r) & 63: start with bit 15 on top and rotate key left
+    uint64_t k = (key << 48) | (key >> 16);
+    for(r = 0; r < 528; r++) {
+        uint32_t key_bit = k >> 63;
+        k = (k << 1) | key_bit;
+        uint32_t nlf = KEELOQ_NLF_LOOKUP(x, 0, 8, 19, 25, 30);
+        x = (x << 1) ^ (((x >> 31) ^ (x >> 15) ^ key_bit ^ nlf) & 1);
+    }
     return x;
 }
 
+/** Bitsliced KEELOQ_NLF: every bit of the arguments is a separate key lane
+ * Algebraic normal form of 0x3A5C742E:
+ * a ^ b ^ ab ^ bc ^ ad ^ cd ^ ae ^ abe ^ ce ^ ace ^ bde ^ cde
+ */
+static inline uint32_t subghz_protocol_keeloq_common_nlf_sliced(
+    uint32_t a,
+    uint32_t b,
+    uint32_t c,
+    uint32_t d,
+    uint32_t e) {
+    uint32_t a_not_b = a & ~b;
+    uint32_t f0 = a_not_b ^ b ^ (b & c) ^ (d & (a ^ c));
+    uint32_t f1 = a_not_b ^ c ^ (a & c) ^ (d & (b ^ c));
+    return f0 ^ (e & f1);
+}
+
+void subghz_protocol_keeloq_common_decrypt_multi(
+    const uint32_t data,
+    const uint64_t* keys,
+    size_t count,
+    uint32_t* result) {
+    furi_assert(count <= KEELOQ_MULTI_KEY_COUNT);
+
+    // Transpose: bit i of every key / state word goes into word i, one lane per key
+    uint32_t k[64] = {0};
+    for(size_t lane = 0; lane < count; lane++) {
+        for(size_t i = 0; i < 64; i++) {
+            k[i] |= (uint32_t)((keys[lane] >> i) & 1) << lane;
+        }
+    }
+
+    // State as a ring: logical bit i lives in x[(head + i) & 31], shift left moves head back
+    uint32_t x[32];
+    for(size_t i = 0; i < 32; i++) {
+        x[i] = ((data >> i) & 1) ? 0xFFFFFFFF : 0;
+    }
+    size_t head = 0;
+
+#define X(n) x[(head + (n)) & 31]
+    for(uint32_t r = 0; r < 528; r++) {
+        uint32_t next = X(31) ^ X(15) ^ k[(15 - r) & 63] ^
+                        subghz_protocol_keeloq_common_nlf_sliced(X(0), X(8), X(19), X(25), X(30));
+        head = (head - 1) & 31;
+        X(0) = next;
+    }
+#undef X
+
+    for(size_t lane = 0; lane < count; lane++) {
+        uint32_t value = 0;
+        for(size_t i = 0; i < 32; i++) {
+            value |= ((x[(head + i) & 31] >> lane) & 1) << i;
+        }
+        result[lane] = value;
+    }
+}
+
 /** Normal Learning
  * @param data - serial number (28bit)
  * @param key - manufacture (64bit)
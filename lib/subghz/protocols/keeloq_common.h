@@ -12,6 +12,9 @@
  */
 #define KEELOQ_NLF 0x3A5C742E
 
+/* Number of keys subghz_protocol_keeloq_common_decrypt_multi can take at once */
+#define KEELOQ_MULTI_KEY_COUNT 32
+
 /*
  * KeeLoq learning types
  * https://phreakerclub.com/forum/showthread.php?t=67
@@ -41,6 +44,20 @@ uint32_t subghz_protocol_keeloq_common_encrypt(const uint32_t data, const uint64
  */
 uint32_t subghz_protocol_keeloq_common_decrypt(const uint32_t data, const uint64_t key);
 
+/** 
+ * Simple Learning Decrypt of the same data with several keys, bitsliced
+ * Sliced key and state take 384 bytes of stack
+ * @param data - keeloq encrypt data
+ * @param keys - manufactures (64bit each)
+ * @param count - number of keys, up to KEELOQ_MULTI_KEY_COUNT
+ * @param result - decrypted data for every key, same as subghz_protocol_keeloq_common_decrypt
+ */
+void subghz_protocol_keeloq_common_decrypt_multi(
+    const uint32_t data,
+    const uint64_t* keys,
+    size_t count,
+    uint32_t* result);
+
 /** 
  * Normal Learning
  * @param data - serial number (28bit)
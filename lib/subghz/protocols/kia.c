@@ -38,12 +38,18 @@ typedef enum {
     KIADecoderStepCheckDuration,
 } KIADecoderStep;
 
+static SubGhzBlockEnvelope subghz_protocol_decoder_kia_get_envelope() {
+    return subghz_protocol_blocks_envelope(
+        subghz_protocol_kia_const.te_short, subghz_protocol_kia_const.te_delta);
+}
+
 const SubGhzProtocolDecoder subghz_protocol_kia_decoder = {
     .alloc = subghz_protocol_decoder_kia_alloc,
     .free = subghz_protocol_decoder_kia_free,
 
     .feed = subghz_protocol_decoder_kia_feed,
     .reset = subghz_protocol_decoder_kia_reset,
+    .get_envelope = subghz_protocol_decoder_kia_get_envelope,
 
     .get_hash_data = subghz_protocol_decoder_kia_get_hash_data,
     .serialize = subghz_protocol_decoder_kia_serialize,
@@ -42,12 +42,18 @@ typedef enum {
     LinearDecoderStepCheckDuration,
 } LinearDecoderStep;
 
+static SubGhzBlockEnvelope subghz_protocol_decoder_linear_get_envelope() {
+    return subghz_protocol_blocks_envelope(
+        subghz_protocol_linear_const.te_short * 42, subghz_protocol_linear_const.te_delta * 20);
+}
+
 const SubGhzProtocolDecoder subghz_protocol_linear_decoder = {
     .alloc = subghz_protocol_decoder_linear_alloc,
     .free = subghz_protocol_decoder_linear_free,
 
     .feed = subghz_protocol_decoder_linear_feed,
     .reset = subghz_protocol_decoder_linear_reset,
+    .get_envelope = subghz_protocol_decoder_linear_get_envelope,
 
     .get_hash_data = subghz_protocol_decoder_linear_get_hash_data,
     .serialize = subghz_protocol_decoder_linear_serialize,
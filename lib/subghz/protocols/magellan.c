@@ -38,12 +38,18 @@ typedef enum {
     MagellanDecoderStepCheckDuration,
 } MagellanDecoderStep;
 
+static SubGhzBlockEnvelope subghz_protocol_decoder_magellan_get_envelope() {
+    return subghz_protocol_blocks_envelope(
+        subghz_protocol_magellan_const.te_short, subghz_protocol_magellan_const.te_delta);
+}
+
 const SubGhzProtocolDecoder subghz_protocol_magellan_decoder = {
     .alloc = subghz_protocol_decoder_magellan_alloc,
     .free = subghz_protocol_decoder_magellan_free,
 
     .feed = subghz_protocol_decoder_magellan_feed,
     .reset = subghz_protocol_decoder_magellan_reset,
+    .get_envelope = subghz_protocol_decoder_magellan_get_envelope,
 
     .get_hash_data = subghz_protocol_decoder_magellan_get_hash_data,
     .serialize = subghz_protocol_decoder_magellan_serialize,
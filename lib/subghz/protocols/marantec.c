@@ -38,12 +38,18 @@ typedef enum {
     MarantecDecoderStepDecoderData,
 } MarantecDecoderStep;
 
+static SubGhzBlockEnvelope subghz_protocol_decoder_marantec_get_envelope() {
+    return subghz_protocol_blocks_envelope(
+        subghz_protocol_marantec_const.te_long * 5, subghz_protocol_marantec_const.te_delta * 8);
+}
+
 const SubGhzProtocolDecoder subghz_protocol_marantec_decoder = {
     .alloc = subghz_protocol_decoder_marantec_alloc,
     .free = subghz_protocol_decoder_marantec_free,
 
     .feed = subghz_protocol_decoder_marantec_feed,
     .reset = subghz_protocol_decoder_marantec_reset,
+    .get_envelope = subghz_protocol_decoder_marantec_get_envelope,
 
     .get_hash_data = subghz_protocol_decoder_marantec_get_hash_data,
     .serialize = subghz_protocol_decoder_marantec_serialize,
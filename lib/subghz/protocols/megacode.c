@@ -48,12 +48,19 @@ typedef enum {
     MegaCodeDecoderStepCheckDuration,
 } MegaCodeDecoderStep;
 
+static SubGhzBlockEnvelope subghz_protocol_decoder_megacode_get_envelope() {
+    return subghz_protocol_blocks_envelope(
+        subghz_protocol_megacode_const.te_short * 13,
+        subghz_protocol_megacode_const.te_delta * 17);
+}
+
 const SubGhzProtocolDecoder subghz_protocol_megacode_decoder = {
     .alloc = subghz_protocol_decoder_megacode_alloc,
     .free = subghz_protocol_decoder_megacode_free,
 
     .feed = subghz_protocol_decoder_megacode_feed,
     .reset = subghz_protocol_decoder_megacode_reset,
+    .get_envelope = subghz_protocol_decoder_megacode_get_envelope,
 
     .get_hash_data = subghz_protocol_decoder_megacode_get_hash_data,
     .serialize = subghz_protocol_decoder_megacode_serialize,
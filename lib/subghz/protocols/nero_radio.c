@@ -38,12 +38,18 @@ typedef enum {
     NeroRadioDecoderStepCheckDuration,
 } NeroRadioDecoderStep;
 
+static SubGhzBlockEnvelope subghz_protocol_decoder_nero_radio_get_envelope() {
+    return subghz_protocol_blocks_envelope(
+        subghz_protocol_nero_radio_const.te_short, subghz_protocol_nero_radio_const.te_delta);
+}
+
 const SubGhzProtocolDecoder subghz_protocol_nero_radio_decoder = {
     .alloc = subghz_protocol_decoder_nero_radio_alloc,
     .free = subghz_protocol_decoder_nero_radio_free,
 
     .feed = subghz_protocol_decoder_nero_radio_feed,
     .reset = subghz_protocol_decoder_nero_radio_reset,
+    .get_envelope = subghz_protocol_decoder_nero_radio_get_envelope,
 
     .get_hash_data = subghz_protocol_decoder_nero_radio_get_hash_data,
     .serialize = subghz_protocol_decoder_nero_radio_serialize,
@@ -37,12 +37,18 @@ typedef enum {
     NeroSketchDecoderStepCheckDuration,
 } NeroSketchDecoderStep;
 
+static SubGhzBlockEnvelope subghz_protocol_decoder_nero_sketch_get_envelope() {
+    return subghz_protocol_blocks_envelope(
+        subghz_protocol_nero_sketch_const.te_short, subghz_protocol_nero_sketch_const.te_delta);
+}
+
 const SubGhzProtocolDecoder subghz_protocol_nero_sketch_decoder = {
     .alloc = subghz_protocol_decoder_nero_sketch_alloc,
     .free = subghz_protocol_decoder_nero_sketch_free,
 
     .feed = subghz_protocol_decoder_nero_sketch_feed,
     .reset = subghz_protocol_decoder_nero_sketch_reset,
+    .get_envelope = subghz_protocol_decoder_nero_sketch_get_envelope,
 
     .get_hash_data = subghz_protocol_decoder_nero_sketch_get_hash_data,
     .serialize = subghz_protocol_decoder_nero_sketch_serialize,
@@ -35,12 +35,20 @@ typedef enum {
     NiceFloDecoderStepCheckDuration,
 } NiceFloDecoderStep;
 
+static SubGhzBlockEnvelope subghz_protocol_decoder_nice_flo_get_envelope() {
+    return subghz_protocol_blocks_envelope(
+        subghz_protocol_nice_flo_const.te_short * 36,
+        subghz_protocol_nice_flo_const.te_delta * 36);
+}
+
 const SubGhzProtocolDecoder subghz_protocol_nice_flo_decoder = {
     .alloc = subghz_protocol_decoder_nice_flo_alloc,
     .free = subghz_protocol_decoder_nice_flo_free,
 
     .feed = subghz_protocol_decoder_nice_flo_feed,
+    .feed_batch = subghz_protocol_decoder_nice_flo_feed_batch,
     .reset = subghz_protocol_decoder_nice_flo_reset,
+    .get_envelope = subghz_protocol_decoder_nice_flo_get_envelope,
 
     .get_hash_data = subghz_protocol_decoder_nice_flo_get_hash_data,
     .serialize = subghz_protocol_decoder_nice_flo_serialize,
@@ -201,14 +209,18 @@ void subghz_protocol_decoder_nice_flo_reset(void* context) {
     instance->decoder.parser_step = NiceFloDecoderStepReset;
 }
 
+static inline bool subghz_protocol_decoder_nice_flo_is_header(bool level, uint32_t duration) {
+    return (!level) && (DURATION_DIFF(duration, subghz_protocol_nice_flo_const.te_short * 36) <
+                        subghz_protocol_nice_flo_const.te_delta * 36);
+}
+
 void subghz_protocol_decoder_nice_flo_feed(void* context, bool level, uint32_t duration) {
     furi_assert(context);
     SubGhzProtocolDecoderNiceFlo* instance = context;
 
     switch(instance->decoder.parser_step) {
     case NiceFloDecoderStepReset:
-        if((!level) && (DURATION_DIFF(duration, subghz_protocol_nice_flo_const.te_short * 36) <
-                        subghz_protocol_nice_flo_const.te_delta * 36)) {
+        if(subghz_protocol_decoder_nice_flo_is_header(level, duration)) {
             //Found header Nice Flo
             instance->decoder.parser_step = NiceFloDecoderStepFoundStartBit;
         }
@@ -273,6 +285,25 @@ void subghz_protocol_decoder_nice_flo_feed(void* context, bool level, uint32_t d
     }
 }
 
+void subghz_protocol_decoder_nice_flo_feed_batch(
+    void* context,
+    const LevelDuration* level_duration,
+    size_t count) {
+    furi_assert(context);
+    SubGhzProtocolDecoderNiceFlo* instance = context;
+
+    for(size_t i = 0; i < count; i++) {
+        bool level = level_duration_get_level(level_duration[i]);
+        uint32_t duration = level_duration_get_duration(level_duration[i]);
+        // Idle until the Nice Flo header, skip everything else in a tight loop
+        if((instance->decoder.parser_step == NiceFloDecoderStepReset) &&
+           !subghz_protocol_decoder_nice_flo_is_header(level, duration)) {
+            continue;
+        }
+        subghz_protocol_decoder_nice_flo_feed(instance, level, duration);
+    }
+}
+
 uint8_t subghz_protocol_decoder_nice_flo_get_hash_data(void* context) {
     furi_assert(context);
     SubGhzProtocolDecoderNiceFlo* instance = context;
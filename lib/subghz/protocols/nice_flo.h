@@ -72,6 +72,17 @@ void subghz_protocol_decoder_nice_flo_reset(void* context);
  */
 void subghz_protocol_decoder_nice_flo_feed(void* context, bool level, uint32_t duration);
 
+/**
+ * Parse a block of levels and durations received from the air.
+ * @param context Pointer to a SubGhzProtocolDecoderNiceFlo instance
+ * @param level_duration Pulses, in order of reception
+ * @param count Number of pulses
+ */
+void subghz_protocol_decoder_nice_flo_feed_batch(
+    void* context,
+    const LevelDuration* level_duration,
+    size_t count);
+
 /**
  * Getting the hash sum of the last randomly received parcel.
  * @param context Pointer to a SubGhzProtocolDecoderNiceFlo instance
@@ -45,12 +45,19 @@ typedef enum {
     NiceFlorSDecoderStepCheckDuration,
 } NiceFlorSDecoderStep;
 
+static SubGhzBlockEnvelope subghz_protocol_decoder_nice_flor_s_get_envelope() {
+    return subghz_protocol_blocks_envelope(
+        subghz_protocol_nice_flor_s_const.te_short * 38,
+        subghz_protocol_nice_flor_s_const.te_delta * 38);
+}
+
 const SubGhzProtocolDecoder subghz_protocol_nice_flor_s_decoder = {
     .alloc = subghz_protocol_decoder_nice_flor_s_alloc,
     .free = subghz_protocol_decoder_nice_flor_s_free,
 
     .feed = subghz_protocol_decoder_nice_flor_s_feed,
     .reset = subghz_protocol_decoder_nice_flor_s_reset,
+    .get_envelope = subghz_protocol_decoder_nice_flor_s_get_envelope,
 
     .get_hash_data = subghz_protocol_decoder_nice_flor_s_get_hash_data,
     .serialize = subghz_protocol_decoder_nice_flor_s_serialize,
@@ -38,12 +38,19 @@ typedef enum {
     Phoenix_V2DecoderStepCheckDuration,
 } Phoenix_V2DecoderStep;
 
+static SubGhzBlockEnvelope subghz_protocol_decoder_phoenix_v2_get_envelope() {
+    return subghz_protocol_blocks_envelope(
+        subghz_protocol_phoenix_v2_const.te_short * 60,
+        subghz_protocol_phoenix_v2_const.te_delta * 30);
+}
+
 const SubGhzProtocolDecoder subghz_protocol_phoenix_v2_decoder = {
     .alloc = subghz_protocol_decoder_phoenix_v2_alloc,
     .free = subghz_protocol_decoder_phoenix_v2_free,
 
     .feed = subghz_protocol_decoder_phoenix_v2_feed,
     .reset = subghz_protocol_decoder_phoenix_v2_reset,
+    .get_envelope = subghz_protocol_decoder_phoenix_v2_get_envelope,
 
     .get_hash_data = subghz_protocol_decoder_phoenix_v2_get_hash_data,
     .serialize = subghz_protocol_decoder_phoenix_v2_serialize,
@@ -46,12 +46,20 @@ typedef enum {
     PrincetonDecoderStepCheckDuration,
 } PrincetonDecoderStep;
 
+static SubGhzBlockEnvelope subghz_protocol_decoder_princeton_get_envelope() {
+    return subghz_protocol_blocks_envelope(
+        subghz_protocol_princeton_const.te_short * 36,
+        subghz_protocol_princeton_const.te_delta * 36);
+}
+
 const SubGhzProtocolDecoder subghz_protocol_princeton_decoder = {
     .alloc = subghz_protocol_decoder_princeton_alloc,
     .free = subghz_protocol_decoder_princeton_free,
 
     .feed = subghz_protocol_decoder_princeton_feed,
+    .feed_batch = subghz_protocol_decoder_princeton_feed_batch,
     .reset = subghz_protocol_decoder_princeton_reset,
+    .get_envelope = subghz_protocol_decoder_princeton_get_envelope,
 
     .get_hash_data = subghz_protocol_decoder_princeton_get_hash_data,
     .serialize = subghz_protocol_decoder_princeton_serialize,
@@ -220,14 +228,18 @@ void subghz_protocol_decoder_princeton_reset(void* context) {
     instance->last_data = 0;
 }
 
+static inline bool subghz_protocol_decoder_princeton_is_header(bool level, uint32_t duration) {
+    return (!level) && (DURATION_DIFF(duration, subghz_protocol_princeton_const.te_short * 36) <
+                        subghz_protocol_princeton_const.te_delta * 36);
+}
+
 void subghz_protocol_decoder_princeton_feed(void* context, bool level, uint32_t duration) {
     furi_assert(context);
     SubGhzProtocolDecoderPrinceton* instance = context;
 
     switch(instance->decoder.parser_step) {
     case PrincetonDecoderStepReset:
-        if((!level) && (DURATION_DIFF(duration, subghz_protocol_princeton_const.te_short * 36) <
-                        subghz_protocol_princeton_const.te_delta * 36)) {
+        if(subghz_protocol_decoder_princeton_is_header(level, duration)) {
             //Found Preambula
             instance->decoder.parser_step = PrincetonDecoderStepSaveDuration;
             instance->decoder.decode_data = 0;
@@ -292,6 +304,25 @@ void subghz_protocol_decoder_princeton_feed(void* context, bool level, uint32_t
     }
 }
 
+void subghz_protocol_decoder_princeton_feed_batch(
+    void* context,
+    const LevelDuration* level_duration,
+    size_t count) {
+    furi_assert(context);
+    SubGhzProtocolDecoderPrinceton* instance = context;
+
+    for(size_t i = 0; i < count; i++) {
+        bool level = level_duration_get_level(level_duration[i]);
+        uint32_t duration = level_duration_get_duration(level_duration[i]);
+        // Waiting for the preamble is the common case, test it outside of the state machine
+        if((instance->decoder.parser_step == PrincetonDecoderStepReset) &&
+           !subghz_protocol_decoder_princeton_is_header(level, duration)) {
+            continue;
+        }
+        subghz_protocol_decoder_princeton_feed(instance, level, duration);
+    }
+}
+
 /** 
  * Analysis of received data
  * @param instance Pointer to a SubGhzBlockGeneric* instance
@@ -44,12 +44,18 @@ typedef enum {
     ScherKhanDecoderStepCheckDuration,
 } ScherKhanDecoderStep;
 
+static SubGhzBlockEnvelope subghz_protocol_decoder_scher_khan_get_envelope() {
+    return subghz_protocol_blocks_envelope(
+        subghz_protocol_scher_khan_const.te_short * 2, subghz_protocol_scher_khan_const.te_delta);
+}
+
 const SubGhzProtocolDecoder subghz_protocol_scher_khan_decoder = {
     .alloc = subghz_protocol_decoder_scher_khan_alloc,
     .free = subghz_protocol_decoder_scher_khan_free,
 
     .feed = subghz_protocol_decoder_scher_khan_feed,
     .reset = subghz_protocol_decoder_scher_khan_reset,
+    .get_envelope = subghz_protocol_decoder_scher_khan_get_envelope,
 
     .get_hash_data = subghz_protocol_decoder_scher_khan_get_hash_data,
     .serialize = subghz_protocol_decoder_scher_khan_serialize,
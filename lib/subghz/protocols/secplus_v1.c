@@ -59,12 +59,19 @@ typedef enum {
     SecPlus_v1DecoderStepDecoderData,
 } SecPlus_v1DecoderStep;
 
+static SubGhzBlockEnvelope subghz_protocol_decoder_secplus_v1_get_envelope() {
+    return subghz_protocol_blocks_envelope(
+        subghz_protocol_secplus_v1_const.te_short * 120,
+        subghz_protocol_secplus_v1_const.te_delta * 120);
+}
+
 const SubGhzProtocolDecoder subghz_protocol_secplus_v1_decoder = {
     .alloc = subghz_protocol_decoder_secplus_v1_alloc,
     .free = subghz_protocol_decoder_secplus_v1_free,
 
     .feed = subghz_protocol_decoder_secplus_v1_feed,
     .reset = subghz_protocol_decoder_secplus_v1_reset,
+    .get_envelope = subghz_protocol_decoder_secplus_v1_get_envelope,
 
     .get_hash_data = subghz_protocol_decoder_secplus_v1_get_hash_data,
     .serialize = subghz_protocol_decoder_secplus_v1_serialize,
@@ -51,12 +51,19 @@ typedef enum {
     SecPlus_v2DecoderStepDecoderData,
 } SecPlus_v2DecoderStep;
 
+static SubGhzBlockEnvelope subghz_protocol_decoder_secplus_v2_get_envelope() {
+    return subghz_protocol_blocks_envelope(
+        subghz_protocol_secplus_v2_const.te_long * 130,
+        subghz_protocol_secplus_v2_const.te_delta * 100);
+}
+
 const SubGhzProtocolDecoder subghz_protocol_secplus_v2_decoder = {
     .alloc = subghz_protocol_decoder_secplus_v2_alloc,
     .free = subghz_protocol_decoder_secplus_v2_free,
 
     .feed = subghz_protocol_decoder_secplus_v2_feed,
     .reset = subghz_protocol_decoder_secplus_v2_reset,
+    .get_envelope = subghz_protocol_decoder_secplus_v2_get_envelope,
 
     .get_hash_data = subghz_protocol_decoder_secplus_v2_get_hash_data,
     .serialize = subghz_protocol_decoder_secplus_v2_serialize,
@@ -61,12 +61,18 @@ typedef enum {
     SMC5326DecoderStepCheckDuration,
 } SMC5326DecoderStep;
 
+static SubGhzBlockEnvelope subghz_protocol_decoder_smc5326_get_envelope() {
+    return subghz_protocol_blocks_envelope(
+        subghz_protocol_smc5326_const.te_short * 24, subghz_protocol_smc5326_const.te_delta * 12);
+}
+
 const SubGhzProtocolDecoder subghz_protocol_smc5326_decoder = {
     .alloc = subghz_protocol_decoder_smc5326_alloc,
     .free = subghz_protocol_decoder_smc5326_free,
 
     .feed = subghz_protocol_decoder_smc5326_feed,
     .reset = subghz_protocol_decoder_smc5326_reset,
+    .get_envelope = subghz_protocol_decoder_smc5326_get_envelope,
 
     .get_hash_data = subghz_protocol_decoder_smc5326_get_hash_data,
     .serialize = subghz_protocol_decoder_smc5326_serialize,
@@ -42,12 +42,19 @@ typedef enum {
     SomfyKeytisDecoderStepDecoderData,
 } SomfyKeytisDecoderStep;
 
+static SubGhzBlockEnvelope subghz_protocol_decoder_somfy_keytis_get_envelope() {
+    return subghz_protocol_blocks_envelope(
+        subghz_protocol_somfy_keytis_const.te_short * 4,
+        subghz_protocol_somfy_keytis_const.te_delta * 4);
+}
+
 const SubGhzProtocolDecoder subghz_protocol_somfy_keytis_decoder = {
     .alloc = subghz_protocol_decoder_somfy_keytis_alloc,
     .free = subghz_protocol_decoder_somfy_keytis_free,
 
     .feed = subghz_protocol_decoder_somfy_keytis_feed,
     .reset = subghz_protocol_decoder_somfy_keytis_reset,
+    .get_envelope = subghz_protocol_decoder_somfy_keytis_get_envelope,
 
     .get_hash_data = subghz_protocol_decoder_somfy_keytis_get_hash_data,
     .serialize = subghz_protocol_decoder_somfy_keytis_serialize,
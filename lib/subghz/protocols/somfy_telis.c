@@ -41,12 +41,19 @@ typedef enum {
     SomfyTelisDecoderStepDecoderData,
 } SomfyTelisDecoderStep;
 
+static SubGhzBlockEnvelope subghz_protocol_decoder_somfy_telis_get_envelope() {
+    return subghz_protocol_blocks_envelope(
+        subghz_protocol_somfy_telis_const.te_short * 4,
+        subghz_protocol_somfy_telis_const.te_delta * 4);
+}
+
 const SubGhzProtocolDecoder subghz_protocol_somfy_telis_decoder = {
     .alloc = subghz_protocol_decoder_somfy_telis_alloc,
     .free = subghz_protocol_decoder_somfy_telis_free,
 
     .feed = subghz_protocol_decoder_somfy_telis_feed,
     .reset = subghz_protocol_decoder_somfy_telis_reset,
+    .get_envelope = subghz_protocol_decoder_somfy_telis_get_envelope,
 
     .get_hash_data = subghz_protocol_decoder_somfy_telis_get_hash_data,
     .serialize = subghz_protocol_decoder_somfy_telis_serialize,
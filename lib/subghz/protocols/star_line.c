@@ -49,6 +49,7 @@ const SubGhzProtocolDecoder subghz_protocol_star_line_decoder = {
     .free = subghz_protocol_decoder_star_line_free,
 
     .feed = subghz_protocol_decoder_star_line_feed,
+    .feed_batch = subghz_protocol_decoder_star_line_feed_batch,
     .reset = subghz_protocol_decoder_star_line_reset,
 
     .get_hash_data = subghz_protocol_decoder_star_line_get_hash_data,
@@ -180,6 +181,32 @@ void subghz_protocol_decoder_star_line_feed(void* context, bool level, uint32_t
     }
 }
 
+void subghz_protocol_decoder_star_line_feed_batch(
+    void* context,
+    const LevelDuration* level_duration,
+    size_t count) {
+    furi_assert(context);
+    SubGhzProtocolDecoderStarLine* instance = context;
+
+    for(size_t i = 0; i < count; i++) {
+        bool level = level_duration_get_level(level_duration[i]);
+        uint32_t duration = level_duration_get_duration(level_duration[i]);
+        // In reset step only header pulses and the pulse right after the preamble do anything
+        if(instance->decoder.parser_step == StarLineDecoderStepReset) {
+            if(!level) {
+                instance->header_count = 0;
+                continue;
+            }
+            if((instance->header_count <= 4) &&
+               (DURATION_DIFF(duration, subghz_protocol_star_line_const.te_long * 2) >=
+                subghz_protocol_star_line_const.te_delta * 2)) {
+                continue;
+            }
+        }
+        subghz_protocol_decoder_star_line_feed(instance, level, duration);
+    }
+}
+
 /**
  * Validation of decrypt data.
  * @param instance Pointer to a SubGhzBlockGeneric instance
@@ -228,7 +255,7 @@ static uint8_t subghz_protocol_star_line_check_remote_controller_selector(
                 //Simple Learning
                 decrypt = subghz_protocol_keeloq_common_decrypt(hop, manufacture_code->key);
                 if(subghz_protocol_star_line_check_decrypt(instance, decrypt, btn, end_serial)) {
-                    *manufacture_name = furi_string_get_cstr(manufacture_code->name);
+                    *manufacture_name = manufacture_code->name;
                     return 1;
                 }
                 break;
@@ -239,7 +266,7 @@ static uint8_t subghz_protocol_star_line_check_remote_controller_selector(
                     subghz_protocol_keeloq_common_normal_learning(fix, manufacture_code->key);
                 decrypt = subghz_protocol_keeloq_common_decrypt(hop, man_normal_learning);
                 if(subghz_protocol_star_line_check_decrypt(instance, decrypt, btn, end_serial)) {
-                    *manufacture_name = furi_string_get_cstr(manufacture_code->name);
+                    *manufacture_name = manufacture_code->name;
                     return 1;
                 }
                 break;
@@ -247,7 +274,7 @@ static uint8_t subghz_protocol_star_line_check_remote_controller_selector(
                 // Simple Learning
                 decrypt = subghz_protocol_keeloq_common_decrypt(hop, manufacture_code->key);
                 if(subghz_protocol_star_line_check_decrypt(instance, decrypt, btn, end_serial)) {
-                    *manufacture_name = furi_string_get_cstr(manufacture_code->name);
+                    *manufacture_name = manufacture_code->name;
                     return 1;
                 }
                 // Check for mirrored man
@@ -259,7 +286,7 @@ static uint8_t subghz_protocol_star_line_check_remote_controller_selector(
                 }
                 decrypt = subghz_protocol_keeloq_common_decrypt(hop, man_rev);
                 if(subghz_protocol_star_line_check_decrypt(instance, decrypt, btn, end_serial)) {
-                    *manufacture_name = furi_string_get_cstr(manufacture_code->name);
+                    *manufacture_name = manufacture_code->name;
                     return 1;
                 }
                 //###########################
@@ -269,13 +296,13 @@ static uint8_t subghz_protocol_star_line_check_remote_controller_selector(
                     subghz_protocol_keeloq_common_normal_learning(fix, manufacture_code->key);
                 decrypt = subghz_protocol_keeloq_common_decrypt(hop, man_normal_learning);
                 if(subghz_protocol_star_line_check_decrypt(instance, decrypt, btn, end_serial)) {
-                    *manufacture_name = furi_string_get_cstr(manufacture_code->name);
+                    *manufacture_name = manufacture_code->name;
                     return 1;
                 }
                 man_normal_learning = subghz_protocol_keeloq_common_normal_learning(fix, man_rev);
                 decrypt = subghz_protocol_keeloq_common_decrypt(hop, man_normal_learning);
                 if(subghz_protocol_star_line_check_decrypt(instance, decrypt, btn, end_serial)) {
-                    *manufacture_name = furi_string_get_cstr(manufacture_code->name);
+                    *manufacture_name = manufacture_code->name;
                     return 1;
                 }
                 break;
@@ -2,11 +2,25 @@
 
 #include "registry.h"
 #include "protocols/protocol_items.h"
+#include "blocks/decoder.h"
 
 #include <m-array.h>
 
+// Dispatch index resolution: 256us buckets, the last one takes everything above ~32ms
+#define SUBGHZ_RECEIVER_BUCKET_SHIFT 8
+#define SUBGHZ_RECEIVER_BUCKET_COUNT 128
+#define SUBGHZ_RECEIVER_MASK_BITS 32
+
+// Layout of decoders that declare an envelope, see SubGhzProtocolDecoder.get_envelope
+typedef struct {
+    SubGhzProtocolDecoderBase base;
+    SubGhzBlockDecoder decoder;
+} SubGhzReceiverBlockDecoder;
+
 typedef struct {
     SubGhzProtocolEncoderBase* base;
+    // NULL if decoder must be fed with every pulse
+    const uint32_t* parser_step;
 } SubGhzReceiverSlot;
 
 ARRAY_DEF(SubGhzReceiverSlotArray, SubGhzReceiverSlot, M_POD_OPLIST);
@@ -16,10 +30,54 @@ struct SubGhzReceiver {
     SubGhzReceiverSlotArray_t slots;
     SubGhzProtocolFlag filter;
 
+    // Bitmask of slots to wake up for each duration bucket
+    uint32_t* dispatch_index;
+    size_t dispatch_mask_size;
+
+    // Decoder being fed by subghz_receiver_decode_batch, NULL outside of it
+    SubGhzReceiverSlot* batch_slot;
+
     SubGhzReceiverCallback callback;
     void* context;
 };
 
+static inline size_t subghz_receiver_get_bucket(uint32_t duration) {
+    size_t bucket = duration >> SUBGHZ_RECEIVER_BUCKET_SHIFT;
+    return (bucket < SUBGHZ_RECEIVER_BUCKET_COUNT) ? bucket : SUBGHZ_RECEIVER_BUCKET_COUNT - 1;
+}
+
+static inline bool subghz_receiver_mask_test(const uint32_t* mask, size_t index) {
+    return mask[index / SUBGHZ_RECEIVER_MASK_BITS] & (1UL << (index % SUBGHZ_RECEIVER_MASK_BITS));
+}
+
+static void subghz_receiver_build_dispatch_index(SubGhzReceiver* instance) {
+    size_t slots_count = SubGhzReceiverSlotArray_size(instance->slots);
+    instance->dispatch_mask_size =
+        (slots_count + SUBGHZ_RECEIVER_MASK_BITS - 1) / SUBGHZ_RECEIVER_MASK_BITS;
+    instance->dispatch_index = malloc(
+        SUBGHZ_RECEIVER_BUCKET_COUNT * instance->dispatch_mask_size * sizeof(uint32_t));
+
+    for(size_t i = 0; i < slots_count; i++) {
+        SubGhzReceiverSlot* slot = SubGhzReceiverSlotArray_get(instance->slots, i);
+        const SubGhzProtocolDecoder* decoder = slot->base->protocol->decoder;
+
+        size_t bucket_first = 0;
+        size_t bucket_last = SUBGHZ_RECEIVER_BUCKET_COUNT - 1;
+        slot->parser_step = NULL;
+        if(decoder->get_envelope) {
+            SubGhzBlockEnvelope envelope = decoder->get_envelope();
+            bucket_first = subghz_receiver_get_bucket(envelope.duration_min);
+            bucket_last = subghz_receiver_get_bucket(envelope.duration_max);
+            slot->parser_step = &((SubGhzReceiverBlockDecoder*)slot->base)->decoder.parser_step;
+        }
+
+        for(size_t bucket = bucket_first; bucket <= bucket_last; bucket++) {
+            uint32_t* mask = &instance->dispatch_index[bucket * instance->dispatch_mask_size];
+            mask[i / SUBGHZ_RECEIVER_MASK_BITS] |= 1UL << (i % SUBGHZ_RECEIVER_MASK_BITS);
+        }
+    }
+}
+
 SubGhzReceiver* subghz_receiver_alloc_init(SubGhzEnvironment* environment) {
     SubGhzReceiver* instance = malloc(sizeof(SubGhzReceiver));
     SubGhzReceiverSlotArray_init(instance->slots);
@@ -35,7 +93,9 @@ SubGhzReceiver* subghz_receiver_alloc_init(SubGhzEnvironment* environment) {
             slot->base = protocol->decoder->alloc(environment);
         }
     }
+    subghz_receiver_build_dispatch_index(instance);
 
+    instance->batch_slot = NULL;
     instance->callback = NULL;
     instance->context = NULL;
     return instance;
@@ -54,6 +114,7 @@ void subghz_receiver_free(SubGhzReceiver* instance) {
             slot->base = NULL;
         }
     SubGhzReceiverSlotArray_clear(instance->slots);
+    free(instance->dispatch_index);
 
     free(instance);
 }
@@ -62,18 +123,69 @@ void subghz_receiver_decode(SubGhzReceiver* instance, bool level, uint32_t durat
     furi_assert(instance);
     furi_assert(instance->slots);
 
-    for
-        M_EACH(slot, instance->slots, SubGhzReceiverSlotArray_t) {
-            if((slot->base->protocol->flag & instance->filter) == instance->filter) {
-                slot->base->protocol->decoder->feed(slot->base, level, duration);
+    size_t bucket = subghz_receiver_get_bucket(duration);
+    const uint32_t* wakeup_mask = &instance->dispatch_index[bucket * instance->dispatch_mask_size];
+    size_t slots_count = SubGhzReceiverSlotArray_size(instance->slots);
+
+    for(size_t i = 0; i < slots_count; i++) {
+        SubGhzReceiverSlot* slot = SubGhzReceiverSlotArray_get(instance->slots, i);
+        if((slot->base->protocol->flag & instance->filter) != instance->filter) continue;
+
+        // Idle decoder ignores pulses outside of its envelope, don't call it at all
+        if(slot->parser_step && *slot->parser_step == 0 &&
+           !subghz_receiver_mask_test(wakeup_mask, i)) {
+            continue;
+        }
+
+        slot->base->protocol->decoder->feed(slot->base, level, duration);
+    }
+}
+
+void subghz_receiver_decode_batch(
+    SubGhzReceiver* instance,
+    const LevelDuration* level_duration,
+    size_t count) {
+    furi_assert(instance);
+    furi_assert(instance->slots);
+
+    size_t slots_count = SubGhzReceiverSlotArray_size(instance->slots);
+
+    for(size_t i = 0; i < slots_count; i++) {
+        SubGhzReceiverSlot* slot = SubGhzReceiverSlotArray_get(instance->slots, i);
+        if((slot->base->protocol->flag & instance->filter) != instance->filter) continue;
+
+        // Idle decoder ignores pulses outside of its envelope, start from the first one inside
+        size_t first = 0;
+        if(slot->parser_step && *slot->parser_step == 0) {
+            while(first < count) {
+                size_t bucket =
+                    subghz_receiver_get_bucket(level_duration_get_duration(level_duration[first]));
+                const uint32_t* wakeup_mask =
+                    &instance->dispatch_index[bucket * instance->dispatch_mask_size];
+                if(subghz_receiver_mask_test(wakeup_mask, i)) break;
+                first++;
             }
         }
+
+        if(first < count) {
+            instance->batch_slot = slot;
+            subghz_protocol_decoder_base_feed_batch(
+                (SubGhzProtocolDecoderBase*)slot->base, &level_duration[first], count - first);
+            instance->batch_slot = NULL;
+        }
+    }
 }
 
 void subghz_receiver_reset(SubGhzReceiver* instance) {
     furi_assert(instance);
     furi_assert(instance->slots);
 
+    // Other decoders are at different pulses of the block, leave them alone
+    if(instance->batch_slot) {
+        instance->batch_slot->base->protocol->decoder->reset(instance->batch_slot->base);
+        return;
+    }
+
     for
         M_EACH(slot, instance->slots, SubGhzReceiverSlotArray_t) {
             slot->base->protocol->decoder->reset(slot->base);
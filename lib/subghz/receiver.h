@@ -35,8 +35,25 @@ void subghz_receiver_free(SubGhzReceiver* instance);
  */
 void subghz_receiver_decode(SubGhzReceiver* instance, bool level, uint32_t duration);
 
+/**
+ * Parse a block of levels and durations received from the air.
+ * Each decoder consumes the whole block before the next one starts, so
+ * subghz_receiver_reset called from the rx callback only resets the decoder
+ * that reported: decoding results do not depend on how pulses are split into
+ * blocks.
+ * @param instance Pointer to a SubGhzReceiver instance
+ * @param level_duration Pulses, in order of reception
+ * @param count Number of pulses
+ */
+void subghz_receiver_decode_batch(
+    SubGhzReceiver* instance,
+    const LevelDuration* level_duration,
+    size_t count);
+
 /**
  * Reset decoder SubGhzReceiver.
+ * Resets only the reporting decoder when called from the rx callback during
+ * subghz_receiver_decode_batch.
  * @param instance Pointer to a SubGhzReceiver instance
  */
 void subghz_receiver_reset(SubGhzReceiver* instance);
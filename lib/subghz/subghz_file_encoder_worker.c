@@ -1,12 +1,11 @@
 #include "subghz_file_encoder_worker.h"
 
-#include <toolbox/stream/stream.h>
 #include <flipper_format/flipper_format.h>
-#include <flipper_format/flipper_format_i.h>
 
 #define TAG "SubGhzFileEncoderWorker"
 
-#define SUBGHZ_FILE_ENCODER_LOAD 512
+// Durations are read from the file in chunks of this size
+#define SUBGHZ_FILE_ENCODER_LOAD 64
 
 struct SubGhzFileEncoderWorker {
     FuriThread* thread;
@@ -21,6 +20,7 @@ struct SubGhzFileEncoderWorker {
     bool is_storage_slow;
     FuriString* str_data;
     FuriString* file_path;
+    int32_t data[SUBGHZ_FILE_ENCODER_LOAD];
 
     SubGhzFileEncoderWorkerCallbackEnd callback_end;
     void* context_end;
@@ -54,31 +54,6 @@ void subghz_file_encoder_worker_add_level_duration(
     }
 }
 
-bool subghz_file_encoder_worker_data_parse(SubGhzFileEncoderWorker* instance, const char* strStart) {
-    char* str1;
-    bool res = false;
-    // Line sample: "RAW_Data: -1, 2, -2..."
-
-    // Look for a key in the line
-    str1 = strstr(strStart, "RAW_Data: ");
-
-    if(str1 != NULL) {
-        // Skip key
-        str1 = strchr(str1, ' ');
-
-        // Check that there is still an element in the line
-        while(strchr(str1, ' ') != NULL) {
-            str1 = strchr(str1, ' ');
-
-            // Skip space
-            str1 += 1;
-            subghz_file_encoder_worker_add_level_duration(instance, atoi(str1));
-        }
-        res = true;
-    }
-    return res;
-}
-
 LevelDuration subghz_file_encoder_worker_get_level_duration(void* context) {
     furi_assert(context);
     SubGhzFileEncoderWorker* instance = context;
@@ -112,9 +87,8 @@ static int32_t subghz_file_encoder_worker_thread(void* context) {
     FURI_LOG_I(TAG, "Worker start");
     bool res = false;
     instance->is_storage_slow = false;
-    Stream* stream = flipper_format_get_raw_stream(instance->flipper_format);
     do {
-        if(!flipper_format_file_open_existing(
+        if(!flipper_format_buffered_file_open_existing(
                instance->flipper_format, furi_string_get_cstr(instance->file_path))) {
             FURI_LOG_E(
                 TAG,
@@ -127,8 +101,6 @@ static int32_t subghz_file_encoder_worker_thread(void* context) {
             break;
         }
 
-        //skip the end of the previous line "\n"
-        stream_seek(stream, 1, StreamOffsetFromCurrent);
         res = true;
         instance->worker_stoping = false;
         FURI_LOG_I(TAG, "Start transmission");
@@ -137,16 +109,29 @@ static int32_t subghz_file_encoder_worker_thread(void* context) {
     while(res && instance->worker_running) {
         size_t stream_free_byte = furi_stream_buffer_spaces_available(instance->stream);
         if((stream_free_byte / sizeof(int32_t)) >= SUBGHZ_FILE_ENCODER_LOAD) {
-            if(stream_read_line(stream, instance->str_data)) {
-                furi_string_trim(instance->str_data);
-                if(!subghz_file_encoder_worker_data_parse(
-                       instance, furi_string_get_cstr(instance->str_data))) {
+            // Line sample: "RAW_Data: 500 -1000 500 -1000..."
+            // Long lines are streamed in chunks, without reading the whole line
+            uint16_t data_read = 0;
+            if(!flipper_format_read_array_int32(
+                   instance->flipper_format,
+                   instance->data,
+                   SUBGHZ_FILE_ENCODER_LOAD,
+                   &data_read)) {
+                FURI_LOG_E(TAG, "Invalid RAW_Data");
+                subghz_file_encoder_worker_add_level_duration(instance, LEVEL_DURATION_RESET);
+                break;
+            }
+
+            if(data_read == 0) {
+                // Current line is over, move to the next one
+                if(!flipper_format_read_array_begin(instance->flipper_format, "RAW_Data")) {
                     subghz_file_encoder_worker_add_level_duration(instance, LEVEL_DURATION_RESET);
                     break;
                 }
-            } else {
-                subghz_file_encoder_worker_add_level_duration(instance, LEVEL_DURATION_RESET);
-                break;
+            }
+
+            for(uint16_t i = 0; i < data_read; i++) {
+                subghz_file_encoder_worker_add_level_duration(instance, instance->data[i]);
             }
         } else {
             furi_delay_ms(1);
@@ -167,7 +152,7 @@ static int32_t subghz_file_encoder_worker_thread(void* context) {
         }
         furi_delay_ms(50);
     }
-    flipper_format_file_close(instance->flipper_format);
+    flipper_format_buffered_file_close(instance->flipper_format);
 
     FURI_LOG_I(TAG, "Worker stop");
     return 0;
@@ -181,7 +166,7 @@ SubGhzFileEncoderWorker* subghz_file_encoder_worker_alloc() {
     instance->stream = furi_stream_buffer_alloc(sizeof(int32_t) * 2048, sizeof(int32_t));
 
     instance->storage = furi_record_open(RECORD_STORAGE);
-    instance->flipper_format = flipper_format_file_alloc(instance->storage);
+    instance->flipper_format = flipper_format_buffered_file_alloc(instance->storage);
 
     instance->str_data = furi_string_alloc();
     instance->file_path = furi_string_alloc();
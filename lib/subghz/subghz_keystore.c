@@ -15,25 +15,63 @@
 
 #define SUBGHZ_KEYSTORE_FILE_TYPE "Flipper SubGhz Keystore File"
 #define SUBGHZ_KEYSTORE_FILE_RAW_TYPE "Flipper SubGhz Keystore RAW File"
+#define SUBGHZ_KEYSTORE_FILE_BINARY_TYPE "Flipper SubGhz Keystore Binary File"
 #define SUBGHZ_KEYSTORE_FILE_VERSION 0
 
 #define SUBGHZ_KEYSTORE_FILE_ENCRYPTION_KEY_SLOT 1
 #define SUBGHZ_KEYSTORE_FILE_DECRYPTED_LINE_SIZE 512
 #define SUBGHZ_KEYSTORE_FILE_ENCRYPTED_LINE_SIZE (SUBGHZ_KEYSTORE_FILE_DECRYPTED_LINE_SIZE * 2)
 
+#define SUBGHZ_KEYSTORE_NAME_POOL_BLOCK_SIZE 512
+// Same limit as text keystore line parser, with terminator
+#define SUBGHZ_KEYSTORE_NAME_SIZE 65
+
+/*
+ * Binary keystore payload, AES256-CBC encrypted as a whole, follows Encrypt_data line:
+ * - Key_count SubGhzKeystoreRecord, in keystore order
+ * - Key_count uint32_t record numbers, sorted by key, padded to the AES block
+ * - Pool_size bytes of zero terminated names
+ * Any block can be decrypted alone, using the previous ciphertext block as IV.
+ */
+#define SUBGHZ_KEYSTORE_BINARY_BLOCK_SIZE 16
+#define SUBGHZ_KEYSTORE_BINARY_BUFFER_SIZE 128
+#define SUBGHZ_KEYSTORE_BINARY_ALIGN(x) \
+    (((x) + SUBGHZ_KEYSTORE_BINARY_BLOCK_SIZE - 1) & ~(SUBGHZ_KEYSTORE_BINARY_BLOCK_SIZE - 1))
+
 typedef enum {
     SubGhzKeystoreEncryptionNone,
     SubGhzKeystoreEncryptionAES256,
 } SubGhzKeystoreEncryption;
 
+ARRAY_DEF(SubGhzKeystoreNamePool, char*, M_PTR_OPLIST)
+
 struct SubGhzKeystore {
     SubGhzKeyArray_t data;
+
+    // Names are stored once, in a few big blocks instead of a string per key
+    SubGhzKeystoreNamePool_t name_pool;
+    size_t name_pool_block_size;
+    size_t name_pool_used;
+};
+
+struct SubGhzKeystoreBinary {
+    Storage* storage;
+    FlipperFormat* flipper_format;
+    Stream* stream;
+
+    uint8_t iv[16];
+    size_t data_offset;
+    uint32_t key_count;
+    uint32_t pool_size;
 };
 
 SubGhzKeystore* subghz_keystore_alloc() {
     SubGhzKeystore* instance = malloc(sizeof(SubGhzKeystore));
 
     SubGhzKeyArray_init(instance->data);
+    SubGhzKeystoreNamePool_init(instance->name_pool);
+    instance->name_pool_block_size = 0;
+    instance->name_pool_used = 0;
 
     return instance;
 }
@@ -43,21 +81,51 @@ void subghz_keystore_free(SubGhzKeystore* instance) {
 
     for
         M_EACH(manufacture_code, instance->data, SubGhzKeyArray_t) {
-            furi_string_free(manufacture_code->name);
+            manufacture_code->name = NULL;
             manufacture_code->key = 0;
         }
     SubGhzKeyArray_clear(instance->data);
 
+    for
+        M_EACH(block, instance->name_pool, SubGhzKeystoreNamePool_t) {
+            free(*block);
+        }
+    SubGhzKeystoreNamePool_clear(instance->name_pool);
+
     free(instance);
 }
 
+static const char* subghz_keystore_add_name(SubGhzKeystore* instance, const char* name) {
+    // Keys of the same manufacture usually go one after another
+    size_t keys_count = SubGhzKeyArray_size(instance->data);
+    if(keys_count) {
+        const char* last_name = SubGhzKeyArray_get(instance->data, keys_count - 1)->name;
+        if(strcmp(last_name, name) == 0) return last_name;
+    }
+
+    size_t size = strlen(name) + 1;
+    if(instance->name_pool_used + size > instance->name_pool_block_size) {
+        instance->name_pool_block_size = MAX((size_t)SUBGHZ_KEYSTORE_NAME_POOL_BLOCK_SIZE, size);
+        instance->name_pool_used = 0;
+        SubGhzKeystoreNamePool_push_back(
+            instance->name_pool, malloc(instance->name_pool_block_size));
+    }
+
+    char* pool_name = *SubGhzKeystoreNamePool_back(instance->name_pool) + instance->name_pool_used;
+    memcpy(pool_name, name, size);
+    instance->name_pool_used += size;
+
+    return pool_name;
+}
+
 static void subghz_keystore_add_key(
     SubGhzKeystore* instance,
     const char* name,
     uint64_t key,
     uint16_t type) {
+    const char* pool_name = subghz_keystore_add_name(instance, name);
     SubGhzKey* manufacture_code = SubGhzKeyArray_push_raw(instance->data);
-    manufacture_code->name = furi_string_alloc_set(name);
+    manufacture_code->name = pool_name;
     manufacture_code->key = key;
     manufacture_code->type = type;
 }
@@ -184,6 +252,166 @@ static bool subghz_keystore_read_file(SubGhzKeystore* instance, Stream* stream,
     return result;
 }
 
+/** Read binary keystore fields that follow the header, stream is left at payload start */
+static bool subghz_keystore_binary_read_header(
+    FlipperFormat* flipper_format,
+    uint8_t* iv,
+    uint32_t* key_count,
+    uint32_t* pool_size) {
+    bool result = false;
+    uint32_t encryption;
+    FuriString* temp_str = furi_string_alloc();
+
+    do {
+        if(!flipper_format_read_uint32(flipper_format, "Encryption", &encryption, 1)) {
+            FURI_LOG_E(TAG, "Missing encryption type");
+            break;
+        }
+        if(encryption != SubGhzKeystoreEncryptionAES256) {
+            FURI_LOG_E(TAG, "Unknown encryption");
+            break;
+        }
+        if(!flipper_format_read_hex(flipper_format, "IV", iv, 16)) {
+            FURI_LOG_E(TAG, "Missing IV");
+            break;
+        }
+        if(!flipper_format_read_uint32(flipper_format, "Key_count", key_count, 1)) {
+            FURI_LOG_E(TAG, "Missing Key_count");
+            break;
+        }
+        if(!flipper_format_read_uint32(flipper_format, "Pool_size", pool_size, 1) ||
+           (*pool_size % SUBGHZ_KEYSTORE_BINARY_BLOCK_SIZE)) {
+            FURI_LOG_E(TAG, "Missing or invalid Pool_size");
+            break;
+        }
+        if(!flipper_format_read_string(flipper_format, "Encrypt_data", temp_str)) {
+            FURI_LOG_E(TAG, "Missing Encrypt_data");
+            break;
+        }
+
+        //skip the end of the previous line "\n"
+        Stream* stream = flipper_format_get_raw_stream(flipper_format);
+        uint8_t new_line = 0;
+        if(stream_read(stream, &new_line, 1) != 1 || new_line != '\n') {
+            FURI_LOG_E(TAG, "Malformed file");
+            break;
+        }
+
+        size_t payload_size = *key_count * sizeof(SubGhzKeystoreRecord) +
+                              SUBGHZ_KEYSTORE_BINARY_ALIGN(*key_count * sizeof(uint32_t)) +
+                              *pool_size;
+        if(stream_size(stream) - stream_tell(stream) < payload_size) {
+            FURI_LOG_E(TAG, "Payload exceeds file size");
+            break;
+        }
+
+        subghz_keystore_mess_with_iv(iv);
+        result = true;
+    } while(false);
+
+    furi_string_free(temp_str);
+
+    return result;
+}
+
+/** Read and decrypt next size bytes of payload, size is a multiple of AES block */
+static bool subghz_keystore_binary_decrypt_next(Stream* stream, uint8_t* data, size_t size) {
+    uint8_t buffer[FILE_BUFFER_SIZE];
+
+    while(size) {
+        size_t chunk = MIN(size, (size_t)FILE_BUFFER_SIZE);
+        if(stream_read(stream, buffer, chunk) != chunk) return false;
+        if(!furi_hal_crypto_decrypt(buffer, data, chunk)) return false;
+        data += chunk;
+        size -= chunk;
+    }
+
+    return true;
+}
+
+static bool subghz_keystore_read_binary(SubGhzKeystore* instance, FlipperFormat* flipper_format) {
+    bool result = false;
+    uint8_t iv[16];
+    uint32_t key_count = 0;
+    uint32_t pool_size = 0;
+
+    if(!subghz_keystore_binary_read_header(flipper_format, iv, &key_count, &pool_size)) {
+        return false;
+    }
+
+    Stream* stream = flipper_format_get_raw_stream(flipper_format);
+    // Names are resolved once the pool is read: it follows the records
+    uint32_t* name_offsets = malloc(sizeof(uint32_t) * (key_count + 1));
+    char* pool = malloc(pool_size + 1);
+    size_t keys_start = SubGhzKeyArray_size(instance->data);
+
+    do {
+        if(!furi_hal_crypto_store_load_key(SUBGHZ_KEYSTORE_FILE_ENCRYPTION_KEY_SLOT, iv)) {
+            FURI_LOG_E(TAG, "Unable to load decryption key");
+            break;
+        }
+
+        bool decrypted = true;
+        SubGhzKeystoreRecord record;
+        for(size_t i = 0; i < key_count && decrypted; i++) {
+            decrypted = subghz_keystore_binary_decrypt_next(
+                stream, (uint8_t*)&record, sizeof(SubGhzKeystoreRecord));
+            SubGhzKey* manufacture_code = SubGhzKeyArray_push_raw(instance->data);
+            manufacture_code->name = NULL;
+            manufacture_code->key = record.key;
+            manufacture_code->type = record.type;
+            name_offsets[i] = record.name_offset;
+        }
+        memset(&record, 0, sizeof(SubGhzKeystoreRecord));
+
+        // Sorted index is only for random access, decrypt it to keep CBC chain going
+        uint8_t index_block[FILE_BUFFER_SIZE];
+        size_t index_size = SUBGHZ_KEYSTORE_BINARY_ALIGN(key_count * sizeof(uint32_t));
+        while(index_size && decrypted) {
+            size_t chunk = MIN(index_size, (size_t)FILE_BUFFER_SIZE);
+            decrypted = subghz_keystore_binary_decrypt_next(stream, index_block, chunk);
+            index_size -= chunk;
+        }
+
+        if(decrypted) {
+            decrypted = subghz_keystore_binary_decrypt_next(stream, (uint8_t*)pool, pool_size);
+        }
+        furi_hal_crypto_store_unload_key(SUBGHZ_KEYSTORE_FILE_ENCRYPTION_KEY_SLOT);
+
+        if(!decrypted) {
+            FURI_LOG_E(TAG, "Decryption failed");
+            break;
+        }
+
+        pool[pool_size] = '\0';
+        result = true;
+        for(size_t i = 0; i < key_count; i++) {
+            if(name_offsets[i] >= pool_size) {
+                FURI_LOG_E(TAG, "Invalid name offset");
+                result = false;
+                break;
+            }
+            SubGhzKeyArray_get(instance->data, keys_start + i)->name = pool + name_offsets[i];
+        }
+    } while(false);
+
+    free(name_offsets);
+    if(result) {
+        // Loaded pool becomes a full name pool block
+        SubGhzKeystoreNamePool_push_back(instance->name_pool, pool);
+        instance->name_pool_block_size = pool_size + 1;
+        instance->name_pool_used = pool_size + 1;
+    } else {
+        // Drop partially loaded keys, they have no names
+        while(SubGhzKeyArray_size(instance->data) > keys_start) {
+            SubGhzKeyArray_pop_back(NULL, instance->data);
+        }
+        free(pool);
+    }
+
+    return result;
+}
+
 bool subghz_keystore_load(SubGhzKeystore* instance, const char* file_name) {
     furi_assert(instance);
     bool result = false;
@@ -208,6 +436,11 @@ bool subghz_keystore_load(SubGhzKeystore* instance, const char* file_name) {
             FURI_LOG_E(TAG, "Missing or incorrect header");
             break;
         }
+        if(strcmp(furi_string_get_cstr(filetype), SUBGHZ_KEYSTORE_FILE_BINARY_TYPE) == 0 &&
+           version == SUBGHZ_KEYSTORE_FILE_VERSION) {
+            result = subghz_keystore_read_binary(instance, flipper_format);
+            break;
+        }
         if(!flipper_format_read_uint32(flipper_format, "Encryption", (uint32_t*)&encryption, 1)) {
             FURI_LOG_E(TAG, "Missing encryption type");
             break;
@@ -294,7 +527,7 @@ bool subghz_keystore_save(SubGhzKeystore* instance, const char* file_name, uint8
                     (uint32_t)(key->key >> 32),
                     (uint32_t)key->key,
                     key->type,
-                    furi_string_get_cstr(key->name));
+                    key->name);
                 // Verify length and align
                 furi_assert(len > 0);
                 if(len % 16 != 0) {
@@ -338,6 +571,142 @@ bool subghz_keystore_save(SubGhzKeystore* instance, const char* file_name, uint8
     return result;
 }
 
+/** Encrypt size bytes, multiple of AES block, and append them to stream */
+static bool subghz_keystore_binary_encrypt_next(Stream* stream, const uint8_t* data, size_t size) {
+    uint8_t buffer[FILE_BUFFER_SIZE];
+
+    while(size) {
+        size_t chunk = MIN(size, (size_t)FILE_BUFFER_SIZE);
+        if(!furi_hal_crypto_encrypt(data, buffer, chunk)) return false;
+        if(stream_write(stream, buffer, chunk) != chunk) return false;
+        data += chunk;
+        size -= chunk;
+    }
+
+    return true;
+}
+
+bool subghz_keystore_save_binary(SubGhzKeystore* instance, const char* file_name, uint8_t* iv) {
+    furi_assert(instance);
+    bool result = false;
+
+    uint32_t key_count = SubGhzKeyArray_size(instance->data);
+    uint32_t* name_offsets = malloc(sizeof(uint32_t) * (key_count + 1));
+    uint32_t index_size = SUBGHZ_KEYSTORE_BINARY_ALIGN(key_count * sizeof(uint32_t));
+    uint32_t* sorted = malloc(index_size + SUBGHZ_KEYSTORE_BINARY_BLOCK_SIZE);
+
+    // Every distinct name goes to the pool once
+    uint32_t pool_size = 0;
+    for(size_t i = 0; i < key_count; i++) {
+        const char* name = SubGhzKeyArray_get(instance->data, i)->name;
+        name_offsets[i] = pool_size;
+        for(size_t j = 0; j < i; j++) {
+            if(strcmp(SubGhzKeyArray_get(instance->data, j)->name, name) == 0) {
+                name_offsets[i] = name_offsets[j];
+                break;
+            }
+        }
+        if(name_offsets[i] == pool_size) pool_size += strlen(name) + 1;
+    }
+    pool_size = SUBGHZ_KEYSTORE_BINARY_ALIGN(pool_size);
+    char* pool = malloc(pool_size + 1);
+    for(size_t i = 0; i < key_count; i++) {
+        const char* name = SubGhzKeyArray_get(instance->data, i)->name;
+        strcpy(pool + name_offsets[i], name);
+    }
+
+    // Stable insertion sort: equal keys keep keystore order
+    for(size_t i = 0; i < key_count; i++) {
+        uint64_t key = SubGhzKeyArray_get(instance->data, i)->key;
+        size_t j = i;
+        while(j > 0 && SubGhzKeyArray_get(instance->data, sorted[j - 1])->key > key) {
+            sorted[j] = sorted[j - 1];
+            j--;
+        }
+        sorted[j] = i;
+    }
+
+    Storage* storage = furi_record_open(RECORD_STORAGE);
+    FlipperFormat* flipper_format = flipper_format_file_alloc(storage);
+    do {
+        if(!flipper_format_file_open_always(flipper_format, file_name)) {
+            FURI_LOG_E(TAG, "Unable to open file for write: %s", file_name);
+            break;
+        }
+        if(!flipper_format_write_header_cstr(
+               flipper_format, SUBGHZ_KEYSTORE_FILE_BINARY_TYPE, SUBGHZ_KEYSTORE_FILE_VERSION)) {
+            FURI_LOG_E(TAG, "Unable to add header");
+            break;
+        }
+        uint32_t encryption = SubGhzKeystoreEncryptionAES256;
+        if(!flipper_format_write_uint32(flipper_format, "Encryption", &encryption, 1)) {
+            FURI_LOG_E(TAG, "Unable to add Encryption");
+            break;
+        }
+        if(!flipper_format_write_hex(flipper_format, "IV", iv, 16)) {
+            FURI_LOG_E(TAG, "Unable to add IV");
+            break;
+        }
+        if(!flipper_format_write_uint32(flipper_format, "Key_count", &key_count, 1)) {
+            FURI_LOG_E(TAG, "Unable to add Key_count");
+            break;
+        }
+        if(!flipper_format_write_uint32(flipper_format, "Pool_size", &pool_size, 1)) {
+            FURI_LOG_E(TAG, "Unable to add Pool_size");
+            break;
+        }
+        if(!flipper_format_write_string_cstr(flipper_format, "Encrypt_data", "BIN")) {
+            FURI_LOG_E(TAG, "Unable to add Encrypt_data");
+            break;
+        }
+
+        subghz_keystore_mess_with_iv(iv);
+
+        if(!furi_hal_crypto_store_load_key(SUBGHZ_KEYSTORE_FILE_ENCRYPTION_KEY_SLOT, iv)) {
+            FURI_LOG_E(TAG, "Unable to load encryption key");
+            break;
+        }
+
+        Stream* stream = flipper_format_get_raw_stream(flipper_format);
+        bool encrypted = true;
+        for(size_t i = 0; i < key_count && encrypted; i++) {
+            SubGhzKey* key = SubGhzKeyArray_get(instance->data, i);
+            SubGhzKeystoreRecord record = {
+                .key = key->key,
+                .name_offset = name_offsets[i],
+                .type = key->type,
+                .reserved = 0,
+            };
+            encrypted = subghz_keystore_binary_encrypt_next(
+                stream, (uint8_t*)&record, sizeof(SubGhzKeystoreRecord));
+            memset(&record, 0, sizeof(SubGhzKeystoreRecord));
+        }
+        if(encrypted) {
+            encrypted = subghz_keystore_binary_encrypt_next(stream, (uint8_t*)sorted, index_size);
+        }
+        if(encrypted) {
+            encrypted = subghz_keystore_binary_encrypt_next(stream, (uint8_t*)pool, pool_size);
+        }
+        furi_hal_crypto_store_unload_key(SUBGHZ_KEYSTORE_FILE_ENCRYPTION_KEY_SLOT);
+
+        if(!encrypted) {
+            FURI_LOG_E(TAG, "Encryption failed");
+            break;
+        }
+
+        FURI_LOG_I(TAG, "Success. Keys: %lu, names pool: %lu bytes", key_count, pool_size);
+        result = true;
+    } while(0);
+    flipper_format_free(flipper_format);
+    furi_record_close(RECORD_STORAGE);
+
+    free(pool);
+    free(sorted);
+    free(name_offsets);
+
+    return result;
+}
+
 SubGhzKeyArray_t* subghz_keystore_get_data(SubGhzKeystore* instance) {
     furi_assert(instance);
     return &instance->data;
@@ -611,3 +980,194 @@ bool subghz_keystore_raw_get_data(const char* file_name, size_t offset, uint8_t*
 
     return result;
 }
+
+SubGhzKeystoreBinary* subghz_keystore_binary_alloc() {
+    SubGhzKeystoreBinary* instance = malloc(sizeof(SubGhzKeystoreBinary));
+    instance->storage = furi_record_open(RECORD_STORAGE);
+    instance->flipper_format = flipper_format_file_alloc(instance->storage);
+    return instance;
+}
+
+void subghz_keystore_binary_free(SubGhzKeystoreBinary* instance) {
+    furi_assert(instance);
+    subghz_keystore_binary_close(instance);
+    flipper_format_free(instance->flipper_format);
+    furi_record_close(RECORD_STORAGE);
+    free(instance);
+}
+
+bool subghz_keystore_binary_open(SubGhzKeystoreBinary* instance, const char* file_name) {
+    furi_assert(instance);
+    bool result = false;
+    uint32_t version;
+    FuriString* filetype = furi_string_alloc();
+
+    subghz_keystore_binary_close(instance);
+
+    do {
+        if(!flipper_format_file_open_existing(instance->flipper_format, file_name)) {
+            FURI_LOG_E(TAG, "Unable to open file for read: %s", file_name);
+            break;
+        }
+        if(!flipper_format_read_header(instance->flipper_format, filetype, &version)) {
+            FURI_LOG_E(TAG, "Missing or incorrect header");
+            break;
+        }
+        if(strcmp(furi_string_get_cstr(filetype), SUBGHZ_KEYSTORE_FILE_BINARY_TYPE) != 0 ||
+           version != SUBGHZ_KEYSTORE_FILE_VERSION) {
+            FURI_LOG_E(TAG, "Type or version mismatch");
+            break;
+        }
+        if(!subghz_keystore_binary_read_header(
+               instance->flipper_format,
+               instance->iv,
+               &instance->key_count,
+               &instance->pool_size)) {
+            break;
+        }
+
+        instance->stream = flipper_format_get_raw_stream(instance->flipper_format);
+        instance->data_offset = stream_tell(instance->stream);
+        result = true;
+    } while(false);
+
+    if(!result) subghz_keystore_binary_close(instance);
+    furi_string_free(filetype);
+
+    return result;
+}
+
+void subghz_keystore_binary_close(SubGhzKeystoreBinary* instance) {
+    furi_assert(instance);
+    flipper_format_file_close(instance->flipper_format);
+    instance->stream = NULL;
+    instance->key_count = 0;
+    instance->pool_size = 0;
+}
+
+size_t subghz_keystore_binary_get_count(SubGhzKeystoreBinary* instance) {
+    furi_assert(instance);
+    return instance->key_count;
+}
+
+/** Decrypt size bytes at payload offset, only the blocks that cover them are read */
+static bool subghz_keystore_binary_read(
+    SubGhzKeystoreBinary* instance,
+    size_t offset,
+    uint8_t* data,
+    size_t size) {
+    furi_assert(instance->stream);
+    size_t block_start = offset - offset % SUBGHZ_KEYSTORE_BINARY_BLOCK_SIZE;
+    size_t length = SUBGHZ_KEYSTORE_BINARY_ALIGN(offset + size) - block_start;
+    furi_assert(length <= SUBGHZ_KEYSTORE_BINARY_BUFFER_SIZE);
+
+    uint8_t iv[16];
+    uint8_t buffer[SUBGHZ_KEYSTORE_BINARY_BUFFER_SIZE];
+    uint8_t decrypted[SUBGHZ_KEYSTORE_BINARY_BUFFER_SIZE];
+    bool result = false;
+
+    do {
+        if(block_start == 0) {
+            memcpy(iv, instance->iv, sizeof(iv));
+            if(!stream_seek(instance->stream, instance->data_offset, StreamOffsetFromStart)) break;
+        } else {
+            // CBC: previous ciphertext block is IV of the next one
+            if(!stream_seek(
+                   instance->stream,
+                   instance->data_offset + block_start - sizeof(iv),
+                   StreamOffsetFromStart))
+                break;
+            if(stream_read(instance->stream, iv, sizeof(iv)) != sizeof(iv)) break;
+        }
+        if(stream_read(instance->stream, buffer, length) != length) break;
+
+        if(!furi_hal_crypto_store_load_key(SUBGHZ_KEYSTORE_FILE_ENCRYPTION_KEY_SLOT, iv)) {
+            FURI_LOG_E(TAG, "Unable to load decryption key");
+            break;
+        }
+        result = furi_hal_crypto_decrypt(buffer, decrypted, length);
+        furi_hal_crypto_store_unload_key(SUBGHZ_KEYSTORE_FILE_ENCRYPTION_KEY_SLOT);
+
+        if(result) memcpy(data, decrypted + (offset - block_start), size);
+        memset(decrypted, 0, sizeof(decrypted));
+    } while(false);
+
+    return result;
+}
+
+bool subghz_keystore_binary_get_record(
+    SubGhzKeystoreBinary* instance,
+    size_t index,
+    SubGhzKeystoreRecord* record) {
+    furi_assert(instance);
+    furi_assert(record);
+    if(index >= instance->key_count) return false;
+
+    return subghz_keystore_binary_read(
+        instance, index * sizeof(SubGhzKeystoreRecord), (uint8_t*)record, sizeof(*record));
+}
+
+bool subghz_keystore_binary_get_name(
+    SubGhzKeystoreBinary* instance,
+    const SubGhzKeystoreRecord* record,
+    FuriString* name) {
+    furi_assert(instance);
+    furi_assert(record);
+    if(record->name_offset >= instance->pool_size) return false;
+
+    size_t pool_offset = instance->key_count * sizeof(SubGhzKeystoreRecord) +
+                         SUBGHZ_KEYSTORE_BINARY_ALIGN(instance->key_count * sizeof(uint32_t));
+    size_t size = MIN(
+        (size_t)SUBGHZ_KEYSTORE_NAME_SIZE, (size_t)(instance->pool_size - record->name_offset));
+    char buffer[SUBGHZ_KEYSTORE_NAME_SIZE + 1] = {0};
+
+    if(!subghz_keystore_binary_read(
+           instance, pool_offset + record->name_offset, (uint8_t*)buffer, size)) {
+        return false;
+    }
+    furi_string_set(name, buffer);
+
+    return true;
+}
+
+bool subghz_keystore_binary_find(
+    SubGhzKeystoreBinary* instance,
+    uint64_t key,
+    SubGhzKeystoreRecord* record) {
+    furi_assert(instance);
+    furi_assert(record);
+    size_t index_offset = instance->key_count * sizeof(SubGhzKeystoreRecord);
+
+    // Lower bound over records sorted by key
+    size_t low = 0;
+    size_t high = instance->key_count;
+    while(low < high) {
+        size_t middle = low + (high - low) / 2;
+        uint32_t record_index = 0;
+        if(!subghz_keystore_binary_read(
+               instance,
+               index_offset + middle * sizeof(uint32_t),
+               (uint8_t*)&record_index,
+               sizeof(uint32_t)) ||
+           !subghz_keystore_binary_get_record(instance, record_index, record)) {
+            return false;
+        }
+
+        if(record->key < key) {
+            low = middle + 1;
+        } else {
+            high = middle;
+        }
+    }
+
+    if(low == instance->key_count) return false;
+
+    uint32_t record_index = 0;
+    if(!subghz_keystore_binary_read(
+           instance, index_offset + low * sizeof(uint32_t), (uint8_t*)&record_index, 4) ||
+       !subghz_keystore_binary_get_record(instance, record_index, record)) {
+        return false;
+    }
+
+    return record->key == key;
+}
@@ -9,7 +9,7 @@ extern "C" {
 #endif
 
 typedef struct {
-    FuriString* name;
+    const char* name; /**< Owned by SubGhzKeystore, shared between keys of the same name */
     uint64_t key;
     uint16_t type;
 } SubGhzKey;
@@ -20,6 +20,18 @@ ARRAY_DEF(SubGhzKeyArray, SubGhzKey, M_POD_OPLIST)
 
 typedef struct SubGhzKeystore SubGhzKeystore;
 
+/** Binary keystore record, one AES block */
+typedef struct {
+    uint64_t key;
+    uint32_t name_offset; /**< Offset of zero terminated name in string pool */
+    uint16_t type;
+    uint16_t reserved;
+} SubGhzKeystoreRecord;
+
+_Static_assert(sizeof(SubGhzKeystoreRecord) == 16, "Incorrect SubGhzKeystoreRecord size");
+
+typedef struct SubGhzKeystoreBinary SubGhzKeystoreBinary;
+
 /**
  * Allocate SubGhzKeystore.
  * @return SubGhzKeystore* pointer to a SubGhzKeystore instance
@@ -33,7 +45,7 @@ SubGhzKeystore* subghz_keystore_alloc();
 void subghz_keystore_free(SubGhzKeystore* instance);
 
 /** 
- * Loading manufacture key from file
+ * Loading manufacture key from file, text or binary keystore
  * @param instance Pointer to a SubGhzKeystore instance
  * @param filename Full path to the file
  */
@@ -47,6 +59,16 @@ bool subghz_keystore_load(SubGhzKeystore* instance, const char* filename);
  */
 bool subghz_keystore_save(SubGhzKeystore* instance, const char* filename, uint8_t* iv);
 
+/** 
+ * Save manufacture keys to binary keystore file.
+ * Records keep keystore order, an index sorted by key allows binary search.
+ * @param instance Pointer to a SubGhzKeystore instance
+ * @param filename Full path to the file
+ * @param iv IV, 16 bytes
+ * @return true On success
+ */
+bool subghz_keystore_save_binary(SubGhzKeystore* instance, const char* filename, uint8_t* iv);
+
 /** 
  * Get array of keys and names manufacture
  * @param instance Pointer to a SubGhzKeystore instance
@@ -75,6 +97,75 @@ bool subghz_keystore_raw_encrypted_save(
  */
 bool subghz_keystore_raw_get_data(const char* file_name, size_t offset, uint8_t* data, size_t len);
 
+/** 
+ * Allocate SubGhzKeystoreBinary, random access reader of binary keystore file
+ * @return SubGhzKeystoreBinary* pointer to a SubGhzKeystoreBinary instance
+ */
+SubGhzKeystoreBinary* subghz_keystore_binary_alloc();
+
+/** 
+ * Free SubGhzKeystoreBinary
+ * @param instance Pointer to a SubGhzKeystoreBinary instance
+ */
+void subghz_keystore_binary_free(SubGhzKeystoreBinary* instance);
+
+/** 
+ * Open binary keystore file, only the header is read
+ * @param instance Pointer to a SubGhzKeystoreBinary instance
+ * @param file_name Full path to the file
+ * @return true On success
+ */
+bool subghz_keystore_binary_open(SubGhzKeystoreBinary* instance, const char* file_name);
+
+/** 
+ * Close binary keystore file
+ * @param instance Pointer to a SubGhzKeystoreBinary instance
+ */
+void subghz_keystore_binary_close(SubGhzKeystoreBinary* instance);
+
+/** 
+ * Get number of records in the open binary keystore
+ * @param instance Pointer to a SubGhzKeystoreBinary instance
+ * @return records count
+ */
+size_t subghz_keystore_binary_get_count(SubGhzKeystoreBinary* instance);
+
+/** 
+ * Read record by its position, in keystore order
+ * @param instance Pointer to a SubGhzKeystoreBinary instance
+ * @param index Record position
+ * @param record Returned record
+ * @return true On success
+ */
+bool subghz_keystore_binary_get_record(
+    SubGhzKeystoreBinary* instance,
+    size_t index,
+    SubGhzKeystoreRecord* record);
+
+/** 
+ * Read name of the record
+ * @param instance Pointer to a SubGhzKeystoreBinary instance
+ * @param record Record
+ * @param name Returned name
+ * @return true On success
+ */
+bool subghz_keystore_binary_get_name(
+    SubGhzKeystoreBinary* instance,
+    const SubGhzKeystoreRecord* record,
+    FuriString* name);
+
+/** 
+ * Binary search of the record by key
+ * @param instance Pointer to a SubGhzKeystoreBinary instance
+ * @param key Manufacture key
+ * @param record Returned record, first one in keystore order if key is not unique
+ * @return true if found
+ */
+bool subghz_keystore_binary_find(
+    SubGhzKeystoreBinary* instance,
+    uint64_t key,
+    SubGhzKeystoreRecord* record);
+
 #ifdef __cplusplus
 }
 #endif
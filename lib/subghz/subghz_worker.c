@@ -4,6 +4,8 @@
 
 #define TAG "SubGhzWorker"
 
+#define SUBGHZ_WORKER_BATCH_SIZE 64
+
 struct SubGhzWorker {
     FuriThread* thread;
     FuriStreamBuffer* stream;
@@ -11,13 +13,18 @@ struct SubGhzWorker {
     volatile bool running;
     volatile bool overrun;
 
+    // Pending filtered pair, kept in LevelDuration encoding to be delivered as is
     LevelDuration filter_level_duration;
     bool filter_running;
     uint16_t filter_duration;
 
     SubGhzWorkerOverrunCallback overrun_callback;
     SubGhzWorkerPairCallback pair_callback;
+    SubGhzWorkerPairBatchCallback pair_batch_callback;
     void* context;
+
+    // Received pulses, filtered in place before delivery
+    LevelDuration batch[SUBGHZ_WORKER_BATCH_SIZE];
 };
 
 /** Rx callback timer
@@ -39,6 +46,26 @@ void subghz_worker_rx_callback(bool level, uint32_t duration, void* context) {
     if(sizeof(LevelDuration) != ret) instance->overrun = true;
 }
 
+/** Deliver filtered pairs
+ * 
+ * @param instance Pointer to a SubGhzWorker instance
+ * @param count number of pairs at the start of the batch buffer
+ */
+static void subghz_worker_deliver(SubGhzWorker* instance, size_t count) {
+    if(!count) return;
+
+    if(instance->pair_batch_callback) {
+        instance->pair_batch_callback(instance->context, instance->batch, count);
+    } else if(instance->pair_callback) {
+        for(size_t i = 0; i < count; i++) {
+            instance->pair_callback(
+                instance->context,
+                level_duration_get_level(instance->batch[i]),
+                level_duration_get_duration(instance->batch[i]));
+        }
+    }
+}
+
 /** Worker callback thread
  * 
  * @param context 
@@ -47,12 +74,19 @@ void subghz_worker_rx_callback(bool level, uint32_t duration, void* context) {
 static int32_t subghz_worker_thread_callback(void* context) {
     SubGhzWorker* instance = context;
 
-    LevelDuration level_duration;
     while(instance->running) {
-        int ret = furi_stream_buffer_receive(
-            instance->stream, &level_duration, sizeof(LevelDuration), 10);
-        if(ret == sizeof(LevelDuration)) {
+        // Take everything that is already there, wait only if the buffer is empty
+        size_t received = furi_stream_buffer_receive(
+            instance->stream, instance->batch, sizeof(instance->batch), 10);
+        received /= sizeof(LevelDuration);
+
+        // Filter never produces more pairs than it consumes: write back into the same buffer
+        size_t count = 0;
+        for(size_t i = 0; i < received; i++) {
+            LevelDuration level_duration = instance->batch[i];
             if(level_duration_is_reset(level_duration)) {
+                subghz_worker_deliver(instance, count);
+                count = 0;
                 FURI_LOG_E(TAG, "Overrun buffer");
                 if(instance->overrun_callback) instance->overrun_callback(instance->context);
             } else {
@@ -60,26 +94,20 @@ static int32_t subghz_worker_thread_callback(void* context) {
                 uint32_t duration = level_duration_get_duration(level_duration);
 
                 if(instance->filter_running) {
-                    if((duration < instance->filter_duration) ||
-                       (instance->filter_level_duration.level == level)) {
+                    bool filter_level = level_duration_get_level(instance->filter_level_duration);
+                    if((duration < instance->filter_duration) || (filter_level == level)) {
                         instance->filter_level_duration.duration += duration;
 
-                    } else if(instance->filter_level_duration.level != level) {
-                        if(instance->pair_callback)
-                            instance->pair_callback(
-                                instance->context,
-                                instance->filter_level_duration.level,
-                                instance->filter_level_duration.duration);
-
-                        instance->filter_level_duration.duration = duration;
-                        instance->filter_level_duration.level = level;
+                    } else {
+                        instance->batch[count++] = instance->filter_level_duration;
+                        instance->filter_level_duration = level_duration;
                     }
                 } else {
-                    if(instance->pair_callback)
-                        instance->pair_callback(instance->context, level, duration);
+                    instance->batch[count++] = level_duration;
                 }
             }
         }
+        subghz_worker_deliver(instance, count);
     }
 
     return 0;
@@ -97,6 +125,7 @@ SubGhzWorker* subghz_worker_alloc() {
     //setting filter
     instance->filter_running = true;
     instance->filter_duration = 30;
+    instance->filter_level_duration = level_duration_make(false, 0);
 
     return instance;
 }
@@ -122,6 +151,13 @@ void subghz_worker_set_pair_callback(SubGhzWorker* instance, SubGhzWorkerPairCal
     instance->pair_callback = callback;
 }
 
+void subghz_worker_set_pair_batch_callback(
+    SubGhzWorker* instance,
+    SubGhzWorkerPairBatchCallback callback) {
+    furi_assert(instance);
+    instance->pair_batch_callback = callback;
+}
+
 void subghz_worker_set_context(SubGhzWorker* instance, void* context) {
     furi_assert(instance);
     instance->context = context;
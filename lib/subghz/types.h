@@ -8,6 +8,7 @@
 #include <lib/toolbox/level_duration.h>
 
 #include "environment.h"
+#include "blocks/const.h"
 #include <furi.h>
 #include <furi_hal.h>
 
@@ -40,7 +41,12 @@ typedef bool (*SubGhzDeserialize)(void* context, FlipperFormat* flipper_format);
 
 // Decoder specific
 typedef void (*SubGhzDecoderFeed)(void* decoder, bool level, uint32_t duration);
+typedef void (*SubGhzDecoderFeedBatch)(
+    void* decoder,
+    const LevelDuration* level_duration,
+    size_t count);
 typedef void (*SubGhzDecoderReset)(void* decoder);
+typedef SubGhzBlockEnvelope (*SubGhzDecoderGetEnvelope)(void);
 typedef uint8_t (*SubGhzGetHashData)(void* decoder);
 typedef void (*SubGhzGetString)(void* decoder, FuriString* output);
 
@@ -53,7 +59,15 @@ typedef struct {
     SubGhzFree free;
 
     SubGhzDecoderFeed feed;
+    /** Optional: same as calling feed for every pulse, without per-pulse dispatch */
+    SubGhzDecoderFeedBatch feed_batch;
     SubGhzDecoderReset reset;
+    /** Optional: pulse durations that can take decoder out of its reset step.
+     * Decoder instance must start with SubGhzProtocolDecoderBase followed by SubGhzBlockDecoder,
+     * and feeding other durations in reset step must not change its state.
+     * Receiver skips such pulses while decoder is in reset step.
+     */
+    SubGhzDecoderGetEnvelope get_envelope;
 
     SubGhzGetHashData get_hash_data;
     SubGhzGetString get_string;
@@ -13,6 +13,14 @@ extern "C" {
  */
 Stream* buffered_file_stream_alloc(Storage* storage);
 
+/**
+ * Allocate a file stream with buffered read operations and custom cache size.
+ * Larger cache means fewer storage transactions for sequential access.
+ * @param cache_size cache size in bytes
+ * @return Stream*
+ */
+Stream* buffered_file_stream_alloc_ex(Storage* storage, size_t cache_size);
+
 /**
  * Opens an existing file or creates a new one.
  * @param stream pointer to file stream object.
@@ -2,6 +2,9 @@
 #include "stream_i.h"
 #include "file_stream.h"
 
+// Block size for moving file data in place
+#define FILE_STREAM_MOVE_BLOCK_SIZE (2048)
+
 typedef struct {
     Stream stream_base;
     Storage* storage;
@@ -161,75 +164,112 @@ static size_t file_stream_read(FileStream* stream, uint8_t* data, size_t size) {
     return size - need_to_read;
 }
 
+// Move data inside the file, ranges may overlap
+static bool file_stream_move(
+    FileStream* stream,
+    size_t source,
+    size_t destination,
+    size_t size,
+    uint8_t* buffer) {
+    bool result = true;
+    size_t moved = (source == destination) ? size : 0;
+
+    while(result && (moved < size)) {
+        size_t block_size = MIN(size - moved, (size_t)FILE_STREAM_MOVE_BLOCK_SIZE);
+        // Data is moved from the end when going forward, so it is read before being overwritten
+        size_t offset = (destination < source) ? moved : (size - moved - block_size);
+
+        result = storage_file_seek(stream->file, source + offset, true) &&
+                 (file_stream_read(stream, buffer, block_size) == block_size) &&
+                 storage_file_seek(stream->file, destination + offset, true) &&
+                 (file_stream_write(stream, buffer, block_size) == block_size);
+        moved += block_size;
+    }
+
+    return result;
+}
+
+// Append zeroes to the file, so that data can be moved past its end
+static bool file_stream_extend(FileStream* stream, size_t size, uint8_t* buffer) {
+    memset(buffer, 0, FILE_STREAM_MOVE_BLOCK_SIZE);
+    if(!storage_file_seek(stream->file, file_stream_size(stream), true)) return false;
+    while(size > 0) {
+        size_t block_size = MIN(size, (size_t)FILE_STREAM_MOVE_BLOCK_SIZE);
+        if(file_stream_write(stream, buffer, block_size) != block_size) return false;
+        size -= block_size;
+    }
+    return true;
+}
+
 static bool file_stream_delete_and_insert(
     FileStream* _stream,
     size_t delete_size,
     StreamWriteCB write_callback,
     const void* ctx) {
     bool result = false;
+    bool modified = false;
     Stream* stream = (Stream*)_stream;
+    uint8_t* buffer = malloc(FILE_STREAM_MOVE_BLOCK_SIZE);
 
-    // open scratchpad
-    Stream* scratch_stream = file_stream_alloc(_stream->storage);
-
-    // TODO: we need something like "storage_open_tmpfile and storage_close_tmpfile"
-    FuriString* scratch_name;
-    FuriString* tmp_name;
-    tmp_name = furi_string_alloc();
-    storage_get_next_filename(
-        _stream->storage, STORAGE_ANY_PATH_PREFIX, ".scratch", ".pad", tmp_name, 255);
-    scratch_name = furi_string_alloc_printf(ANY_PATH("%s.pad"), furi_string_get_cstr(tmp_name));
-    furi_string_free(tmp_name);
+    size_t current_position = stream_tell(stream);
+    size_t file_size = stream_size(stream);
 
     do {
-        if(!file_stream_open(
-               scratch_stream,
-               furi_string_get_cstr(scratch_name),
-               FSAM_READ_WRITE,
-               FSOM_CREATE_NEW))
-            break;
-
-        size_t current_position = stream_tell(stream);
-        size_t file_size = stream_size(stream);
+        // Inserted data is written past the end of the file, its size is needed to move the tail.
+        // Until the tail is moved, the original data is untouched and the file is truncated back
+        // on error.
+        if(!storage_file_seek(_stream->file, file_size, true)) break;
+        if(write_callback) {
+            if(!write_callback(stream, ctx)) break;
+        }
+        size_t insert_position = file_size;
+        size_t insert_size = stream_tell(stream) - insert_position;
 
         size_t size_to_delete = file_size - current_position;
         size_to_delete = MIN(delete_size, size_to_delete);
 
-        size_t size_to_copy_before = current_position;
-        size_t size_to_copy_after = file_size - current_position - size_to_delete;
-
-        // copy file from 0 to insert position to scratchpad
-        if(!stream_rewind(stream)) break;
-        if(stream_copy(stream, scratch_stream, size_to_copy_before) != size_to_copy_before) break;
-
-        if(write_callback) {
-            if(!write_callback(scratch_stream, ctx)) break;
+        size_t tail_position = current_position + size_to_delete;
+        size_t tail_size = file_size - tail_position;
+        size_t new_tail_position = current_position + insert_size;
+
+        if(new_tail_position > tail_position) {
+            // move inserted data out of the way of the tail, which is moved towards the end
+            size_t new_insert_position = new_tail_position + tail_size;
+            if(!file_stream_extend(_stream, new_insert_position - insert_position, buffer)) break;
+            if(!file_stream_move(
+                   _stream, insert_position, new_insert_position, insert_size, buffer))
+                break;
+            insert_position = new_insert_position;
+
+            modified = true;
+            if(!file_stream_move(_stream, tail_position, new_tail_position, tail_size, buffer))
+                break;
+            if(!file_stream_move(_stream, insert_position, current_position, insert_size, buffer))
+                break;
+        } else {
+            // inserted data fits in the deleted one, then the tail is moved towards the beginning
+            modified = true;
+            if(!file_stream_move(_stream, insert_position, current_position, insert_size, buffer))
+                break;
+            if(!file_stream_move(_stream, tail_position, new_tail_position, tail_size, buffer))
+                break;
         }
-        size_t new_position = stream_tell(scratch_stream);
 
-        // copy key file after insert position + size_to_delete to scratchpad
-        if(!stream_seek(stream, size_to_delete, StreamOffsetFromCurrent)) break;
-        if(stream_copy(stream, scratch_stream, size_to_copy_after) != size_to_copy_after) break;
-
-        size_t new_file_size = stream_size(scratch_stream);
-
-        // copy whole scratchpad file to the original file
-        if(!stream_rewind(stream)) break;
-        if(!stream_rewind(scratch_stream)) break;
-        if(stream_copy(scratch_stream, stream, new_file_size) != new_file_size) break;
-
-        // and truncate original file
+        // truncate the file and leave seek pointer at insert end
+        if(!storage_file_seek(_stream->file, new_tail_position + tail_size, true)) break;
         if(!storage_file_truncate(_stream->file)) break;
-
-        // move seek pointer at insert end
-        if(!stream_seek(stream, new_position, StreamOffsetFromStart)) break;
+        if(!stream_seek(stream, new_tail_position, StreamOffsetFromStart)) break;
 
         result = true;
     } while(false);
 
-    stream_free(scratch_stream);
-    storage_common_remove(_stream->storage, furi_string_get_cstr(scratch_name));
-    furi_string_free(scratch_name);
+    if(!result && !modified) {
+        storage_file_seek(_stream->file, file_size, true);
+        storage_file_truncate(_stream->file);
+        storage_file_seek(_stream->file, current_position, true);
+    }
+
+    free(buffer);
 
     return result;
 }
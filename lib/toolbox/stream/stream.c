@@ -32,6 +32,21 @@ static bool stream_seek_to_char_forward(Stream* stream, char c) {
         return false;
     }
 
+    // Search character directly in the stream buffer, if there is one
+    const uint8_t* data = NULL;
+    size_t size = stream_peek(stream, &data);
+    if(size > 0) {
+        while(size > 0) {
+            const uint8_t* found = memchr(data, c, size);
+            if(found) {
+                return stream_seek(stream, found - data, StreamOffsetFromCurrent);
+            }
+            if(!stream_seek(stream, size, StreamOffsetFromCurrent)) break;
+            size = stream_peek(stream, &data);
+        }
+        return false;
+    }
+
     // Search character in a stream
     bool result = false;
     while(!result) {
@@ -122,6 +137,13 @@ size_t stream_read(Stream* stream, uint8_t* data, size_t size) {
     return stream->vtable->read(stream, data, size);
 }
 
+size_t stream_peek(Stream* stream, const uint8_t** data) {
+    furi_assert(stream);
+    furi_assert(data);
+    if(!stream->vtable->peek) return 0;
+    return stream->vtable->peek(stream, data);
+}
+
 bool stream_delete_and_insert(
     Stream* stream,
     size_t delete_size,
@@ -145,8 +167,46 @@ static bool stream_write_struct(Stream* stream, const void* context) {
     return (stream_write(stream, write_data->data, write_data->size) == write_data->size);
 }
 
+void stream_cat_line(FuriString* string, const uint8_t* data, size_t size) {
+    while(size) {
+        const uint8_t* cr = memchr(data, '\r', size);
+        size_t length = cr ? (size_t)(cr - data) : size;
+
+        if(furi_string_empty(string)) {
+            furi_string_set_strn(string, (const char*)data, length);
+        } else {
+            furi_string_reserve(string, furi_string_size(string) + length);
+            for(size_t i = 0; i < length; i++) {
+                furi_string_push_back(string, data[i]);
+            }
+        }
+
+        // Skip '\r'
+        if(cr) length++;
+        data += length;
+        size -= length;
+    }
+}
+
 bool stream_read_line(Stream* stream, FuriString* str_result) {
     furi_string_reset(str_result);
+
+    // Scan the line directly in the stream buffer, if there is one
+    const uint8_t* data = NULL;
+    size_t size = stream_peek(stream, &data);
+    if(size > 0) {
+        while(size > 0) {
+            const uint8_t* eol = memchr(data, '\n', size);
+            const size_t length = eol ? (size_t)(eol - data) + 1 : size;
+
+            stream_cat_line(str_result, data, length);
+            if(!stream_seek(stream, length, StreamOffsetFromCurrent)) break;
+            if(eol) break;
+            size = stream_peek(stream, &data);
+        }
+        return furi_string_size(str_result) != 0;
+    }
+
     uint8_t buffer[STREAM_BUFFER_SIZE];
 
     do {
@@ -95,6 +95,16 @@ size_t stream_write(Stream* stream, const uint8_t* data, size_t size);
  */
 size_t stream_read(Stream* stream, uint8_t* data, size_t count);
 
+/**
+ * Get direct access to the data after the current position without copying it.
+ * Position is not changed, use stream_seek to consume the data.
+ * Only streams with an internal buffer support it, so the caller must fall back to stream_read.
+ * @param stream Stream instance
+ * @param data pointer to the data, valid until the next stream operation
+ * @return size_t how many bytes are available, 0 at the end of the stream or if not supported
+ */
+size_t stream_peek(Stream* stream, const uint8_t** data);
+
 /**
  * Delete N chars from the stream and write data by calling write_callback(context)
  * @param stream Stream instance
@@ -121,6 +131,15 @@ bool stream_delete_and_insert(
  */
 bool stream_read_line(Stream* stream, FuriString* str_result);
 
+/**
+ * Append line data to the string, skipping CR
+ * Used by line readers that scan their own buffers
+ * @param string string to append to
+ * @param data line data without LF
+ * @param size data size
+ */
+void stream_cat_line(FuriString* string, const uint8_t* data, size_t size);
+
 /**
  * Moves the RW pointer to the start
  * @param stream Stream instance
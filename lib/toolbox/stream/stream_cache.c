@@ -1,15 +1,16 @@
 #include "stream_cache.h"
 
-#define STREAM_CACHE_MAX_SIZE 1024U
-
 struct StreamCache {
-    uint8_t data[STREAM_CACHE_MAX_SIZE];
+    size_t max_size;
     size_t data_size;
     size_t position;
+    uint8_t data[];
 };
 
-StreamCache* stream_cache_alloc() {
-    StreamCache* cache = malloc(sizeof(StreamCache));
+StreamCache* stream_cache_alloc(size_t max_size) {
+    furi_assert(max_size > 0);
+    StreamCache* cache = malloc(sizeof(StreamCache) + max_size);
+    cache->max_size = max_size;
     cache->data_size = 0;
     cache->position = 0;
     return cache;
@@ -39,8 +40,12 @@ size_t stream_cache_pos(StreamCache* cache) {
     return cache->position;
 }
 
+size_t stream_cache_max_size(StreamCache* cache) {
+    return cache->max_size;
+}
+
 size_t stream_cache_fill(StreamCache* cache, Stream* stream) {
-    const size_t size_read = stream_read(stream, cache->data, STREAM_CACHE_MAX_SIZE);
+    const size_t size_read = stream_read(stream, cache->data, cache->max_size);
     cache->data_size = size_read;
     cache->position = 0;
     return size_read;
@@ -64,9 +69,15 @@ size_t stream_cache_read(StreamCache* cache, uint8_t* data, size_t size) {
     return size_read;
 }
 
+size_t stream_cache_peek(StreamCache* cache, const uint8_t** data) {
+    furi_assert(cache->data_size >= cache->position);
+    *data = cache->data + cache->position;
+    return cache->data_size - cache->position;
+}
+
 size_t stream_cache_write(StreamCache* cache, const uint8_t* data, size_t size) {
     furi_assert(cache->data_size >= cache->position);
-    const size_t size_written = MIN(size, STREAM_CACHE_MAX_SIZE - cache->position);
+    const size_t size_written = MIN(size, cache->max_size - cache->position);
     if(size_written > 0) {
         memcpy(cache->data + cache->position, data, size_written);
         cache->position += size_written;
@@ -10,9 +10,10 @@ typedef struct StreamCache StreamCache;
 
 /**
  * Allocate stream cache.
+ * @param max_size Size of cached data in bytes
  * @return StreamCache* pointer to a StreamCache instance
  */
-StreamCache* stream_cache_alloc();
+StreamCache* stream_cache_alloc(size_t max_size);
 
 /**
  * Free stream cache.
@@ -47,6 +48,13 @@ size_t stream_cache_size(StreamCache* cache);
  */
 size_t stream_cache_pos(StreamCache* cache);
 
+/**
+ * Get the maximum size of cached data.
+ * @param cache Pointer to a StreamCache instance
+ * @return Size of the cache buffer.
+ */
+size_t stream_cache_max_size(StreamCache* cache);
+
 /**
  * Load the cache with new data from a stream.
  * @param cache Pointer to a StreamCache instance
@@ -72,6 +80,14 @@ bool stream_cache_flush(StreamCache* cache, Stream* stream);
  */
 size_t stream_cache_read(StreamCache* cache, uint8_t* data, size_t size);
 
+/**
+ * Get cached data after the internal cursor without advancing it.
+ * @param cache Pointer to a StreamCache instance.
+ * @param data Pointer to the cached data, valid until the cache is changed.
+ * @return Size of cached data after the cursor.
+ */
+size_t stream_cache_peek(StreamCache* cache, const uint8_t** data);
+
 /**
  * Write to cached data and advance the internal cursor.
  * @param cache Pointer to a StreamCache instance.